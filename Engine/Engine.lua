@@ -103,7 +103,7 @@ project "Engine"
 		}
 
 	filter "configurations:Debug"
-		defines "ME_DEBUG"
+		defines { "ME_DEBUG", "ME_MEMWATCH" }
 		symbols "on"
 		runtime "Debug"
 
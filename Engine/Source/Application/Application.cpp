@@ -7,6 +7,7 @@
 #include <Core/Utility/Benchmark/Benchmark.hpp>
 #include <Core/Containers/Array.hpp>
 #include <Core/Containers/String.hpp>
+#include <Core/Memory/Allocators/FrameArena.hpp>
 #include <Core/Platform/Base/IO.hpp>
 #include <Core/Time.hpp>
 
@@ -96,6 +97,7 @@ namespace ME
 		meshPoolInfo.IndexMemoryPoolSize = ME_MESH_MNG_IND_BUFFER_SIZE;
 		meshPoolInfo.MeshletMemoryPoolSize = ME_MESH_MNG_MESHLET_BUFFER_SIZE;
 		meshPoolInfo.BindingInfo = commonBinding;
+		meshPoolInfo.AllocatorType = Core::Memory::OffsetAllocatorType::TLSF;
 
 		Render::Manager::MeshManager::Get().Init(meshPoolInfo);
 
@@ -122,6 +124,10 @@ namespace ME
 	{
 		while (m_Runs && !s_ShutdownRequested)
 		{
+			// Scratch memory of the previous frame is free again
+			ME::Core::Memory::FrameArena::NextFrame();
+			ME::Core::Utility::MemWatch::OnFrame();
+
 			float64 delta = ME::Core::Clock::Time::Update().AsSeconds();
 			m_Window->OnUpdate(delta);
 			m_World->OnUpdate(static_cast<float32>(delta));
@@ -137,17 +143,18 @@ namespace ME
 
 			Render::Renderer::BeginFrame();
 
-			ME::Core::Array<ME::Core::Memory::Reference<ECS::Entity>> cameras = m_World->GetEntitiesWhichAre<ME::EditorCamera>();
+			auto cameras = m_World->GetEntitiesWhichAre<ME::EditorCamera>();
 			if (!cameras.Empty())
 			{
 			    auto entsWithMesh = m_World->View<Components::TransformComponent, Components::MeshComponent>();
 				ME::Core::Memory::Reference<ME::Render::Camera> camera = std::static_pointer_cast<ME::EditorCamera>(cameras[0]);
 
 			    Render::Renderer::BeginScene(camera);
+				Components::TransformComponent::UpdateDirtyMatrices(*m_World);
 				for (const auto& entity : entsWithMesh)
 				{
-					Components::MeshComponent mesh = entity->GetComponent<Components::MeshComponent>();
-					Components::TransformComponent transform = entity->GetComponent<Components::TransformComponent>();
+					Components::MeshComponent& mesh = entity->GetComponent<Components::MeshComponent>();
+					Components::TransformComponent& transform = entity->GetComponent<Components::TransformComponent>();
 					Render::Renderer::RenderMesh(mesh, transform);
 				}
 				Render::Renderer::EndScene();
@@ -216,6 +223,7 @@ namespace ME
 		for (auto& asset : m_AppData.AssetPaths)
             if (!Manager::AssetManager::Load(asset, true))
 				ME_ERROR("Failed to load asset: \"{}\"!", asset);
+		Render::Manager::MeshManager::Get().LogPoolStatistics();
 		for (auto& shader : m_AppData.ShaderPaths)
 		{
 		    if (!Render::Manager::ShaderManager::Get().LoadShaders(shader))
@@ -9,6 +9,8 @@
 
 extern ME::Application* ME::CreateApplication();
 
+ME_MEMWATCH_GLOBAL_NEW_OPERATORS()
+
 #ifdef PLATFORM_WINDOWS
 BOOL WINAPI TerminationHandler(DWORD signal)
 {
@@ -16,8 +18,10 @@ BOOL WINAPI TerminationHandler(DWORD signal)
 	{
 		ME::Application::RequestShutdown();
 
+#ifdef ME_MEMWATCH
+		ME::Core::Utility::MemWatch::Shutdown((ME::Core::IO::DirectoryStorage::GetDirectory(TEXT("ProgramPath")) + TEXT("MemWatch.json")).String());
+#endif
 		ME::Core::IO::DirectoryStorage::Shutdown();
-		//	Pawn::MemWatch::OnExit();
 		ME::Core::Utility::Logger::Shutdown();
 		ME::Core::Clock::Time::Shutdown();
 		return TRUE;
@@ -50,6 +54,9 @@ int main(int32 argc, const asciichar** argv)
 	app->Run();
 	delete app;
 
+#ifdef ME_MEMWATCH
+	ME::Core::Utility::MemWatch::Shutdown((ME::Core::IO::DirectoryStorage::GetDirectory(TEXT("ProgramPath")) + TEXT("MemWatch.json")).String());
+#endif
 	ME::Core::IO::DirectoryStorage::Shutdown();
 	ME::Core::Utility::Logger::Shutdown();
 	ME::Core::Clock::Time::Shutdown();
@@ -21,6 +21,7 @@ namespace ME::Assets
 
     struct AudioFile
     {
+        // Comes from LargeBlockHeap, give it back with LargeBlockHeap::Deallocate(Data, Size)
         void* Data = nullptr;
         SIZE_T Size = 0;
         AudioFormat Format;
@@ -1,6 +1,7 @@
 #pragma once
 #include <Core.hpp>
 #include <Core/Containers/Array.hpp>
+#include <Core/Containers/SparseSet.hpp>
 #include <Core/Containers/UnorderedMap.hpp>
 #include <Core/Containers/UnorderedSet.hpp>
 #include <Core/Memory/CompileTimeHasher.hpp>
@@ -16,7 +17,9 @@ namespace ME::ECS
 
     namespace Helper
     {
-        using ComponentIDGenerator = Core::TypeIDGenerator<ComponentType, ME_MAX_COMPONENT_COUNT>;
+        struct ComponentCategory {};
+        // Dense indices, each one is a bit in the Signature
+        using ComponentIDGenerator = Core::TypeIDGenerator<ComponentCategory, ME_MAX_COMPONENT_COUNT>;
 
         class IComponentArray
         {
@@ -31,86 +34,71 @@ namespace ME::ECS
         class ComponentArray : public IComponentArray
         {
         public:
-            ComponentArray(uint64 maxCount) : m_ComponentArray(maxCount), m_Size(0)
+            // Reserving up front keeps component pointers valid while other entities get components
+            ComponentArray(uint64 maxCount) : m_MaxCount(maxCount)
             {
-
+                m_Components.Reserve(maxCount);
             }
 
             void InsertData(uint64 entity, T& component)
             {
-                ME_ASSERT(m_EntityToIndex.Find(entity) == m_EntityToIndex.End(), "Component added to same entity more than once.");
-                if (m_ComponentArray.Capacity() <= m_Size)
+                ME_ASSERT(!m_Components.Contains(entity), "Component added to same entity more than once.");
+                if (m_Components.Size() >= m_MaxCount)
                 {
-                    ME_ERROR("Can't add component of type {} more than {}!", typeid(T).name(), m_ComponentArray.Capacity());
+                    ME_ERROR("Can't add component of type {} more than {}!", ME::Core::TypeNameOf<T>, m_MaxCount);
                     return;
                 }
 
-                SIZE_T newIndex = m_Size;
-                m_EntityToIndex[entity] = newIndex;
-                m_IndexToEntity[newIndex] = entity;
-                new (&m_ComponentArray[newIndex]) T();
-                m_ComponentArray[newIndex] = std::move(component);
-                ++m_Size;
+                m_Components.Emplace(entity, std::move(component));
             }
 
             void RemoveData(uint64 entity)
             {
-                ME_ASSERT(m_EntityToIndex.Find(entity) != m_EntityToIndex.End(), "Removing non-existent component.");
-
-                uint64 indexOfRemovedEntity = m_EntityToIndex[entity];
-                uint64 indexOfLastElement = m_Size - 1;
-                if (indexOfRemovedEntity != indexOfLastElement)
-                {
-                    m_ComponentArray[indexOfRemovedEntity] = std::move(m_ComponentArray[indexOfLastElement]);
-
-                    uint64 entityOfLastElement = m_IndexToEntity[indexOfLastElement];
-                    m_EntityToIndex[entityOfLastElement] = indexOfRemovedEntity;
-                    m_IndexToEntity[indexOfRemovedEntity] = entityOfLastElement;
-                }
-
-                m_ComponentArray[indexOfRemovedEntity].~T();
-                new (&m_ComponentArray[indexOfRemovedEntity]) T(std::move(m_ComponentArray[indexOfLastElement]));
-                m_ComponentArray[indexOfLastElement].~T();
-
-                m_EntityToIndex.Erase(entity);
-                m_IndexToEntity.Erase(indexOfLastElement);
-
-                --m_Size;
+                ME_ASSERT(m_Components.Contains(entity), "Removing non-existent component.");
+                m_Components.Erase(entity);
             }
 
             T* GetData(uint64 entity)
             {
-                ME_ASSERT(m_EntityToIndex.Find(entity) != m_EntityToIndex.End(), "Retrieving non-existent component.");
-
-                return &m_ComponentArray[m_EntityToIndex[entity]];
+                ME_ASSERT(m_Components.Contains(entity), "Retrieving non-existent component.");
+                return m_Components.Find(entity);
             }
 
             void OnEntityDestroyed(uint64 entity) override
             {
-                if (m_EntityToIndex.Find(entity) != m_EntityToIndex.End())
-                {
-                    RemoveData(entity);
-                }
+                m_Components.Erase(entity);
             }
 
             bool Contains(uint64 entity) override
             {
-                return m_EntityToIndex.Contains(entity);
+                return m_Components.Contains(entity);
             }
 
             ME::Core::Array<uint64> GetEntities() const override
             {
-                ME::Core::Array<uint64> entities = {};
-                for (const auto& pair : m_EntityToIndex)
-                    entities.EmplaceBack(pair.Value1);
-                return entities;
+                return m_Components.Keys();
+            }
+
+            // Same as GetEntities() without the copy, only valid until the array changes
+            const ME::Core::Array<uint64>& EntityIDs() const
+            {
+                return m_Components.Keys();
+            }
+
+            // Packed components in the same order as EntityIDs(), only valid until the array changes
+            T* Data()
+            {
+                return m_Components.Data();
+            }
+
+            SIZE_T Size() const
+            {
+                return m_Components.Size();
             }
 
         private:
-            ME::Core::Array<T> m_ComponentArray;
-            ME::Core::UnorderedMap<uint64, uint64> m_EntityToIndex;
-            ME::Core::UnorderedMap<uint64, uint64> m_IndexToEntity;
-            uint64 m_Size;
+            ME::Core::SparseSet<T> m_Components;
+            uint64 m_MaxCount;
         };
     }
 
@@ -120,6 +108,9 @@ namespace ME::ECS
         template<typename T>
         void RegisterComponent(uint64 maxCount)
         {
+            if (!Helper::ComponentIDGenerator::Validate<T>())
+                return;
+
             ComponentType type = GetComponentType<T>();
             if (m_RegisteredComponents.Find(type) != m_RegisteredComponents.End())
                 ME_WARN("Registering component type more than once.");
@@ -202,8 +193,7 @@ namespace ME::ECS
         static ComponentType GetComponentType()
         {
             static_assert(std::is_base_of_v<Components::Component, T>, "Can't use non-component type in GetComponentType() method!");
-            static ComponentType typeID = Helper::ComponentIDGenerator::ID<T>();
-            return typeID;
+            return Helper::ComponentIDGenerator::ID<T>;
         }
 
         template <typename T>
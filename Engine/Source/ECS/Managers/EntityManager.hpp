@@ -5,11 +5,11 @@
 //#include <Core/Containers/Queue.hpp>
 
 //temporary
-#include <queue>
 #include <bitset>
 
 #include <Core/Containers/Array.hpp>
-#include <Core/Containers/Map.hpp>
+#include <Core/Containers/MPMCQueue.hpp>
+#include <Core/Containers/BTreeMap.hpp>
 #include <Core/TypeID.hpp>
 #include "ECS/Entity.hpp"
 #include "ECSLimits.hpp"
@@ -20,7 +20,8 @@ namespace ME::ECS
 
     namespace Helper
     {
-        using EntityTypeIDGenerator = Core::TypeIDGenerator<EntityType, ME_MAX_COMPONENT_COUNT>;
+        struct EntityCategory {};
+        using EntityTypeIDGenerator = Core::TypeIDGenerator<EntityCategory>;
     }
 
     struct EntityPack
@@ -30,13 +31,16 @@ namespace ME::ECS
         Entity::EntityVirtualFunctions vfptrs;
     };
 
+    // Only handing out and taking back entity IDs is safe from several threads. The entity map and the
+    // signatures aren't synchronized, create, destroy and update entities from one thread
     class MEAPI EntityManager
     {
     public:
         EntityManager()
+            : m_AvailableEntityIDs(ME_MAX_ENTITY_COUNT), m_Signatures(ME_MAX_ENTITY_COUNT)
         {
             for (uint64 entity = 0; entity < ME_MAX_ENTITY_COUNT; ++entity)
-                m_AvailableEntityIDs.push(entity);
+                m_AvailableEntityIDs.TryPush(entity);
         }
 
     public:
@@ -58,7 +62,7 @@ namespace ME::ECS
 
             m_Signatures[entityID].reset();
 
-            m_AvailableEntityIDs.push(entityID);
+            m_AvailableEntityIDs.TryPush(entityID);
             m_Entities.Erase(entityID);
             --m_EntityCount;
         }
@@ -66,8 +70,9 @@ namespace ME::ECS
         ME_NODISCARD uint64 OnEntityCreated()
         {
             ME_ASSERT(m_EntityCount < ME_MAX_ENTITY_COUNT, "Too many entities in existence.");
-            uint64 id = m_AvailableEntityIDs.front();
-            m_AvailableEntityIDs.pop();
+            uint64 id = 0;
+            [[maybe_unused]] const bool popped = m_AvailableEntityIDs.TryPop(id);
+            ME_ASSERT(popped, "No free entity IDs left.");
             ++m_EntityCount;
             return id;
         }
@@ -79,9 +84,10 @@ namespace ME::ECS
 
         ME::Core::Memory::Reference<Entity> GetEntity(uint64 entity)
         {
-            if (m_Entities.Find(entity) == m_Entities.End())
+            auto it = m_Entities.Find(entity);
+            if (it == m_Entities.End())
                 return nullptr;
-            return m_Entities.Find(entity)->Value2.Entity;
+            return it->Value2.Entity;
         }
 
         void OnCreated()
@@ -105,7 +111,7 @@ namespace ME::ECS
                     vfptrs.Value2.vfptrs.OnDestroy();
         }
 
-        ME::Core::Map<uint64, EntityPack>& GetEntities()
+        ME::Core::BTreeMap<uint64, EntityPack>& GetEntities()
         {
             return m_Entities;
         };
@@ -115,14 +121,13 @@ namespace ME::ECS
         static EntityType GetEntityType()
         {
             static_assert(std::is_base_of_v<ME::ECS::Entity, T>, "Can't use non-entity type in GetEntityType() method!");
-            static EntityType typeID = Helper::EntityTypeIDGenerator::ID<T>();
-            return typeID;
+            return Helper::EntityTypeIDGenerator::ID<T>;
         }
 
     private:
-        std::queue<uint64> m_AvailableEntityIDs;
+        ME::Core::MPMCQueue<uint64> m_AvailableEntityIDs;
         ME::Core::Array<Signature> m_Signatures;
-        ME::Core::Map<uint64, EntityPack> m_Entities;
+        ME::Core::BTreeMap<uint64, EntityPack> m_Entities;
         ME::Core::Atomic_uint64 m_EntityCount;
     };
 }
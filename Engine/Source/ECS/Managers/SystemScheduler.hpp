@@ -1,7 +1,7 @@
 #pragma once
 #include <Core.hpp>
 #include <Core/Containers/String.hpp>
-#include <Core/Containers/Set.hpp>
+#include <Core/Containers/BTreeSet.hpp>
 #include <Core/Containers/UnorderedMap.hpp>
 #include <Core/TypeID.hpp>
 
@@ -13,12 +13,13 @@ namespace ME::ECS
 
     namespace Helper
     {
-        using SystemIDGenerator = Core::TypeIDGenerator<SystemType, UINT64_MAX>;
+        struct SystemCategory {};
+        using SystemIDGenerator = Core::TypeIDGenerator<SystemCategory>;
     }
 
     struct System
     {
-        ME::Core::Set<uint64> Entities;
+        ME::Core::BTreeSet<uint64> Entities;
     };
 
     class MEAPI SystemScheduler
@@ -27,6 +28,8 @@ namespace ME::ECS
         template<typename T>
         ME::Core::Memory::Reference<T> RegisterSystem()
         {
+            Helper::SystemIDGenerator::Validate<T>();
+
             SystemType typeID = GetSystemType<T>();
             if (m_Systems.Find(typeID) != m_Systems.End())
                 ME_WARN("Registering system more than once.");
@@ -70,8 +73,7 @@ namespace ME::ECS
         static SystemType GetSystemType()
         {
             static_assert(std::is_base_of_v<System, T>, "Can't use non-component type in GetComponentType() method!");
-            static SystemType typeID = Helper::SystemIDGenerator::ID<T>();
-            return typeID;
+            return Helper::SystemIDGenerator::ID<T>;
         }
 
     private:
@@ -2,6 +2,7 @@
 #include <Core.hpp>
 
 #include "Core/Math/Math.hpp"
+#include "Core/Memory/Allocators/ArenaAllocator.hpp"
 #include "ECS/Managers/ComponentManager.hpp"
 #include "ECS/Managers/EntityManager.hpp"
 #include "Managers/SystemScheduler.hpp"
@@ -152,6 +153,13 @@ namespace ME::ECS
             return m_ComponentManager->GetComponents<T>()->GetEntities();
         }
 
+        // Direct access to the packed storage, for passes that go over every T at once
+        template<typename T>
+        ME::Core::Memory::Reference<Helper::ComponentArray<T>> GetComponents()
+        {
+            return m_ComponentManager->GetComponents<T>();
+        }
+
         template<typename T>
         ME::Core::Memory::Reference<T> RegisterSystem()
         {
@@ -164,11 +172,13 @@ namespace ME::ECS
             m_SystemScheduler->SetSignature<T>(signature);
         }
 
+        // The returned array lives in the frame arena, don't keep it past the current frame
         template<typename T, typename... argTs>
-        ME::Core::Array<ME::Core::Memory::Reference<Entity>> View()
+        ME::Core::FrameArray<ME::Core::Memory::Reference<Entity>> View()
         {
-            ME::Core::Array<ME::Core::Memory::Reference<Entity>> entities = {};
-            ME::Core::Array<uint64> entitiesWithT = GetComponentEntities<T>();
+            const ME::Core::Array<uint64>& entitiesWithT = m_ComponentManager->GetComponents<T>()->EntityIDs();
+            ME::Core::FrameArray<ME::Core::Memory::Reference<Entity>> entities = {};
+            entities.Reserve(entitiesWithT.Size());
             for (const auto& ent : entitiesWithT)
             {
                 bool hasAllComponents = true;
@@ -183,11 +193,12 @@ namespace ME::ECS
         }
 
 
+        // The returned array lives in the frame arena, don't keep it past the current frame
         template<typename T>
-        ME::Core::Array<ME::Core::Memory::Reference<Entity>> GetEntitiesWhichAre()
+        ME::Core::FrameArray<ME::Core::Memory::Reference<Entity>> GetEntitiesWhichAre()
         {
             static_assert(std::is_base_of_v<ME::ECS::Entity, T>, "Can't use non-entity type in GetEntitiesWhichAre() method!");
-            ME::Core::Array<ME::Core::Memory::Reference<Entity>> entities = {};
+            ME::Core::FrameArray<ME::Core::Memory::Reference<Entity>> entities = {};
             ME::ECS::EntityType requiredType = ME::ECS::EntityManager::GetEntityType<T>();
             
             for (const auto& entityPack : m_EntityManager->GetEntities())
@@ -0,0 +1,19 @@
+#include "TransformComponent.hpp"
+#include "ECS/World.hpp"
+
+namespace ME::Components
+{
+    void TransformComponent::UpdateDirtyMatrices(ECS::World& world)
+    {
+        auto components = world.GetComponents<TransformComponent>();
+        TransformComponent* data = components->Data();
+
+        Core::FrameArray<Core::Math::Transform*> dirty = {};
+        dirty.Reserve(components->Size());
+        for (SIZE_T i = 0; i < components->Size(); i++)
+            if (data[i].Transform.IsDirty())
+                dirty.EmplaceBack(&data[i].Transform);
+
+        Core::Math::Transform::UpdateMatrices(dirty.Data(), dirty.Size());
+    }
+}
@@ -4,6 +4,11 @@
 
 #include <Core/Math/Transform.hpp>
 
+namespace ME::ECS
+{
+    class World;
+}
+
 namespace ME::Components
 {
     struct MEAPI TransformComponent : ECS::Components::Component
@@ -12,6 +17,9 @@ namespace ME::Components
             Transform(Core::Math::Transform()) {}
         ~TransformComponent() override = default;
 
+        // Recalculates the matrix of every dirty transform in the world in one batch, call it before rendering
+        static void UpdateDirtyMatrices(ECS::World& world);
+
         Core::Math::Transform Transform;
     };
 }
\ No newline at end of file
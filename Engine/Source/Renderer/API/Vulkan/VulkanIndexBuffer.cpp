@@ -35,7 +35,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
 	}
 
-	void VulkanIndexBuffer::SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset)
+	void VulkanIndexBuffer::SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset)
 	{
 		ME_ASSERT(indexCount <= m_Specification.IndexCount, "Trying to set data with different size in index buffer \"{0}\"!", m_DebugName);
         void* bufferData;
@@ -212,7 +212,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
 	}
 
-	void VulkanIndexBuffer::Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer)
+	void VulkanIndexBuffer::Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer)
 	{
 		VkBufferMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -250,13 +250,13 @@ namespace ME::Render
 		}
 	}
 
-    void VulkanIndexBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset)
+    void VulkanIndexBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset)
 	{
 		RenderCommand::Get()->As<VulkanRenderAPI>()->BindIndexBuffer(commandBuffer, m_Buffer, offset);
 	}
 
-    void VulkanIndexBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-                                 ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanIndexBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+                                 const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
 		RenderCommand::GetResourceHandler()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_ResourceIndex);
     }
@@ -286,7 +286,7 @@ namespace ME::Render
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, size, offset, binding);
 	}
 
-    void VulkanIndexBuffer::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanIndexBuffer::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
         BarrierInfo dst)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BufferBarrier(commandBuffer, m_Buffer, src, dst);
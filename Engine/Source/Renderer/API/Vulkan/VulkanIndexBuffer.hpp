@@ -21,7 +21,7 @@ namespace ME::Render
 
 	public:
 		void SetData(uint32* indices, SIZE_T indexCount, SIZE_T offset) override;
-		void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset) override;
+		void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset) override;
 
 		MappedBufferData Map() override;
 		void Unmap() override;
@@ -29,13 +29,13 @@ namespace ME::Render
 	    void Resize(SIZE_T indexCount) override;
 
 	    void Clear() override;
-		void Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer) override;
+		void Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer) override;
 
 		void Shutdown() override;
 
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset) override;
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-			ME::Core::Memory::Reference<Pipeline> pipeline) override;
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset) override;
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+			const ME::Core::Memory::Reference<Pipeline>& pipeline) override;
 
 		/**
 		 * Write buffer to a resource set
@@ -70,7 +70,7 @@ namespace ME::Render
 		 */
 		void Write(SIZE_T size, SIZE_T offset, uint32 binding) override;
 
-		void Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src, BarrierInfo dst) override;
+		void Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src, BarrierInfo dst) override;
 
 		inline SIZE_T GetCount() const override { return m_Specification.IndexCount; }
 
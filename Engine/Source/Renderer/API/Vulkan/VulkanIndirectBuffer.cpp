@@ -96,8 +96,8 @@ namespace ME::Render
         render->NameVulkanObject(m_DebugName, ME_VK_TO_UINT_HANDLE(m_Buffer), VK_OBJECT_TYPE_BUFFER);
     }
 
-    void VulkanIndirectBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanIndirectBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_ResourceIndex);
     }
@@ -127,7 +127,7 @@ namespace ME::Render
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, size, offset, binding);
     }
 
-    void VulkanIndirectBuffer::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanIndirectBuffer::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
         BarrierInfo dst)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BufferBarrier(commandBuffer, m_Buffer, src, dst);
@@ -140,7 +140,7 @@ namespace ME::Render
         RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
     }
 
-    void VulkanIndirectBuffer::Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer)
+    void VulkanIndirectBuffer::Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer)
     {
         VkBufferMemoryBarrier barrier = {};
         barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
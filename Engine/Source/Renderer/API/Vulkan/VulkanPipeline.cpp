@@ -43,7 +43,7 @@ namespace ME::Render
 		}
 	}
 
-	void VulkanPipeline::SetViewports(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications)
+	void VulkanPipeline::SetViewports(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications)
 	{
 		ME::Core::Array<VkViewport> viewports;
 
@@ -63,7 +63,7 @@ namespace ME::Render
 		vkCmdSetViewportWithCount(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), static_cast<uint32>(viewports.Size()), viewports.Data());
 	}
 
-	void VulkanPipeline::SetScissors(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors)
+	void VulkanPipeline::SetScissors(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors)
 	{
 		ME::Core::Array<VkRect2D> vkScissors;
 
@@ -81,13 +81,13 @@ namespace ME::Render
 		vkCmdSetScissorWithCount(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), static_cast<uint32>(vkScissors.Size()), vkScissors.Data());
 	}
 
-    void VulkanPipeline::SetConstants(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ShaderStage shaderStage, void* constants,
+    void VulkanPipeline::SetConstants(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ShaderStage shaderStage, void* constants,
         SIZE_T constantsSize)
     {
 		vkCmdPushConstants(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), m_PipelineLayout, ConvertShaderStageVulkan(shaderStage), 0, static_cast<uint32>(constantsSize), constants);
     }
 
-    void VulkanPipeline::Bind(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer)
+    void VulkanPipeline::Bind(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer)
 	{
 		vkCmdBindPipeline(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), m_PipelineBindPoint, m_Pipeline);
 	}
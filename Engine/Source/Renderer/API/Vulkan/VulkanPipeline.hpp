@@ -15,12 +15,12 @@ namespace ME::Render
 	public:
 		void Shutdown() override;
 
-		void SetViewports(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications) override;
-		void SetScissors(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors) override;
-		void SetConstants(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ShaderStage shaderStage, void* constants,
+		void SetViewports(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications) override;
+		void SetScissors(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors) override;
+		void SetConstants(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ShaderStage shaderStage, void* constants,
 			SIZE_T constantsSize) override;
 
-		void Bind(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer) override;
+		void Bind(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer) override;
 
 		inline const PipelineSpecification& GetSpecification() const override { return m_Specification; };
 
@@ -96,7 +96,7 @@ namespace ME::Render
         }
     }
 
-    void VulkanRenderAPI::Submit(ME::Core::Memory::Reference<Render::CommandBuffer> buffer)
+    void VulkanRenderAPI::Submit(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer)
     {
         uint32_t imageIndex = m_SwapChain->GetImageIndex();
         uint32_t frameIndex = m_SwapChain->GetFrameIndex();
@@ -206,17 +206,17 @@ namespace ME::Render
     {
     }
 
-    void VulkanRenderAPI::Draw(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance)
+    void VulkanRenderAPI::Draw(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance)
     {
         vkCmdDraw(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), vertexCount, instanceCount, firstVertex, firstInstance);
     }
 
-    void VulkanRenderAPI::DrawIndexed(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 indexCount, uint32 index)
+    void VulkanRenderAPI::DrawIndexed(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 indexCount, uint32 index)
     {
         vkCmdDrawIndexed(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), indexCount, 1, index, 0, 0);
     }
 
-    void VulkanRenderAPI::DrawIndexedIndirect(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset, uint32 drawCount,
         uint32 stride)
     {
@@ -238,7 +238,15 @@ namespace ME::Render
         vkCmdDrawIndexedIndirect(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), buffer->As<VulkanIndirectBuffer>()->GetBuffer(), offset, drawCount, stride);
     }
 
-    void VulkanRenderAPI::DrawIndexedIndirectCount(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, SIZE_T offset, uint32 drawCount,
+        uint32 stride)
+    {
+        // Filled by the host, the submit already makes those writes visible to the indirect read
+        vkCmdDrawIndexedIndirect(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), buffer->As<VulkanStorageBuffer>()->GetBuffer(), offset, drawCount, stride);
+    }
+
+    void VulkanRenderAPI::DrawIndexedIndirectCount(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         PipelineStageFlags bufferSrc,
         const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset,
         const ME::Core::Memory::Reference<Render::IndirectBuffer>& drawCount, uint32 drawCountOffset,
@@ -250,13 +258,13 @@ namespace ME::Render
             maxDrawCount, stride);
     }
 
-    void VulkanRenderAPI::DispatchMesh(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::DispatchMesh(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ)
     {
         f_vkCmdDrawMeshTasksEXT(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), groupCountX, groupCountY, groupCountZ);
     }
 
-    void VulkanRenderAPI::Dispatch(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ)
+    void VulkanRenderAPI::Dispatch(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ)
     {
         vkCmdDispatch(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), groupCountX, groupCountY, groupCountZ);
     }
@@ -342,20 +350,20 @@ namespace ME::Render
         m_ResourceHandler->WriteResource(buffer);
     }
 
-    void VulkanRenderAPI::BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<Render::Pipeline> pipeline, 
+    void VulkanRenderAPI::BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, 
         ME::Core::Memory::Reference<ME::Render::Buffer> buffer)
     {
         m_ResourceHandler->BindResourceSet(commandBuffer, pipeline, buffer->GetBaseSpecification().Set, buffer->GetResourceSet());
     }
 
-    void VulkanRenderAPI::BindIndexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BindIndexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, uint32 offset)
     {
         vkCmdBindIndexBuffer(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), buffer->As<VulkanIndexBuffer>()->GetBuffer(), offset, VK_INDEX_TYPE_UINT32);
     }
 
-    void VulkanRenderAPI::BindVertexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BindVertexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, uint32 offset)
     {
         VkDeviceSize vkOffset = offset;
@@ -363,56 +371,56 @@ namespace ME::Render
         vkCmdBindVertexBuffers(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), 0, 1, &vkBuffer, &vkOffset);
     }
 
-    void VulkanRenderAPI::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->BufferBarrier(commandBuffer, buffer, src, dst);
     }
 
-    void VulkanRenderAPI::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->BufferBarrier(commandBuffer, buffer, src, dst);
     }
 
-    void VulkanRenderAPI::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->BufferBarrier(commandBuffer, buffer, src, dst);
     }
 
-    void VulkanRenderAPI::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->BufferBarrier(commandBuffer, buffer, src, dst);
     }
 
-    void VulkanRenderAPI::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->BufferBarrier(commandBuffer, buffer, src, dst);
     }
 
-    void VulkanRenderAPI::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->TextureBarrier(commandBuffer, texture, src, dst);
     }
 
-    void VulkanRenderAPI::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->TextureBarrier(commandBuffer, texture, src, dst);
     }
 
-    void VulkanRenderAPI::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst)
     {
         m_ResourceHandler->TextureBarrier(commandBuffer, texture, src, dst);
     }
 
-    void VulkanRenderAPI::BindTexture(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
-                                      ME::Core::Memory::Reference<Render::Pipeline> pipeline,
+    void VulkanRenderAPI::BindTexture(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
+                                      const ME::Core::Memory::Reference<Render::Pipeline>& pipeline,
                                       ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set)
     {
         m_ResourceHandler->BindResourceSet(commandBuffer, pipeline, set, texture->GetSpecification().SetIndex);
@@ -436,7 +444,7 @@ namespace ME::Render
     }
 
     void VulkanRenderAPI::SubmitAndFreeSingleUseCommandBuffer(
-	    ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer)
+	    const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer)
     {
         buffer->Finish();
         VkCommandBuffer buf = buffer->As<VulkanCommandBuffer>()->GetCommandBuffer();
@@ -756,6 +764,7 @@ namespace ME::Render
     	features.depthBiasClamp = true;
         features.depthBounds = true;
         features.sampleRateShading = true;
+        features.multiDrawIndirect = true;
 
         VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures = {};
         meshShaderFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
@@ -1100,7 +1109,8 @@ namespace ME::Render
 
     inline bool VulkanRenderAPI::CheckPhysicalDeviceFeatures(const VkPhysicalDeviceFeatures& features)
     {
-        return features.geometryShader && features.logicOp && features.wideLines && features.fillModeNonSolid && features.depthClamp && features.depthBiasClamp;
+        return features.geometryShader && features.logicOp && features.wideLines && features.fillModeNonSolid && features.depthClamp && features.depthBiasClamp
+            && features.multiDrawIndirect;
     }
 
     inline bool VulkanRenderAPI::CheckPhysicalDeviceProperties(const VkPhysicalDeviceProperties& properties)
@@ -1206,13 +1216,13 @@ namespace ME::Render
         return m_SwapChain->As<VulkanSwapChain>();
     }
 
-    void VulkanRenderAPI::BindIndexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BindIndexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         VkBuffer buffer, uint32 offset)
     {
         vkCmdBindIndexBuffer(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), buffer, offset, VK_INDEX_TYPE_UINT32);
     }
 
-    void VulkanRenderAPI::BindVertexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanRenderAPI::BindVertexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         VkBuffer buffer, uint32 offset)
     {
         VkDeviceSize vkOffset = offset;
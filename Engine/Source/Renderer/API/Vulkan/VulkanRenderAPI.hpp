@@ -45,25 +45,28 @@ namespace ME::Render
 
 		void CreateFramebuffers(ME::Core::Memory::Reference<ME::Render::RenderPass> renderPass,
 			const ME::Core::Array<ME::Core::Memory::Reference<Render::RTexture2D>>& attachments) override;
-		void Submit(ME::Core::Memory::Reference<Render::CommandBuffer> buffer) override;
+		void Submit(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer) override;
 		void NewFrame() override;
 		void EndFrame() override;
 		void Present() override;
 		void Clear(ME::Core::Math::Vector4D32 color) override;
 
-	    void Draw(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance) override;
-		void DrawIndexed(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 indexCount, uint32 index) override;
-		void DrawIndexedIndirect(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	    void Draw(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance) override;
+		void DrawIndexed(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 indexCount, uint32 index) override;
+		void DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset,
 			uint32 drawCount, uint32 stride) override;
-		void DrawIndexedIndirectCount(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
+			const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, SIZE_T offset,
+			uint32 drawCount, uint32 stride) override;
+		void DrawIndexedIndirectCount(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			PipelineStageFlags bufferSrc,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset, 
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& drawCount, uint32 drawCountOffset, 
 			uint32 maxDrawCount, uint32 stride) override;
-        void DispatchMesh(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, uint32 groupCountX,
+        void DispatchMesh(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, uint32 groupCountX,
             uint32 groupCountY, uint32 groupCountZ) override;
-		void Dispatch(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) override;
+		void Dispatch(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) override;
 
 	    void Shutdown() override;
 
@@ -72,48 +75,48 @@ namespace ME::Render
 		inline void WriteResource(ME::Core::Memory::Reference<ME::Render::IndexBuffer> buffer) override;
 		inline void WriteResource(ME::Core::Memory::Reference<ME::Render::VertexBuffer> buffer) override;
 		inline void WriteResource(ME::Core::Memory::Reference<ME::Render::IndirectBuffer> buffer) override;
-		inline void BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, 
-			ME::Core::Memory::Reference<Render::Pipeline> pipeline, 
+		inline void BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, 
+			const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, 
 			ME::Core::Memory::Reference<ME::Render::Buffer> buffer) override;
-		inline void BindIndexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BindIndexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, uint32 offset) override;
-		inline void BindVertexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BindVertexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, uint32 offset) override;
 
-		inline void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
 
-		inline void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
-		inline void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
 
-		void BindTexture(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Render::Pipeline> pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set) override;
+		void BindTexture(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set) override;
 
 		void OnWindowEvent(int32 x, int32 y) override;
 
 		ME::Core::Memory::Reference<ME::Render::CommandBuffer> GetAvailableCommandBuffer() override;
 
 		ME::Core::Memory::Reference<ME::Render::CommandBuffer> GetSingleUseCommandBuffer() override;
-		void SubmitAndFreeSingleUseCommandBuffer(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer) override;
+		void SubmitAndFreeSingleUseCommandBuffer(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer) override;
 
 		void Resize(uint32 x, uint32 y) override;
 
@@ -140,9 +143,9 @@ namespace ME::Render
 		inline Render::VulkanSwapChain* GetVulkanSwapChain();
 
     public:
-		inline void BindIndexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BindIndexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			VkBuffer buffer, uint32 offset);
-		inline void BindVertexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		inline void BindVertexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			VkBuffer buffer, uint32 offset);
 
 	private:
@@ -34,7 +34,7 @@ namespace ME::Render
 		}
 	}
 
-	void VulkanRenderPass::Begin(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, RenderPassBeginInfo& beginInfo)
+	void VulkanRenderPass::Begin(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, RenderPassBeginInfo& beginInfo)
 	{
 		VulkanCommandBuffer* cmdBuf = buffer->As<VulkanCommandBuffer>();
 
@@ -64,7 +64,7 @@ namespace ME::Render
 		vkCmdBeginRenderPass(cmdBuf->GetCommandBuffer(), &vkBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 	}
 
-	void VulkanRenderPass::End(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer)
+	void VulkanRenderPass::End(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer)
 	{
 		vkCmdEndRenderPass(buffer->As<VulkanCommandBuffer>()->GetCommandBuffer());
 	}
@@ -16,8 +16,8 @@ namespace ME::Render
 	public:
 		void Shutdown() override;
 
-		void Begin(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, RenderPassBeginInfo& beginInfo) override;
-		void End(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer) override;
+		void Begin(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, RenderPassBeginInfo& beginInfo) override;
+		void End(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer) override;
 
 	public:
 		inline VkRenderPass GetRenderPass() { return m_Pass; }
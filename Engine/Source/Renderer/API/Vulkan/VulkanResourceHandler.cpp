@@ -338,7 +338,7 @@ namespace ME::Render
     {
     }
 
-    void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
                                               const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
 	{
 		VkBufferMemoryBarrier bufferBarrier = {};
@@ -360,7 +360,7 @@ namespace ME::Render
 			0, nullptr);
 	}
 
-	void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst)
 	{
 		VkBufferMemoryBarrier bufferBarrier = {};
@@ -382,7 +382,7 @@ namespace ME::Render
 			0, nullptr);
 	}
 
-	void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src,
 		BarrierInfo dst)
 	{
@@ -405,7 +405,7 @@ namespace ME::Render
 			0, nullptr);
 	}
 
-	void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src,
 		BarrierInfo dst)
 	{
@@ -428,7 +428,7 @@ namespace ME::Render
 			0, nullptr);
 	}
 
-	void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst)
 	{
 		VkBufferMemoryBarrier bufferBarrier = {};
@@ -450,7 +450,7 @@ namespace ME::Render
 			0, nullptr);
 	}
 
-	void VulkanResourceHandler::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst)
 	{
 		Texture1DSpecification texSpecs = texture->As<VulkanTexture1D>()->GetSpecification();
@@ -484,7 +484,7 @@ namespace ME::Render
 			1, &textureBarrier);
 	}
 
-	void VulkanResourceHandler::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst)
 	{
 		Texture2DSpecification texSpecs = texture->As<VulkanTexture2D>()->GetSpecification();
@@ -518,7 +518,7 @@ namespace ME::Render
 		    1, &textureBarrier);
 	}
 
-	void VulkanResourceHandler::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	void VulkanResourceHandler::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 		const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst)
 	{
 		Texture3DSpecification texSpecs = texture->As<VulkanTexture3D>()->GetSpecification();
@@ -761,7 +761,7 @@ namespace ME::Render
 			nullptr);
     }
 
-    void VulkanResourceHandler::BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanResourceHandler::BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         VkBuffer buffer, BarrierInfo src, BarrierInfo dst)
     {
 		VkBufferMemoryBarrier bufferBarrier = {};
@@ -783,7 +783,7 @@ namespace ME::Render
 			0, nullptr);
     }
 
-    void VulkanResourceHandler::TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+    void VulkanResourceHandler::TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
         VkImage image, const TextureSpecification& specs, BarrierInfo src, BarrierInfo dst)
     {
 		VkImageSubresourceRange range = {};
@@ -815,7 +815,7 @@ namespace ME::Render
 			1, &textureBarrier);
     }
 
-    void VulkanResourceHandler::BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Render::Pipeline> pipeline, uint32 set, uint32 setIndex)
+    void VulkanResourceHandler::BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, uint32 set, uint32 setIndex)
 	{
 		vkCmdBindDescriptorSets(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), pipeline->As<VulkanPipeline>()->GetPipelineBindPoint(), pipeline->As<VulkanPipeline>()->GetPipelineLayout(), set, 1, &m_Sets[setIndex].Set, 0, nullptr);
 	}
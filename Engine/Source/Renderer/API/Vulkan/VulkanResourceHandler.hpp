@@ -61,32 +61,32 @@ namespace ME::Render
 		void WriteResource(ME::Core::Memory::Reference<ME::Render::Texture2D> texture) override;
 		void WriteResource(ME::Core::Memory::Reference<ME::Render::Texture3D> texture) override;
 
-		void BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Render::Pipeline> pipeline,
+		void BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline,
 			uint32 set, uint32 setIndex) override;
 
-	    void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+	    void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
-		void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src,
 			BarrierInfo dst) override;
 
-		void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
-		void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
-		void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src,
 			BarrierInfo dst) override;
 
@@ -100,10 +100,10 @@ namespace ME::Render
 		void WriteResource(VulkanIndirectBuffer* buffer, SIZE_T size, SIZE_T offset, uint32 binding);
 		void WriteResource(VulkanStorageBuffer* buffer, SIZE_T size, SIZE_T offset, uint32 binding);
 
-		void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			VkBuffer buffer, BarrierInfo src,
 			BarrierInfo dst);
-		void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			VkImage image, const TextureSpecification& specs, BarrierInfo src,
 			BarrierInfo dst);
 
@@ -54,7 +54,7 @@ namespace ME::Render
         RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
     }
 
-    void VulkanStorageBuffer::SetData(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, void* data,
+    void VulkanStorageBuffer::SetData(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, void* data,
                                       SIZE_T size, SIZE_T offset)
     {
         ME_ASSERT(size + offset <= m_Specification.Size, "Trying to set data with different size in storage buffer \"{0}\"!", m_DebugName);
@@ -204,7 +204,7 @@ namespace ME::Render
         RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
     }
 
-    void VulkanStorageBuffer::Clear(ME::Core::Memory::Reference<CommandBuffer> commandBuffer)
+    void VulkanStorageBuffer::Clear(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer)
     {
         VkBufferMemoryBarrier barrier = {};
         barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -226,8 +226,8 @@ namespace ME::Render
         vkCmdFillBuffer(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), m_Buffer, 0, m_Specification.Size, 0);
     }
 
-    void VulkanStorageBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanStorageBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_ResourceIndex);
     }
@@ -257,7 +257,7 @@ namespace ME::Render
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, size, offset, binding);
     }
 
-    void VulkanStorageBuffer::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanStorageBuffer::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
                                       BarrierInfo dst)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BufferBarrier(commandBuffer, m_Buffer, src, dst);
@@ -297,6 +297,8 @@ namespace ME::Render
         VkBufferCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         createInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | (m_Specification.MemoryType == MemoryType::RAM ? 0 : VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        if (m_Specification.IndirectDraw)
+            createInfo.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
         createInfo.size = static_cast<uint64>(m_Specification.Size);
         createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         createInfo.queueFamilyIndexCount = 0;
@@ -61,7 +61,7 @@ namespace ME::Render
 		}
 	}
 
-    void VulkanTexture2D::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanTexture2D::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_Specification.SetIndex);
     }
@@ -91,7 +91,7 @@ namespace ME::Render
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, binding);
 	}
 
-    void VulkanTexture2D::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanTexture2D::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
         BarrierInfo dst)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->TextureBarrier(commandBuffer, m_Image, GetBaseSpecification(), src, dst);
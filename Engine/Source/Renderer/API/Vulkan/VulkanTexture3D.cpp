@@ -55,8 +55,8 @@ namespace ME::Render
         UpdateImage(data, size);
     }
 
-    void VulkanTexture3D::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanTexture3D::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_Specification.SetIndex);
     }
@@ -86,7 +86,7 @@ namespace ME::Render
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, binding);
     }
 
-    void VulkanTexture3D::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanTexture3D::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
                                   BarrierInfo dst)
     {
         RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->TextureBarrier(commandBuffer, m_Image, GetBaseSpecification(), src, dst);
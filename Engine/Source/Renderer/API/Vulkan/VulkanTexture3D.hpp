@@ -20,9 +20,9 @@ namespace ME::Render
 		void SetData(void* data, SIZE_T size) override;
 		inline ME::Core::Math::Resolution3D<uint32> GetResolution() const override { return m_Specification.Resolution; }
 
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset) override {}
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-			ME::Core::Memory::Reference<Pipeline> pipeline) override;
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset) override {}
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+			const ME::Core::Memory::Reference<Pipeline>& pipeline) override;
 
 		/**
 		 * Write texture to a resource set
@@ -57,7 +57,7 @@ namespace ME::Render
 		 */
 		void Write(SIZE_T size, SIZE_T offset, uint32 binding) override;
 
-		void Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src, BarrierInfo dst) override;
+		void Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src, BarrierInfo dst) override;
 
 	public:
 		inline VkImage GetImage() { return m_Image; }
@@ -37,7 +37,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
 	}
 
-	void VulkanUniform::SetData(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset)
+	void VulkanUniform::SetData(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset)
 	{
 		ME_ASSERT(size + offset <= m_Specification.Size, "Trying to set data with different size in uniform \"{0}\"!", m_DebugName);
 
@@ -187,7 +187,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
     }
 
-    void VulkanUniform::Clear(ME::Core::Memory::Reference<CommandBuffer> commandBuffer)
+    void VulkanUniform::Clear(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer)
     {
 		VkBufferMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -209,8 +209,8 @@ namespace ME::Render
 		vkCmdFillBuffer(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), m_Buffer, 0, m_Specification.Size, 0);
     }
 
-    void VulkanUniform::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanUniform::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_ResourceIndex);
     }
@@ -240,7 +240,7 @@ namespace ME::Render
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, size, offset, binding);
 	}
 
-    void VulkanUniform::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanUniform::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
         BarrierInfo dst)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BufferBarrier(commandBuffer, m_Buffer, src, dst);
@@ -32,7 +32,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
 	}
 
-	void VulkanVertexBuffer::SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset)
+	void VulkanVertexBuffer::SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset)
 	{
 		ME_ASSERT(size + offset <= m_Specification.Size, "Trying to set data with different size in vertex buffer \"{0}\"!", m_DebugName);
 		void* bufferData;
@@ -207,7 +207,7 @@ namespace ME::Render
 		RenderCommand::Get()->SubmitAndFreeSingleUseCommandBuffer(commandBuffer);
 	}
 
-	void VulkanVertexBuffer::Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer)
+	void VulkanVertexBuffer::Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer)
 	{
 		VkBufferMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -229,12 +229,12 @@ namespace ME::Render
 		vkCmdFillBuffer(commandBuffer->As<VulkanCommandBuffer>()->GetCommandBuffer(), m_Buffer, 0, m_Specification.Size, 0);
 	}
 
-    void VulkanVertexBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset)
+    void VulkanVertexBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset)
     {
 		RenderCommand::Get()->As<VulkanRenderAPI>()->BindVertexBuffer(commandBuffer, m_Buffer, offset);
     }
 
-    void VulkanVertexBuffer::Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Pipeline> pipeline)
+    void VulkanVertexBuffer::Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Pipeline>& pipeline)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BindResourceSet(commandBuffer, pipeline, m_Specification.Set, m_ResourceIndex);
     }
@@ -264,7 +264,7 @@ namespace ME::Render
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->WriteResource(this, size, offset, binding);
 	}
 
-    void VulkanVertexBuffer::Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src,
+    void VulkanVertexBuffer::Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src,
                                      BarrierInfo dst)
     {
 		RenderCommand::GetResourceHandler()->As<VulkanResourceHandler>()->BufferBarrier(commandBuffer, m_Buffer, src, dst);
@@ -22,7 +22,7 @@ namespace ME::Render
 		void Shutdown() override;
 
 		void SetData(void* data, SIZE_T size, SIZE_T offset) override;
-		void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset) override;
+		void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset) override;
 
 		MappedBufferData Map() override;
 		void Unmap() override;
@@ -30,10 +30,10 @@ namespace ME::Render
 		void Resize(SIZE_T size) override;
 
 		void Clear() override;
-		void Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer) override;
+		void Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer) override;
 
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset) override;
-		void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Pipeline> pipeline) override;
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset) override;
+		void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Pipeline>& pipeline) override;
 
 		/**
 		 * Write buffer to a resource set
@@ -68,7 +68,7 @@ namespace ME::Render
 		 */
 		void Write(SIZE_T size, SIZE_T offset, uint32 binding) override;
 
-		void Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src, BarrierInfo dst) override;
+		void Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src, BarrierInfo dst) override;
 
 		inline void UpdateResourceSet(uint32 setIndex) override { m_ResourceIndex = setIndex; };
 		inline uint32 GetResourceSet() const override { return m_ResourceIndex; }
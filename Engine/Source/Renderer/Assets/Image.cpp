@@ -2,7 +2,7 @@
 
 namespace ME::Assets
 {
-	Image::Image(ME::Core::Array<uint8>&& image, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name)
+	Image::Image(PixelArray&& image, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name)
 	{
 		m_Data = std::move(image);
 		m_Resolution = resolution;
@@ -11,7 +11,8 @@ namespace ME::Assets
 
 	Image::Image(const uint8* data, SIZE_T size, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name)
 	{
-		m_Data = std::initializer_list<uint8>(data, data + size);
+		m_Data.Reserve(size);
+		m_Data.Insert(m_Data.End(), data, data + size);
 		m_Resolution = resolution;
 		m_Name = name;
 	}
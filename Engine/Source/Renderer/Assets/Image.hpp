@@ -4,6 +4,7 @@
 
 #include "Core/Containers/Array.hpp"
 #include "Core/Containers/String/BasicString.hpp"
+#include "Core/Memory/Allocators/LargeBlockAllocator.hpp"
 #include "Core/Math/Rect2D.hpp"
 
 namespace ME::Assets
@@ -11,17 +12,21 @@ namespace ME::Assets
 	class MEAPI Image
 	{
 	public:
-		Image(ME::Core::Array<uint8>&& image, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name);
+		// Decoded pixels are big and live as long as the image, so they get their own pages
+		using PixelArray = ME::Core::Array<uint8, ME::Core::Memory::LargeBlockAllocator<uint8>>;
+
+	public:
+		Image(PixelArray&& image, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name);
 		Image(const uint8* data, SIZE_T size, ME::Core::Math::Resolution2D<uint32> resolution, const ME::Core::String& name);
 		~Image() = default;
 
 	public:
-		ME::Core::Array<uint8>& GetImage() { return m_Data; }
+		PixelArray& GetImage() { return m_Data; }
 		ME::Core::Math::Resolution2D<uint32> GetResolution() const { return m_Resolution; }
 		const ME::Core::String& GetName() const { return m_Name; }
 
 	private:
-		ME::Core::Array<uint8> m_Data;
+		PixelArray m_Data;
 		ME::Core::Math::Resolution2D<uint32> m_Resolution;
 		ME::Core::String m_Name;
 
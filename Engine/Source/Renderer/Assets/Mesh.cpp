@@ -37,8 +37,13 @@ namespace ME::Assets
             ME_WARN("Can't update vertices in the loaded mesh {0}! Using previous mesh.", m_GroupName);
             return;
         }
-	    m_Indices = indices;
-	    m_Vertices = vertices;
+	    // Sized once, growing would map new pages on every step
+	    m_Indices.Clear();
+	    m_Indices.Reserve(indices.Size());
+	    m_Indices.Insert(m_Indices.End(), indices.Data(), indices.Data() + indices.Size());
+	    m_Vertices.Clear();
+	    m_Vertices.Reserve(vertices.Size());
+	    m_Vertices.Insert(m_Vertices.End(), vertices.Data(), vertices.Data() + vertices.Size());
 	    CalculateMeshBox();
 	    GenerateMeshlets();
     }
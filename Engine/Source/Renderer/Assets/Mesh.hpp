@@ -1,10 +1,12 @@
 #pragma once
 #include <Core.hpp>
 #include <Core/Math/Math.hpp>
+#include <Core/Math/FrustumCulling.hpp>
 #include <Core/Memory/Memory.hpp>
 #include <Core/Containers/Array.hpp>
 #include <Core/Containers/String.hpp>
-#include <Core/Memory/Allocators/BuddyAllocator.hpp>
+#include <Core/Memory/Allocators/LargeBlockAllocator.hpp>
+#include <Core/Memory/Allocators/OffsetAllocator.hpp>
 
 namespace ME::Assets
 {
@@ -26,20 +28,9 @@ namespace ME::Assets
 		}
 	};
 
-	struct alignas(16) BoundingBox
-	{
-		ME::Core::Math::Vector3D32 CenterPosition;
-		uint32 Padding1;
-		ME::Core::Math::Vector3D32 Extents;
-		uint32 Padding2;
-	};
-
-
-	struct alignas(16) BoundingSphere
-	{
-		ME::Core::Math::Vector3D32 CenterPosition;
-		float32 Radius;
-	};
+	// Defined next to the culling code, which tests them against the camera frustum
+	using BoundingBox = ME::Core::Math::BoundingBox;
+	using BoundingSphere = ME::Core::Math::BoundingSphere;
 
 	struct alignas(16) Meshlet
 	{
@@ -69,6 +60,11 @@ namespace ME::Assets
 
 	class MEAPI Mesh
 	{
+	public:
+		// CPU copies of big meshes get their own pages instead of sitting in the heap for the mesh's lifetime
+		using VertexArray = ME::Core::Array<Vertex, ME::Core::Memory::LargeBlockAllocator<Vertex>>;
+		using IndexArray = ME::Core::Array<uint32, ME::Core::Memory::LargeBlockAllocator<uint32>>;
+
 	public: 
 		Mesh();
         explicit Mesh(const ME::Core::String& path);
@@ -83,8 +79,8 @@ namespace ME::Assets
         inline void SetGroupName(const ME::Core::String& groupName) { m_GroupName = groupName; }
 		inline void SetGroupName(ME::Core::String&& groupName) { m_GroupName = groupName; }
 
-        inline ME::Core::Array<Vertex>& GetVertices() { return m_Vertices; }
-		inline ME::Core::Array<uint32>& GetIndices() { return m_Indices; }
+        inline VertexArray& GetVertices() { return m_Vertices; }
+		inline IndexArray& GetIndices() { return m_Indices; }
 		inline ME::Core::Array<Meshlet>& GetMeshlets() { return m_Meshlets; }
 		inline ME::Core::StringView GetGroupName() const { return m_GroupName.ToStringView(); }
 
@@ -130,8 +126,8 @@ namespace ME::Assets
 		ME::Core::String m_GroupName;
 
 	private:
-		ME::Core::Array<Vertex> m_Vertices;
-		ME::Core::Array<uint32> m_Indices;
+		VertexArray m_Vertices;
+		IndexArray m_Indices;
 		ME::Core::Array<Meshlet> m_Meshlets;
 		BoundingBox m_MeshBox;
 		DrawMeshData m_DrawData;
@@ -77,6 +77,8 @@ namespace ME::Render
 	{
 		SIZE_T Size;
 		ME::Render::MemoryType MemoryType;
+		// Lets the buffer be passed to the indirect draws as well
+		bool IndirectDraw = false;
 	};
 
 	struct IndirectBufferSpecification : BufferSpecification
@@ -103,7 +105,7 @@ namespace ME::Render
 		virtual void ChangeSet(uint32 set) = 0;
 
 	    virtual void SetData(void* data, SIZE_T size, SIZE_T offset = 0) = 0;
-		virtual void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset = 0) = 0;
+		virtual void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset = 0) = 0;
 
 		virtual MappedBufferData Map() = 0;
 		virtual void Unmap() = 0;
@@ -111,7 +113,7 @@ namespace ME::Render
 		virtual void Resize(SIZE_T size) = 0;
 
 		virtual void Clear() = 0;	
-		virtual void Clear(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer) = 0;
+		virtual void Clear(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer) = 0;
 
 		virtual inline void UpdateResourceSet(uint32 setIndex) = 0;
 	    virtual inline uint32 GetResourceSet() const = 0;
@@ -137,13 +139,13 @@ namespace ME::Render
 	public:
 		// Overriding every unsupported method
 	    void SetData(void* data, SIZE_T size, SIZE_T offset) final { ME_WARN("SetData() is unsupported in index buffer! Object: \"{}\"", m_DebugName); }
-		void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset) final { ME_WARN("SetData() is unsupported in index buffer! Object: \"{}\"", m_DebugName); }
+		void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset) final { ME_WARN("SetData() is unsupported in index buffer! Object: \"{}\"", m_DebugName); }
 
 	public:
 		virtual SIZE_T GetCount() const = 0;
 
 		virtual void SetData(uint32* indices, SIZE_T indexCount, SIZE_T offset = 0) = 0;
-		virtual void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset = 0) = 0;
+		virtual void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, uint32* indices, SIZE_T indexCount, SIZE_T offset = 0) = 0;
 	};
 
 	// Uniform abstract class
@@ -170,7 +172,7 @@ namespace ME::Render
 		ME_RENDER_OBJECT_TYPE(IndirectBuffer);
 	public:
 		// Do nothing for SetData
-		void SetData(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, void* data, SIZE_T size, SIZE_T offset) final {}
+		void SetData(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, void* data, SIZE_T size, SIZE_T offset) final {}
 		void SetData(void* data, SIZE_T size, SIZE_T offset) final {}
 
 		MappedBufferData Map() final { return MappedBufferData{ .Data = nullptr, .Size = 0 }; }
@@ -117,9 +117,9 @@ namespace ME::Render
 		ME_RENDER_OBJECT_TYPE(Pipeline);
 
 	public:
-		virtual void SetViewports(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications) = 0;
-		virtual void SetScissors(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors) = 0;
-		virtual void SetConstants(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, ShaderStage shaderStage, void* constants,
+		virtual void SetViewports(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Render::ViewportSpecification> specifications) = 0;
+		virtual void SetScissors(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ME::Core::Array<ME::Core::Math::Rect2D> scissors) = 0;
+		virtual void SetConstants(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, ShaderStage shaderStage, void* constants,
 			SIZE_T constantsSize) = 0;
 
 		virtual inline const PipelineSpecification& GetSpecification() const = 0;
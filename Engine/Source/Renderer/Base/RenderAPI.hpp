@@ -35,45 +35,48 @@ namespace ME::Render
 		virtual void NewFrame() = 0;
 		virtual void EndFrame() = 0;
 
-		virtual void Draw(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance) = 0;
-		virtual void DrawIndexed(ME::Core::Memory::Reference<Render::CommandBuffer> buffer, uint32 indexCount, uint32 index) = 0;
-		virtual void DrawIndexedIndirect(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		virtual void Draw(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance) = 0;
+		virtual void DrawIndexed(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer, uint32 indexCount, uint32 index) = 0;
+		virtual void DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset, 
 			uint32 drawCount, uint32 stride) = 0;
-		virtual void DrawIndexedIndirectCount(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer,
+		virtual void DrawIndexedIndirect(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
+			const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, SIZE_T offset,
+			uint32 drawCount, uint32 stride) = 0;
+		virtual void DrawIndexedIndirectCount(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer,
 			PipelineStageFlags bufferSrc,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, SIZE_T offset, 
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& drawCount, uint32 drawCountOffset, 
 			uint32 maxDrawCount, uint32 stride) = 0;
-		virtual void DispatchMesh(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) = 0;
-		virtual void Dispatch(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) = 0;
+		virtual void DispatchMesh(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) = 0;
+		virtual void Dispatch(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) = 0;
 
 		inline virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::Uniform> buffer) = 0;
 		inline virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::StorageBuffer> buffer) = 0;
 		inline virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::VertexBuffer> buffer) = 0;
 		inline virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::IndexBuffer> buffer) = 0;
 		inline virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::IndirectBuffer> buffer) = 0;
-		inline virtual void BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, 
-			ME::Core::Memory::Reference<Render::Pipeline> pipeline, 
+		inline virtual void BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, 
+			const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, 
 			ME::Core::Memory::Reference<ME::Render::Buffer> buffer) = 0;
 
-		inline virtual void BindTexture(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Render::Pipeline> pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set) = 0;
-		inline virtual void BindIndexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, uint32 offset) = 0;
-		inline virtual void BindVertexBuffer(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, uint32 offset) = 0;
+		inline virtual void BindTexture(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set) = 0;
+		inline virtual void BindIndexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, uint32 offset) = 0;
+		inline virtual void BindVertexBuffer(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, uint32 offset) = 0;
 
-		inline virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		inline virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		inline virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		inline virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		inline virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		inline virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		inline virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		inline virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		inline virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		inline virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
 
-	    inline virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
-	    inline virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
-	    inline virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+	    inline virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+	    inline virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+	    inline virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
 
 		virtual void Clear(ME::Core::Math::Vector4D32 color) = 0;
 
-		virtual void Submit(ME::Core::Memory::Reference<Render::CommandBuffer> buffer) = 0;
+		virtual void Submit(const ME::Core::Memory::Reference<Render::CommandBuffer>& buffer) = 0;
 		virtual void Present() = 0;
 
 		virtual inline ME::Core::Memory::Reference<ME::Render::SwapChain> GetSwapChain() = 0;
@@ -83,7 +86,7 @@ namespace ME::Render
 		virtual ME::Core::Memory::Reference<ME::Render::CommandBuffer> GetAvailableCommandBuffer() = 0;
 
 		virtual ME::Core::Memory::Reference<ME::Render::CommandBuffer> GetSingleUseCommandBuffer() = 0;
-		virtual void SubmitAndFreeSingleUseCommandBuffer(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer) = 0;
+		virtual void SubmitAndFreeSingleUseCommandBuffer(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer) = 0;
 
 		virtual void PostInit() = 0;
 		virtual void Resize(uint32 x, uint32 y) = 0;
@@ -1,6 +1,8 @@
 #pragma once
 #include <Core.hpp>
 #include <Core/Containers/Array.hpp>
+#include <Core/Containers/SmallArray.hpp>
+#include <Core/Containers/SlotMap.hpp>
 #include <Core/Containers/String.hpp>
 #include <Core/ClassInterface.hpp>
 
@@ -388,22 +390,49 @@ namespace ME::Render
 		virtual inline constexpr RenderObjectType GetType() const { return RenderObjectType::Unknown; }
 
 		ME::Core::StringView GetDebugName() const { return m_DebugName; }
+		// Slot in the resource tracker, invalid for objects it doesn't keep
+		ME::Core::SlotHandle GetHandle() const { return m_Handle; }
 
 	protected:
 		ME::Core::String m_DebugName;
+
+	private:
+		ME::Core::SlotHandle m_Handle;
+
+		friend class RenderResourceTracker;
+	};
+
+	// Names a render object kept by the resource tracker without holding a reference to it.
+	// Resolving it is a slot lookup, a handle to a removed object resolves to nullptr
+	template<class T>
+	struct RenderHandle
+	{
+		ME::Core::SlotHandle Slot;
+
+		inline bool IsValid() const { return Slot.IsValid(); }
+		inline bool operator==(const RenderHandle& other) const { return Slot == other.Slot; }
 	};
 
+	using PipelineHandle = RenderHandle<Pipeline>;
+	using CommandBufferHandle = RenderHandle<CommandBuffer>;
+	using UniformHandle = RenderHandle<Uniform>;
+	using StorageBufferHandle = RenderHandle<StorageBuffer>;
+	using VertexBufferHandle = RenderHandle<VertexBuffer>;
+	using IndexBufferHandle = RenderHandle<IndexBuffer>;
+	using IndirectBufferHandle = RenderHandle<IndirectBuffer>;
+	using Texture2DHandle = RenderHandle<Texture2D>;
+
 	class MEAPI RenderBindable : public RenderObject
 	{
 	public:
-		virtual void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer) = 0;
+		virtual void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer) = 0;
 	};
 
 	class MEAPI RenderMemoryObject : public RenderObject
 	{
 	public:
-		virtual void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, uint32 offset) = 0;
-		virtual void Bind(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Pipeline> pipeline) = 0;
+		virtual void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, uint32 offset) = 0;
+		virtual void Bind(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Pipeline>& pipeline) = 0;
 
 		virtual void Write() = 0;
 		
@@ -413,7 +442,7 @@ namespace ME::Render
 	    virtual void Write(SIZE_T offset, uint32 binding) = 0;
 		virtual void Write(SIZE_T size, SIZE_T offset, uint32 binding) = 0;
 
-		virtual void Barrier(ME::Core::Memory::Reference<CommandBuffer> commandBuffer, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void Barrier(const ME::Core::Memory::Reference<CommandBuffer>& commandBuffer, BarrierInfo src, BarrierInfo dst) = 0;
 	};
 
 	struct ResourceBinding
@@ -432,7 +461,8 @@ namespace ME::Render
 		}
 	};
 
-	class ResourceLayout : public ME::Core::Array<ME::Render::ResourceBinding>
+	// Sets rarely have more than a handful of bindings, keep them inline
+	class ResourceLayout : public ME::Core::SmallArray<ME::Render::ResourceBinding, 8>
 	{
 	public:
 		bool operator==(const ResourceLayout& layout) const
@@ -74,8 +74,8 @@ namespace ME::Render
 		ME_RENDER_OBJECT_TYPE(RenderPass);
 
 	public:
-		virtual void Begin(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer, RenderPassBeginInfo& beginInfo) = 0;
-		virtual void End(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer) = 0;
+		virtual void Begin(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer, RenderPassBeginInfo& beginInfo) = 0;
+		virtual void End(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer) = 0;
 
 		virtual const RenderPassSpecification& GetSpecification() const = 0;
 
@@ -34,17 +34,17 @@ namespace ME::Render
 		virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::Texture2D> texture) = 0;
 		virtual void WriteResource(ME::Core::Memory::Reference<ME::Render::Texture3D> texture) = 0;
 
-	    virtual void BindResourceSet(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<Render::Pipeline> pipeline, uint32 set, uint32 setIndex) = 0;
+	    virtual void BindResourceSet(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, uint32 set, uint32 setIndex) = 0;
 
-	    virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void BufferBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+	    virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::VertexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::IndexBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void BufferBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Uniform>& buffer, BarrierInfo src, BarrierInfo dst) = 0;
 
-		virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
-		virtual void TextureBarrier(ME::Core::Memory::Reference<Render::CommandBuffer> commandBuffer, const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture1D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture2D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
+		virtual void TextureBarrier(const ME::Core::Memory::Reference<Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<Render::Texture3D>& texture, BarrierInfo src, BarrierInfo dst) = 0;
 
 	public:
 		static ME::Core::Memory::Reference<ME::Render::ResourceHandler> Create(uint32 bufferCount);
@@ -64,8 +64,8 @@ namespace ME::Render
         m_Lights->Write(m_MaxLightCount * sizeof(SpotLight), m_MaxLightCount * sizeof(DirectionalLight) + m_MaxLightCount * sizeof(PointLight), 2);
     }
 
-    void LightManager::Bind(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer,
-        ME::Core::Memory::Reference<ME::Render::Pipeline> pipeline)
+    void LightManager::Bind(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer,
+        const ME::Core::Memory::Reference<ME::Render::Pipeline>& pipeline)
     {
         m_Lights->Bind(commandBuffer, pipeline);
     }
@@ -204,7 +204,7 @@ namespace ME::Render
          * @param commandBuffer CommandBuffer to write
          * @param pipeline Pipeline to use
          */
-        void Bind(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, ME::Core::Memory::Reference<ME::Render::Pipeline> pipeline);
+        void Bind(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, const ME::Core::Memory::Reference<ME::Render::Pipeline>& pipeline);
 
     private:
         void Init();
@@ -2,10 +2,44 @@
 
 #include "Renderer/RenderCommand.hpp"
 
+#include <Core/Memory/Allocators/BuddyAllocator.hpp>
+#include <Core/Memory/Allocators/TLSFAllocator.hpp>
+
+#include <algorithm>
+
 namespace ME::Render::Manager
 {
+    namespace
+    {
+        // Alignment is the element size of the pool, TLSF keeps offsets at whole elements
+        Core::Memory::OffsetAllocatorErrors CreatePoolAllocator(ME::Core::Memory::Scope<Core::Memory::IOffsetAllocator>& allocator,
+            Core::Memory::OffsetAllocatorType type, SIZE_T size, SIZE_T alignment)
+        {
+            if (type == Core::Memory::OffsetAllocatorType::TLSF)
+            {
+                ME::Core::Memory::Scope<Core::Memory::TLSFAllocator> tlsf = ME::Core::Memory::MakeScope<Core::Memory::TLSFAllocator>();
+                const Core::Memory::OffsetAllocatorErrors result = tlsf->Init({ size, alignment });
+                allocator = std::move(tlsf);
+                return result;
+            }
+
+            ME::Core::Memory::Scope<Core::Memory::BuddyAllocator> buddy = ME::Core::Memory::MakeScope<Core::Memory::BuddyAllocator>();
+            const Core::Memory::OffsetAllocatorErrors result = buddy->Init({ ME_MESH_MNG_MIN_SIZE, size });
+            allocator = std::move(buddy);
+            return result;
+        }
+
+        void LogStatistics(const char* name, const Core::Memory::OffsetAllocatorStatistics& statistics)
+        {
+            ME_INFO("{} pool: {} allocations, {} / {} bytes reserved, utilization {:.3f}, fragmentation {:.3f}, {} free blocks, largest {} bytes",
+                name, statistics.AllocationCount, statistics.ReservedSize, statistics.TotalSize, statistics.GetUtilization(),
+                statistics.GetFragmentation(), statistics.FreeBlockCount, statistics.LargestFreeBlock);
+        }
+    }
+
     MeshManager::MeshManager()
-        : m_Meshes(), m_VertexBuffer(nullptr), m_IndexBuffer(nullptr), m_VertexAllocator(nullptr), m_IndexAllocator(nullptr)
+        : m_Meshes(), m_VertexBuffer(nullptr), m_IndexBuffer(nullptr), m_VertexAllocator(nullptr), m_IndexAllocator(nullptr),
+          m_Simulated(false), m_CompactionCursor(0), m_CompactionSweepMoved(false), m_PoolsCompacted(true)
     {
     }
 
@@ -24,44 +58,39 @@ namespace ME::Render::Manager
     void MeshManager::Init(const MeshMemoryPoolInfo& info) noexcept
     {
         m_UsingMeshlets = info.UsingMeshlets;
-
-        Core::Memory::BuddyAllocatorSpecification vertexSpecs = {};
-        vertexSpecs.MinBlockSize = ME_MESH_MNG_MIN_SIZE;
-        vertexSpecs.TotalSize = info.VertexMemoryPoolSize;
-
-        Core::Memory::BuddyAllocatorSpecification indexSpecs = {};
-        indexSpecs.MinBlockSize = ME_MESH_MNG_MIN_SIZE;
-        indexSpecs.TotalSize = info.IndexMemoryPoolSize;
-
-        Core::Memory::BuddyAllocatorSpecification meshletSpecs = {};
-        meshletSpecs.MinBlockSize = ME_MESH_MNG_MIN_SIZE;
-        meshletSpecs.TotalSize = info.MeshletMemoryPoolSize;
+        m_Simulated = info.CPUSimulation;
 
         m_MaxMeshCount = ME_MESH_MNG_MAX_MESH_COUNT;
 
-        m_VertexAllocator = ME::Core::Memory::MakeScope<Core::Memory::BuddyAllocator>();
-        m_IndexAllocator = ME::Core::Memory::MakeScope<Core::Memory::BuddyAllocator>();
-        m_MeshletAllocator = ME::Core::Memory::MakeScope<Core::Memory::BuddyAllocator>();
-
-        Core::Memory::BuddyAllocatorErrors result = m_VertexAllocator->Init(vertexSpecs);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        Core::Memory::OffsetAllocatorErrors result = CreatePoolAllocator(m_VertexAllocator, info.AllocatorType, info.VertexMemoryPoolSize, sizeof(Assets::Vertex));
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
         {
             ME_ASSERT(false, "Vertex allocator creation failed! Error: {}", static_cast<uint32>(result));
             return;
         }
-        result = m_IndexAllocator->Init(indexSpecs);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        result = CreatePoolAllocator(m_IndexAllocator, info.AllocatorType, info.IndexMemoryPoolSize, sizeof(uint32));
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
         {
             ME_ASSERT(false, "Index allocator creation failed! Error: {}", static_cast<uint32>(result));
             return;
         }
-        result = m_MeshletAllocator->Init(meshletSpecs);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        result = CreatePoolAllocator(m_MeshletAllocator, info.AllocatorType, info.MeshletMemoryPoolSize, sizeof(Assets::Meshlet));
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
         {
             ME_ASSERT(false, "Meshlet allocator creation failed! Error: {}", static_cast<uint32>(result));
             return;
         }
 
+        m_MeshBoxes = ME::Core::Array<ME::Assets::BoundingBox>();
+        m_MeshBoxes.Reserve(ME_MESH_MNG_MAX_MESH_COUNT);
+
+        m_DrawData = ME::Core::Array<ME::Assets::DrawMeshData>();
+        m_DrawData.Reserve(ME_MESH_MNG_MAX_MESH_COUNT);
+
+        // Only the pools' bookkeeping runs, nothing exists on the GPU
+        if (m_Simulated)
+            return;
+
         m_SetLayout = ResourceLayout(5);
         m_SetLayout.Clear();
 
@@ -126,12 +155,6 @@ namespace ME::Render::Manager
         m_MeshletBuffer = ME::Render::StorageBuffer::Create(meshletBufferSpecs);
         m_MeshBoxBuffer = ME::Render::StorageBuffer::Create(meshBoxSpecs);
         m_DrawBuffer = ME::Render::StorageBuffer::Create(drawInputSpecs);
-
-        m_MeshBoxes = ME::Core::Array<ME::Assets::BoundingBox>();
-        m_MeshBoxes.Reserve(ME_MESH_MNG_MAX_MESH_COUNT);
-
-        m_DrawData = ME::Core::Array<ME::Assets::DrawMeshData>();
-        m_DrawData.Reserve(ME_MESH_MNG_MAX_MESH_COUNT);
         
         m_MeshBoxBuffer = Render::StorageBuffer::Create(meshBoxSpecs);
         
@@ -140,24 +163,40 @@ namespace ME::Render::Manager
 
     void MeshManager::Shutdown() noexcept
     {
+        if (m_Simulated) return;
         m_VertexBuffer->Shutdown();
         m_IndexBuffer->Shutdown();
     }
 
     void MeshManager::Clear() 
     {
-        m_VertexBuffer->Clear();
-        m_VertexAllocator->Clear();
+        if (!m_Simulated)
+        {
+            m_VertexBuffer->Clear();
+            m_IndexBuffer->Clear();
+        }
 
-        m_IndexBuffer->Clear();
+        m_VertexAllocator->Clear();
         m_IndexAllocator->Clear();
+        m_PoolsCompacted = true;
 
+        // The handles died with the pools
         for (const auto& mesh : m_Meshes)
+        {
+            mesh->SetVertexAllocation(nullptr);
+            mesh->SetIndexAllocation(nullptr);
             mesh->SetLoaded(false);
+        }
     }
 
     void MeshManager::ResizeVertexMemPool(SIZE_T size)
     {
+        if (m_Simulated)
+        {
+            m_VertexAllocator->Resize(size);
+            return;
+        }
+
         if (m_VertexBuffer->GetSpecification().Size <= size) return;
         if (!m_VertexAllocator->Resize(size))
             return;
@@ -171,6 +210,12 @@ namespace ME::Render::Manager
             ME_ASSERT(false, "Can't divide size by size of uint32!");
             return;
         }
+        if (m_Simulated)
+        {
+            m_IndexAllocator->Resize(size);
+            return;
+        }
+
         if (m_IndexBuffer->GetCount() <= size / sizeof(uint32)) return;
         if (!m_IndexAllocator->Resize(size))
             return;
@@ -184,12 +229,26 @@ namespace ME::Render::Manager
             ME_ASSERT(false, "Can't divide size by size of Meshlet!");
             return;
         }
+        if (m_Simulated)
+        {
+            m_MeshletAllocator->Resize(size);
+            return;
+        }
+
         if (m_MeshletBuffer->GetSpecification().Size <= size) return;
         if (!m_MeshletAllocator->Resize(size))
             return;
         m_MeshletBuffer->Resize(size);
     }
 
+    void MeshManager::LogPoolStatistics() const
+    {
+        LogStatistics("Vertex", m_VertexAllocator->GetStatistics());
+        LogStatistics("Index", m_IndexAllocator->GetStatistics());
+        if (m_UsingMeshlets)
+            LogStatistics("Meshlet", m_MeshletAllocator->GetStatistics());
+    }
+
     ME::Core::Memory::Reference<ME::Assets::Mesh> MeshManager::CreateMesh()
     {
         ME::Core::Memory::Reference<ME::Assets::Mesh> mesh = ME::Assets::Mesh::Create();
@@ -229,42 +288,28 @@ namespace ME::Render::Manager
         }
 
         mesh->SetVertexAllocation(vertexAlloc);
-        m_VertexBuffer->SetData(mesh->GetVertices().Data(), vertexAlloc->Size, vertexAlloc->Offset);
-
         mesh->SetIndexAllocation(indexAlloc);
-        m_IndexBuffer->SetData(mesh->GetIndices().Data(), mesh->GetIndices().Size(), indexAlloc->Offset / sizeof(uint32));
-
         mesh->SetMeshletAllocation(meshletAlloc);
-        if (m_UsingMeshlets)
-            m_MeshletBuffer->SetData(mesh->GetMeshlets().Data(), mesh->GetMeshlets().Size() * sizeof(ME::Assets::Meshlet), meshletAlloc->Offset);
-
-        ME::Assets::DrawMeshData drawData = mesh->GetDrawData();
-        drawData.VertexCount = static_cast<uint32>(vertexAlloc->Size / sizeof(ME::Assets::Vertex));
-        drawData.VertexOffset = static_cast<uint32>(vertexAlloc->Offset / sizeof(ME::Assets::Vertex));
-        drawData.IndexCount = static_cast<uint32>(indexAlloc->Size / sizeof(uint32));
-        drawData.IndexOffset = static_cast<uint32>(indexAlloc->Offset / sizeof(uint32));
 
-        if (m_UsingMeshlets)
+        if (!m_Simulated)
         {
-            drawData.MeshletCount = static_cast<uint32>(meshletAlloc->Size / sizeof(ME::Assets::Meshlet));
-            drawData.MeshletOffset = static_cast<uint32>(meshletAlloc->Offset / sizeof(ME::Assets::Meshlet));
-        }
-        else
-        {
-            drawData.MeshletCount = 0;
-            drawData.MeshletOffset = 0;
+            m_VertexBuffer->SetData(mesh->GetVertices().Data(), vertexAlloc->Size, vertexAlloc->Offset);
+            m_IndexBuffer->SetData(mesh->GetIndices().Data(), mesh->GetIndices().Size(), indexAlloc->Offset / sizeof(uint32));
+            if (m_UsingMeshlets)
+                m_MeshletBuffer->SetData(mesh->GetMeshlets().Data(), mesh->GetMeshlets().Size() * sizeof(ME::Assets::Meshlet), meshletAlloc->Offset);
         }
 
-        mesh->SetDrawData(drawData);
-
-        SIZE_T drawOffset = meshId * sizeof(ME::Assets::DrawMeshData);
-        m_DrawData[meshId] = drawData;
-        m_DrawBuffer->SetData(&drawData, sizeof(ME::Assets::DrawMeshData), drawOffset);
+        WriteDrawData(meshId);
 
         ME::Assets::BoundingBox meshBox = mesh->GetMeshBox();
-        SIZE_T meshBoxOffset = meshId * sizeof(ME::Assets::BoundingBox);
+        if (m_MeshBoxes.Size() <= meshId)
+            m_MeshBoxes.Resize(meshId + 1);
         m_MeshBoxes[meshId] = meshBox;
-        m_MeshBoxBuffer->SetData(&meshBox, sizeof(ME::Assets::BoundingBox), meshBoxOffset);
+        if (!m_Simulated)
+        {
+            SIZE_T meshBoxOffset = meshId * sizeof(ME::Assets::BoundingBox);
+            m_MeshBoxBuffer->SetData(&meshBox, sizeof(ME::Assets::BoundingBox), meshBoxOffset);
+        }
 
         return true;
     }
@@ -299,13 +344,149 @@ namespace ME::Render::Manager
         mesh->SetMeshletAllocation(nullptr);
 
         mesh->SetLoaded(false);
+
+        // The hole may let other meshes move down, the next sweeps will look
+        m_PoolsCompacted = false;
+        m_CompactionSweepMoved = true;
+    }
+
+    SIZE_T MeshManager::CompactPools(SIZE_T byteBudget)
+    {
+        if (m_PoolsCompacted || m_Meshes.Empty())
+            return 0;
+
+        SIZE_T movedBytes = 0;
+        bool gpuIdle = m_Simulated;
+        uint64 firstMoved = m_Meshes.Size();
+        uint64 lastMoved = 0;
+        for (SIZE_T visited = 0; visited < m_Meshes.Size() && movedBytes < byteBudget; ++visited)
+        {
+            if (m_CompactionCursor >= m_Meshes.Size())
+            {
+                m_CompactionCursor = 0;
+                // A whole sweep without a move, nothing can get lower until a mesh is unloaded
+                if (!m_CompactionSweepMoved)
+                {
+                    m_PoolsCompacted = true;
+                    break;
+                }
+                m_CompactionSweepMoved = false;
+            }
+
+            const ME::Core::Memory::Reference<ME::Assets::Mesh>& mesh = m_Meshes[m_CompactionCursor];
+            if (!mesh->GetVertexAllocation() || !mesh->GetIndexAllocation())
+            {
+                m_CompactionCursor++;
+                continue;
+            }
+
+            // The first mesh of a call always goes, otherwise meshes bigger than the budget would never move.
+            // The rest waits for the next call at the cursor
+            const SIZE_T meshBytes = mesh->GetVertexAllocation()->Size + mesh->GetIndexAllocation()->Size;
+            if (movedBytes != 0 && movedBytes + meshBytes > byteBudget)
+                break;
+
+            // The new range may overlap the old one or a range freed a frame ago, none of them may be in use
+            if (!gpuIdle)
+            {
+                Render::RenderCommand::YieldUntilIdle();
+                gpuIdle = true;
+            }
+
+            const SIZE_T meshMovedBytes = RelocateMesh(m_CompactionCursor);
+            if (meshMovedBytes != 0)
+            {
+                firstMoved = std::min(firstMoved, m_CompactionCursor);
+                lastMoved = std::max(lastMoved, m_CompactionCursor);
+                movedBytes += meshMovedBytes;
+            }
+            m_CompactionCursor++;
+        }
+
+        // One upload for the draw data of every mesh that moved
+        if (!m_Simulated && movedBytes != 0)
+        {
+            const SIZE_T drawCount = lastMoved - firstMoved + 1;
+            m_DrawBuffer->SetData(m_DrawData.Data() + firstMoved, drawCount * sizeof(ME::Assets::DrawMeshData),
+                firstMoved * sizeof(ME::Assets::DrawMeshData));
+        }
+
+        return movedBytes;
+    }
+
+    SIZE_T MeshManager::RelocateMesh(uint64 meshId)
+    {
+        ME::Core::Memory::Reference<ME::Assets::Mesh>& mesh = m_Meshes[meshId];
+        Core::Memory::OAllocation vertexAlloc = mesh->GetVertexAllocation();
+        Core::Memory::OAllocation indexAlloc = mesh->GetIndexAllocation();
+
+        // Ranges may overlap their old place, so the data comes again from the mesh's own copy instead of the buffer
+        SIZE_T movedBytes = 0;
+        if (m_VertexAllocator->Relocate(vertexAlloc))
+        {
+            if (!m_Simulated)
+                m_VertexBuffer->SetData(mesh->GetVertices().Data(), vertexAlloc->Size, vertexAlloc->Offset);
+            mesh->SetVertexAllocation(vertexAlloc);
+            movedBytes += vertexAlloc->Size;
+        }
+
+        if (m_IndexAllocator->Relocate(indexAlloc))
+        {
+            if (!m_Simulated)
+                m_IndexBuffer->SetData(mesh->GetIndices().Data(), mesh->GetIndices().Size(), indexAlloc->Offset / sizeof(uint32));
+            mesh->SetIndexAllocation(indexAlloc);
+            movedBytes += indexAlloc->Size;
+        }
+
+        if (movedBytes == 0)
+            return 0;
+
+        WriteDrawData(meshId, false);
+        m_CompactionSweepMoved = true;
+        return movedBytes;
+    }
+
+    void MeshManager::WriteDrawData(uint64 meshId, bool upload)
+    {
+        ME::Core::Memory::Reference<ME::Assets::Mesh>& mesh = m_Meshes[meshId];
+        Core::Memory::OAllocation vertexAlloc = mesh->GetVertexAllocation();
+        Core::Memory::OAllocation indexAlloc = mesh->GetIndexAllocation();
+        Core::Memory::OAllocation meshletAlloc = mesh->GetMeshletAllocation();
+
+        ME::Assets::DrawMeshData drawData = mesh->GetDrawData();
+        drawData.VertexCount = static_cast<uint32>(vertexAlloc->Size / sizeof(ME::Assets::Vertex));
+        drawData.VertexOffset = static_cast<uint32>(vertexAlloc->Offset / sizeof(ME::Assets::Vertex));
+        drawData.IndexCount = static_cast<uint32>(indexAlloc->Size / sizeof(uint32));
+        drawData.IndexOffset = static_cast<uint32>(indexAlloc->Offset / sizeof(uint32));
+
+        if (m_UsingMeshlets)
+        {
+            drawData.MeshletCount = static_cast<uint32>(meshletAlloc->Size / sizeof(ME::Assets::Meshlet));
+            drawData.MeshletOffset = static_cast<uint32>(meshletAlloc->Offset / sizeof(ME::Assets::Meshlet));
+        }
+        else
+        {
+            drawData.MeshletCount = 0;
+            drawData.MeshletOffset = 0;
+        }
+
+        mesh->SetDrawData(drawData);
+
+        if (m_DrawData.Size() <= meshId)
+            m_DrawData.Resize(meshId + 1);
+        m_DrawData[meshId] = drawData;
+        if (upload && !m_Simulated)
+        {
+            SIZE_T drawOffset = meshId * sizeof(ME::Assets::DrawMeshData);
+            m_DrawBuffer->SetData(&drawData, sizeof(ME::Assets::DrawMeshData), drawOffset);
+        }
     }
 
     ME::Core::Memory::OAllocation MeshManager::VertexMalloc(SIZE_T size) 
     {
         Core::Memory::OAllocation alloc = nullptr;
-        Core::Memory::BuddyAllocatorErrors result = m_VertexAllocator->Allocate(alloc, size);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        Core::Memory::OffsetAllocatorErrors result = m_VertexAllocator->Allocate(alloc, size);
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
         {
             ME_ERROR("Can't allocate memory in vertex buffer! Error: {}", static_cast<uint32>(result));
             return nullptr;
@@ -321,8 +502,8 @@ namespace ME::Render::Manager
     ME::Core::Memory::OAllocation MeshManager::IndexMalloc(SIZE_T size) 
     {
         Core::Memory::OAllocation alloc = nullptr;
-        Core::Memory::BuddyAllocatorErrors result = m_IndexAllocator->Allocate(alloc, size);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        Core::Memory::OffsetAllocatorErrors result = m_IndexAllocator->Allocate(alloc, size);
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
         {
             ME_ERROR("Can't allocate memory in index buffer! Error: {}", static_cast<uint32>(result));
             return nullptr;
@@ -338,8 +519,8 @@ namespace ME::Render::Manager
     ME::Core::Memory::OAllocation MeshManager::MeshletMalloc(SIZE_T size)
     {
         Core::Memory::OAllocation alloc = nullptr;
-        Core::Memory::BuddyAllocatorErrors result = m_MeshletAllocator->Allocate(alloc, size);
-        if (result != Core::Memory::BuddyAllocatorErrors::Success)
+        Core::Memory::OffsetAllocatorErrors result = m_MeshletAllocator->Allocate(alloc, size);
+        if (result != Core::Memory::OffsetAllocatorErrors::Success)
             ME_WARN("Can't allocate memory in meshlet buffer! Error: {}", static_cast<uint32>(result));
         return alloc;
     }
@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include <Core.hpp>
 #include <Core/Containers/Map.hpp>
-#include <Core/Memory/Allocators/BuddyAllocator.hpp>
+#include <Core/Memory/Allocators/OffsetAllocator.hpp>
 
 #include "Renderer/Base/Buffer.hpp"
 #include "Renderer/Assets/Mesh.hpp"
@@ -10,6 +10,8 @@ constexpr SIZE_T ME_MESH_MNG_VERT_BUFFER_SIZE           = ME_MB(BIT(8)); // 256
 constexpr SIZE_T ME_MESH_MNG_IND_BUFFER_SIZE            = ME_MB(BIT(7)); // 128 MB
 constexpr SIZE_T ME_MESH_MNG_MESHLET_BUFFER_SIZE        = ME_MB(BIT(7)); // 128 MB
 constexpr SIZE_T ME_MESH_MNG_MIN_SIZE                   = ME_KB(BIT(8)); // 256 KB
+constexpr SIZE_T ME_MESH_MNG_COMPACTION_BUDGET          = ME_MB(BIT(2)); // 4 MB re-uploaded per compaction at most
+constexpr uint32 ME_MESH_MNG_COMPACTION_INTERVAL        = 32;            // Frames between two compactions, each one waits for the GPU
 constexpr uint32 ME_MESH_MNG_MAX_MESH_COUNT             = 0xffff;
 constexpr uint32 ME_MESH_MNG_MAX_MESH_BOX_COUNT         = 0xffff;
 constexpr uint32 ME_MESH_MNG_MESHLET_MAX_VERTEX_COUNT   = 64;
@@ -29,6 +31,10 @@ namespace ME::Render::Manager
         SIZE_T MeshletMemoryPoolSize;
         Render::ResourceBinding BindingInfo;
         bool UsingMeshlets = false;
+        // Buddy pools round every mesh up to a power of two of ME_MESH_MNG_MIN_SIZE, TLSF pools fit them exactly
+        ME::Core::Memory::OffsetAllocatorType AllocatorType = ME::Core::Memory::OffsetAllocatorType::Buddy;
+        // No GPU resources are created or written, only the pools' bookkeeping and the CPU side draw data run
+        bool CPUSimulation = false;
     };
 
     class MEAPI MeshManager
@@ -60,16 +66,21 @@ namespace ME::Render::Manager
         void ResizeIndexMemPool(SIZE_T size);
         void ResizeMeshletMemPool(SIZE_T size);
 
-        ME::Core::Memory::Reference<ME::Render::VertexBuffer> GetVertexBuffer() const { return m_VertexBuffer; }
-        ME::Core::Memory::Reference<ME::Render::IndexBuffer> GetIndexBuffer() const { return m_IndexBuffer; }
-        ME::Core::Memory::Reference<ME::Render::StorageBuffer> GetMeshletBuffer() const { return m_MeshletBuffer; }
-        ME::Core::Memory::Reference<ME::Render::StorageBuffer> GetDrawBuffer() const { return m_DrawBuffer; }
-        ME::Core::Memory::Reference<ME::Render::StorageBuffer> GetMeshBoxBuffer() const { return m_MeshBoxBuffer; }
+        const ME::Core::Memory::Reference<ME::Render::VertexBuffer>& GetVertexBuffer() const { return m_VertexBuffer; }
+        const ME::Core::Memory::Reference<ME::Render::IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
+        const ME::Core::Memory::Reference<ME::Render::StorageBuffer>& GetMeshletBuffer() const { return m_MeshletBuffer; }
+        const ME::Core::Memory::Reference<ME::Render::StorageBuffer>& GetDrawBuffer() const { return m_DrawBuffer; }
+        const ME::Core::Memory::Reference<ME::Render::StorageBuffer>& GetMeshBoxBuffer() const { return m_MeshBoxBuffer; }
 
         ME::Core::Array<ME::Assets::DrawMeshData>& GetDrawBufferData() { return m_DrawData; }
         ME::Core::Array<ME::Assets::BoundingBox> GetMeshBoxBufferData() { return m_MeshBoxes; }
         SIZE_T GetMeshCount() const { return m_Meshes.Size(); }
 
+        ME::Core::Memory::OffsetAllocatorStatistics GetVertexPoolStatistics() const { return m_VertexAllocator->GetStatistics(); }
+        ME::Core::Memory::OffsetAllocatorStatistics GetIndexPoolStatistics() const { return m_IndexAllocator->GetStatistics(); }
+        ME::Core::Memory::OffsetAllocatorStatistics GetMeshletPoolStatistics() const { return m_MeshletAllocator->GetStatistics(); }
+        void LogPoolStatistics() const;
+
         Render::ResourceLayout GetSetLayout() const { return m_SetLayout; }
 
     public:
@@ -78,6 +89,12 @@ namespace ME::Render::Manager
         bool LoadMesh(uint64 meshId);
         void UnloadMesh(uint64 meshId);
 
+        // Moves loaded meshes toward the front of the vertex and index pools, spending about byteBudget bytes of uploads.
+        // Picks up where the previous call stopped and does nothing once a whole sweep couldn't move anything.
+        // Frames in flight still read the old ranges, so the GPU is waited for before the first move of a call and
+        // the caller shouldn't run it every frame. Returns the bytes moved
+        SIZE_T CompactPools(SIZE_T byteBudget = ME_MESH_MNG_COMPACTION_BUDGET);
+
     private:
         ME::Core::Memory::OAllocation VertexMalloc(SIZE_T size);
         void VertexFree(ME::Core::Memory::OAllocation& alloc);
@@ -86,6 +103,9 @@ namespace ME::Render::Manager
         ME::Core::Memory::OAllocation MeshletMalloc(SIZE_T size);
         void MeshletFree(ME::Core::Memory::OAllocation& alloc);
 
+        SIZE_T RelocateMesh(uint64 meshId);
+        void WriteDrawData(uint64 meshId, bool upload = true);
+
     private:
         ME::Core::Array<ME::Core::Memory::Reference<ME::Assets::Mesh>> m_Meshes;
         ME::Core::Array<ME::Assets::BoundingBox> m_MeshBoxes;
@@ -97,13 +117,19 @@ namespace ME::Render::Manager
         ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_MeshletBuffer;
         ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_DrawBuffer;
         ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_MeshBoxBuffer;
-        ME::Core::Memory::Scope<ME::Core::Memory::BuddyAllocator> m_VertexAllocator;
-        ME::Core::Memory::Scope<ME::Core::Memory::BuddyAllocator> m_IndexAllocator;
-        ME::Core::Memory::Scope<ME::Core::Memory::BuddyAllocator> m_MeshletAllocator;
+        ME::Core::Memory::Scope<ME::Core::Memory::IOffsetAllocator> m_VertexAllocator;
+        ME::Core::Memory::Scope<ME::Core::Memory::IOffsetAllocator> m_IndexAllocator;
+        ME::Core::Memory::Scope<ME::Core::Memory::IOffsetAllocator> m_MeshletAllocator;
 
     private:
         Render::ResourceLayout m_SetLayout;
         bool m_UsingMeshlets;
+        bool m_Simulated;
+
+        // Next mesh the compaction looks at, if the current sweep moved anything and if the last one moved nothing
+        uint64 m_CompactionCursor;
+        bool m_CompactionSweepMoved;
+        bool m_PoolsCompacted;
 
         SIZE_T m_MaxMeshCount;
     };
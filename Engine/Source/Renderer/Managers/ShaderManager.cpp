@@ -142,7 +142,7 @@ namespace ME::Render::Manager
 	ME::Core::Memory::Reference<ME::Render::Shader> ShaderManager::LoadShader(
 		const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, 
 		const ME::Render::ShaderStage& shaderStage,
-		const ME::Core::Array<ME::Core::String>& defines) const
+		const ShaderDefines& defines) const
 	{
 		bool result = ME::Core::IO::PFileExists(
 			(m_CompiledShaderPath + TEXT("/") + shaderName).String());
@@ -156,7 +156,7 @@ namespace ME::Render::Manager
 	ME::Core::Memory::Reference<ME::Render::Shader> ShaderManager::LoadCompiledShader(
 		const ME::Core::StringView& shaderName, 
 		const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage,
-		const ME::Core::Array<ME::Core::String>& defines) const
+		const ShaderDefines& defines) const
 	{
 		Render::CompiledShader compiledShader{ .Bytecode = nullptr, .Size = 0 };
 
@@ -186,7 +186,7 @@ namespace ME::Render::Manager
 	ME::Core::Memory::Reference<ME::Render::Shader> ShaderManager::CompileShader(const ME::Core::StringView& shaderName, 
 		const Render::ResourceLayoutPack& layouts, 
 		const ME::Render::ShaderStage& shaderStage, 
-		const ME::Core::Array<ME::Core::String>& defines) const
+		const ShaderDefines& defines) const
 	{
 		Utility::CompilationResult result;
 		Utility::ShaderCompilationSpecification specs = {};
@@ -293,7 +293,7 @@ namespace ME::Render::Manager
 	}
 
     ME::Core::Array<ME::Core::WideString> ShaderManager::ConvertDefines(
-        const ME::Core::Array<ME::Core::String>& defines) const
+        const ShaderDefines& defines) const
     {
 		ME::Core::Array<ME::Core::WideString> newDefines;
 
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include <Core.hpp>
+#include <Core/Containers/SmallArray.hpp>
 #include <Core/Containers/String.hpp>
 #include <Core/Containers/UnorderedMap.hpp>
 
@@ -48,6 +49,8 @@ namespace ME::Render::Manager
 		ME::Core::String Mesh;
 	};
 
+	using ShaderDefines = ME::Core::SmallArray<ME::Core::String, 4>;
+
 	struct ShaderGroupSpecification
 	{
 		ShaderGroupType Type;
@@ -57,7 +60,7 @@ namespace ME::Render::Manager
 		ME::Core::String Pixel;
 		Render::ResourceLayoutPack Layout;
 		ME::Core::String ShaderGroupName;
-		ME::Core::Array<ME::Core::String> Defines = {};
+		ShaderDefines Defines = {};
 	};
 
 	class MEAPI ShaderManager
@@ -128,12 +131,12 @@ namespace ME::Render::Manager
 		bool LoadComputeShader(const ShaderGroupSpecification& specification);
 
 	private:
-		ME::Core::Memory::Reference<ME::Render::Shader> LoadShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ME::Core::Array<ME::Core::String>& defines) const;
-		ME::Core::Memory::Reference<ME::Render::Shader> LoadCompiledShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ME::Core::Array<ME::Core::String>& defines) const;
-		ME::Core::Memory::Reference<ME::Render::Shader> CompileShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ME::Core::Array<ME::Core::String>& defines) const;
+		ME::Core::Memory::Reference<ME::Render::Shader> LoadShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ShaderDefines& defines) const;
+		ME::Core::Memory::Reference<ME::Render::Shader> LoadCompiledShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ShaderDefines& defines) const;
+		ME::Core::Memory::Reference<ME::Render::Shader> CompileShader(const ME::Core::StringView& shaderName, const Render::ResourceLayoutPack& layouts, const ME::Render::ShaderStage& shaderStage, const ShaderDefines& defines) const;
 
 	private:
-		ME::Core::Array<ME::Core::WideString> ConvertDefines(const ME::Core::Array<ME::Core::String>& defines) const;
+		ME::Core::Array<ME::Core::WideString> ConvertDefines(const ShaderDefines& defines) const;
 
 	private:
 		ME::Core::UnorderedMap<ME::Core::String, ShaderGroup> m_Shaders;
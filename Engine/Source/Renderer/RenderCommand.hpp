@@ -9,14 +9,14 @@
 #include "Managers/LightManager.hpp"
 
 #define CmdBufFunction(name, ...)																				\
-    inline static void name(ME::Core::Memory::Reference<ME::Render::CommandBuffer> commandBuffer, __VA_ARGS__)
+    inline static void name(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& commandBuffer, __VA_ARGS__)
 #define CmdBufFunctionImpl(name, ...)						\
     {														\
         s_Renderer->name(commandBuffer, __VA_ARGS__);		\
     }
 
 #define CmdBuffFunctionNA(name)																		\
-    inline static void name(ME::Core::Memory::Reference<ME::Render::CommandBuffer> buffer)			\
+    inline static void name(const ME::Core::Memory::Reference<ME::Render::CommandBuffer>& buffer)			\
     {																								\
         s_Renderer->name(buffer);																	\
     }
@@ -30,13 +30,39 @@ namespace ME::Render
 		static void Shutdown();
 
     public:
-		static void RenderObjectCreated(ME::Core::Memory::Reference<RenderObject> object)
+		static void RenderObjectCreated(const ME::Core::Memory::Reference<RenderObject>& object)
 		{
 			s_ResourceTracker.Add(object);
 		}
 
+		template<class T>
+		inline static RenderHandle<T> GetHandle(const ME::Core::Memory::Reference<T>& object)
+		{
+			return RenderHandle<T>{ object ? object->GetHandle() : ME::Core::SlotHandle() };
+		}
+
+		// nullptr once the object was released
+		template<class T>
+		inline static T* Resolve(RenderHandle<T> handle)
+		{
+			return s_ResourceTracker.Resolve(handle);
+		}
+
+		template<class T>
+		inline static bool IsAlive(RenderHandle<T> handle)
+		{
+			return s_ResourceTracker.Contains(handle.Slot);
+		}
+
+		// Stops tracking the object, it's destroyed once nothing else references it
+		template<class T>
+		inline static bool ReleaseObject(RenderHandle<T> handle)
+		{
+			return s_ResourceTracker.Remove(handle.Slot);
+		}
+
 	public:
-		static ME::Core::Memory::Reference<RenderAPI> Get()
+		static const ME::Core::Memory::Reference<RenderAPI>& Get()
 		{
 		    return s_Renderer;
 		}
@@ -72,6 +98,12 @@ namespace ME::Render
 			s_Renderer->Present();
 		}
 
+		// Blocks until the GPU finished everything submitted, frames in flight included
+		inline static void YieldUntilIdle()
+		{
+			s_Renderer->YieldUntilIdle();
+		}
+
 		inline static void WriteResource(const ME::Core::Memory::Reference<ME::Render::Uniform>& buffer)
 		{
 			s_Renderer->WriteResource(buffer);
@@ -130,10 +162,10 @@ namespace ME::Render
 		}
 
 	public:
-		CmdBufFunction(BindResourceSet, ME::Core::Memory::Reference<Render::Pipeline> pipeline, ME::Core::Memory::Reference<ME::Render::Buffer> buffer)
+		CmdBufFunction(BindResourceSet, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, ME::Core::Memory::Reference<ME::Render::Buffer> buffer)
 		CmdBufFunctionImpl(BindResourceSet, pipeline, buffer)
 
-		CmdBufFunction(BindTexture, ME::Core::Memory::Reference<Render::Pipeline> pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set)
+		CmdBufFunction(BindTexture, const ME::Core::Memory::Reference<Render::Pipeline>& pipeline, ME::Core::Memory::Reference<ME::Render::Texture2D> texture, uint32 set)
 		CmdBufFunctionImpl(BindTexture, pipeline, texture, set)
 
 		CmdBufFunction(Draw, uint32 vertexCount, uint32 instanceCount, uint32 firstVertex, uint32 firstInstance)
@@ -145,6 +177,9 @@ namespace ME::Render
 		CmdBufFunction(DrawIndexedIndirect, const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, uint32 offset, uint32 drawCount, uint32 stride)
 		CmdBufFunctionImpl(DrawIndexedIndirect, buffer, offset, drawCount, stride)
 
+		CmdBufFunction(DrawIndexedIndirect, const ME::Core::Memory::Reference<Render::StorageBuffer>& buffer, uint32 offset, uint32 drawCount, uint32 stride)
+		CmdBufFunctionImpl(DrawIndexedIndirect, buffer, offset, drawCount, stride)
+
 		CmdBufFunction(DrawIndexedIndirectCount, PipelineStageFlags bufferSrc,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& buffer, uint32 offset,
 			const ME::Core::Memory::Reference<Render::IndirectBuffer>& countBuffer, uint32 countOffset,
@@ -4,31 +4,26 @@
 namespace ME::Render
 {
     RenderResourceTracker::RenderResourceTracker()
-        : m_Phase1Objects({}), m_Phase2Objects({}), m_Phase3Objects({}), m_TotalObjectCount(0) {}
+        : m_Objects(), m_TotalObjectCount(0) {}
 
     RenderResourceTracker::~RenderResourceTracker()
     {
         if (m_TotalObjectCount > 0) ShutdownAll();
     }
 
-    inline void RenderResourceTracker::Add(const ME::Core::Memory::Reference<RenderObject>& object)
+    uint32 RenderResourceTracker::GetShutdownPhase(RenderObjectType type)
     {
-        switch (object->GetType())
+        switch (type)
         {
             // Phase 3 objects
         case RenderObjectType::RenderPass:
-        {
-            m_Phase3Objects.EmplaceBack(object);
-            break;
-        }
+            return 3;
 
         // Phase 2 objects
         case RenderObjectType::Framebuffer:
         case RenderObjectType::Shader:
-        {
-            m_Phase2Objects.EmplaceBack(object);
-            break;
-        }
+            return 2;
+
         // Phase 1 objects
         case RenderObjectType::Pipeline:
         case RenderObjectType::CommandBuffer:
@@ -40,31 +35,48 @@ namespace ME::Render
         case RenderObjectType::Texture1D:
         case RenderObjectType::Texture2D:
         case RenderObjectType::Texture3D:
-        {
-            m_Phase1Objects.EmplaceBack(object);
-            break;
-        }
+            return 1;
+
         default:
-            break;
+            return 0;
         }
     }
 
+    ME::Core::SlotHandle RenderResourceTracker::Add(const ME::Core::Memory::Reference<RenderObject>& object)
+    {
+        if (GetShutdownPhase(object->GetType()) == 0)
+            return {};
+
+        object->m_Handle = m_Objects.Insert(object);
+        ++m_TotalObjectCount;
+        return object->m_Handle;
+    }
+
+    bool RenderResourceTracker::Remove(ME::Core::SlotHandle handle)
+    {
+        ME::Core::Memory::Reference<RenderObject>* object = m_Objects.Find(handle);
+        if (!object)
+            return false;
+
+        (*object)->m_Handle = {};
+        m_Objects.Erase(handle);
+        --m_TotalObjectCount;
+        return true;
+    }
+
     void RenderResourceTracker::ShutdownAll()
     {
-        for (auto& object : m_Phase1Objects)
+        // Objects stay referenced, their destructors run at exit after the API is gone
+        for (uint32 phase = 1; phase <= 3; phase++)
         {
-            object->Shutdown();
-            --m_TotalObjectCount;
-        }
-        for (auto& object : m_Phase2Objects)
-        {
-            object->Shutdown();
-            --m_TotalObjectCount;
-        }
-        for (auto& object : m_Phase3Objects)
-        {
-            object->Shutdown();
-            --m_TotalObjectCount;
+            for (auto& object : m_Objects)
+            {
+                if (GetShutdownPhase(object->GetType()) != phase)
+                    continue;
+
+                object->Shutdown();
+                --m_TotalObjectCount;
+            }
         }
     }
 }
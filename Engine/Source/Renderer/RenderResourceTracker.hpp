@@ -1,12 +1,13 @@
 ﻿#pragma once
 #include <Core.hpp>
 #include <Core/Memory/Memory.hpp>
-#include <Core/Containers/Array.hpp>
+#include <Core/Containers/SlotMap.hpp>
 
 #include "Base/RenderCore.hpp"
 
 namespace ME::Render
 {
+	// Keeps every render object alive until shutdown and hands out handles to them
 	class MEAPI RenderResourceTracker
 	{
 	public:
@@ -14,16 +15,28 @@ namespace ME::Render
 		~RenderResourceTracker();
 
 	public:
-		void Add(const ME::Core::Memory::Reference<RenderObject>& object);
+		ME::Core::SlotHandle Add(const ME::Core::Memory::Reference<RenderObject>& object);
+		// Drops the tracker's reference, the handle and its copies stop resolving
+		bool Remove(ME::Core::SlotHandle handle);
 		void ShutdownAll();
 
+		template<class T>
+		inline T* Resolve(RenderHandle<T> handle) const
+		{
+			const ME::Core::Memory::Reference<RenderObject>* object = m_Objects.Find(handle.Slot);
+			return object ? static_cast<T*>(object->get()) : nullptr;
+		}
+
+		inline bool Contains(ME::Core::SlotHandle handle) const { return m_Objects.Contains(handle); }
+
 	private:
+		// Objects are shut down in phases, ones used by others go last
+		static uint32 GetShutdownPhase(RenderObjectType type);
+
 		// TODO: SavePipelines()
 
 	private:
-		ME::Core::Array<ME::Core::Memory::Reference<RenderObject>> m_Phase1Objects;
-		ME::Core::Array<ME::Core::Memory::Reference<RenderObject>> m_Phase2Objects;
-		ME::Core::Array<ME::Core::Memory::Reference<RenderObject>> m_Phase3Objects;
+		ME::Core::SlotMap<ME::Core::Memory::Reference<RenderObject>> m_Objects;
 		ME::Core::Atomic_uint64 m_TotalObjectCount;
 	};
 }
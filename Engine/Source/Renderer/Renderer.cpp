@@ -8,7 +8,6 @@
 #include "Renderer/Base/RenderPass.hpp"
 #include "Managers/MeshManager.hpp"
 
-constexpr char8 FRUSTUM_CULLING_SHADER[] = TEXT("Frustum_Culling");
 constexpr char8 MERGE_SHADERS[] = TEXT("MergeStageSH");
 
 namespace ME::Render
@@ -17,7 +16,8 @@ namespace ME::Render
     :	m_GeometryPipeline(nullptr),
 		m_GPass(nullptr),
 		m_MeshTransforms(nullptr),
-		m_QueuedMeshes(ME::Core::UnorderedMap<uint64, MeshInfos>())
+		m_QueuedMeshes(QueuedMeshMap()),
+		m_FramesSinceCompaction(0)
     {
     }
 
@@ -75,22 +75,6 @@ namespace ME::Render
 			Render::ShaderStage::Mesh |
 			Render::ShaderStage::Compute
 		);
-		// OutputArray | Binding 1
-		frustumCullingSetLayout.EmplaceBack(
-			Render::ResourceType::StorageBuffer,
-			Render::ShaderStage::Vertex |
-			Render::ShaderStage::Task |
-			Render::ShaderStage::Mesh |
-			Render::ShaderStage::Compute
-		);
-		// OutputCount | Binding 2
-		frustumCullingSetLayout.EmplaceBack(
-			Render::ResourceType::StorageBuffer,
-			Render::ShaderStage::Vertex |
-			Render::ShaderStage::Task |
-			Render::ShaderStage::Mesh |
-			Render::ShaderStage::Compute
-		);
 
 		// Set 4
 		Render::ResourceLayout gBufferSet;
@@ -286,17 +270,6 @@ namespace ME::Render
 			Manager::ShaderManager::GetShaderGroup(ME_RENDER_LIGHT_PIPELINE_NAME);
 		Manager::ShaderManager::ShaderGroup mergeShaderGroup =
 			Manager::ShaderManager::GetShaderGroup(ME_RENDER_MERGE_PIPELINE_NAME);
-		Manager::ShaderManager::ComputeShaderGroup frustumCullingShaderGroup;
-
-		ME::Render::Manager::ShaderGroupSpecification frustumCullShader = {};
-		frustumCullShader.Type = Manager::ShaderGroupType::Compute;
-		frustumCullShader.Layout = primaryShaderGroup.ResourceLayout;
-		frustumCullShader.Compute = TEXT("Deffered/FrustumCulling.hlsl");
-		frustumCullShader.ShaderGroupName = FRUSTUM_CULLING_SHADER;
-		frustumCullShader.Defines = {};
-
-		ME::Render::Manager::ShaderManager::Get().LoadShaders(frustumCullShader);
-		frustumCullingShaderGroup = Manager::ShaderManager::GetComputeShaderGroup(FRUSTUM_CULLING_SHADER);
 
 #pragma region Buffers
 		int32 frameSetId = RenderCommand::GetResourceHandler()->CreateResourceSet(mergeShaderGroup.ResourceLayout[FRAME_SET]);
@@ -514,9 +487,9 @@ namespace ME::Render
 		meshIDsBufferSpec.SetIndex = meshInfoSet;
 		m_MeshIDs = RStorageBuffer::Create(meshIDsBufferSpec);
 
-		uint32 frustumCullingSet = RenderCommand::GetResourceHandler()->CreateResourceSet(frustumCullingShaderGroup.ResourceLayout[FRUSTUM_CULLING_SET]);
+		uint32 frustumCullingSet = RenderCommand::GetResourceHandler()->CreateResourceSet(primaryShaderGroup.ResourceLayout[FRUSTUM_CULLING_SET]);
 
-		// Set 3 Binding 0 - Frustum culling input
+		// Set 3 Binding 0 - Draws that survived the CPU culling, the G-Pass draws straight from it
 		StorageBufferSpecification frustumCullingInput = {};
 		frustumCullingInput.Set = FRUSTUM_CULLING_SET;
 		frustumCullingInput.Binding = 0;
@@ -525,28 +498,9 @@ namespace ME::Render
 		frustumCullingInput.DebugName = "Frustum cull input buffer";
 		frustumCullingInput.ResourceBinding = primaryShaderGroup.ResourceLayout[FRUSTUM_CULLING_SET][0];
 		frustumCullingInput.SetIndex = frustumCullingSet;
+		frustumCullingInput.IndirectDraw = true;
 		m_InputMeshInfos = RStorageBuffer::Create(frustumCullingInput);
 
-		// Set 3 Binding 1 - Frustum culling output
-		IndirectBufferSpecification frustumCullingOutput = {};
-		frustumCullingOutput.Set = FRUSTUM_CULLING_SET;
-		frustumCullingOutput.Binding = 1;
-		frustumCullingOutput.Size = sizeof(DrawIndirectIndexedData) * ME_MESH_MNG_MAX_MESH_COUNT; // Max 100k instances per draw call
-		frustumCullingOutput.DebugName = "Frustum cull output buffer";
-		frustumCullingOutput.ResourceBinding = primaryShaderGroup.ResourceLayout[FRUSTUM_CULLING_SET][1];
-		frustumCullingOutput.SetIndex = frustumCullingSet;
-		m_OutputMeshInfos = RIndirectBuffer::Create(frustumCullingOutput);
-
-		// Set 3 Binding 2 - Frustum culling output count
-		IndirectBufferSpecification frustumCullingOutputCount = {};
-		frustumCullingOutputCount.Set = FRUSTUM_CULLING_SET;
-		frustumCullingOutputCount.Binding = 2;
-		frustumCullingOutputCount.Size = sizeof(uint32);
-		frustumCullingOutputCount.DebugName = "Frustum cull output count buffer";
-		frustumCullingOutputCount.ResourceBinding = primaryShaderGroup.ResourceLayout[FRUSTUM_CULLING_SET][2];
-		frustumCullingOutputCount.SetIndex = frustumCullingSet;
-		m_OutputMeshInfoCount = RIndirectBuffer::Create(frustumCullingOutputCount);
-
 		m_ImguiSet = RenderCommand::GetResourceHandler()->CreateResourceSet(mergeShaderGroup.ResourceLayout[IMGUI_FRAME_SET]);
 
 #pragma endregion
@@ -946,20 +900,6 @@ namespace ME::Render
 			m_MergePipeline = Pipeline::Create(pipelineSpecs);
         }
 
-#pragma endregion
-#pragma region Frustum cull pipeline
-		PipelineSpecification frustumPipelineSpecs = {};
-		frustumPipelineSpecs.BasePipeline = nullptr;
-		frustumPipelineSpecs.Type = PipelineType::Compute;
-		frustumPipelineSpecs.ComputeShader = frustumCullingShaderGroup.Shader;
-		frustumPipelineSpecs.BasePipeline = nullptr;
-		frustumPipelineSpecs.DebugName = "Frustum cull pipeline";
-        frustumPipelineSpecs.Constants = 
-		{
-		    PushConstant(ShaderStage::Compute, 0, sizeof(uint32))	
-		};
-
-		m_FrustumCullPipeline = Pipeline::Create(frustumPipelineSpecs);
 #pragma endregion
 
 		return true;
@@ -981,16 +921,17 @@ namespace ME::Render
 				camera->GetView().Invert(),
 			    camera->GetProjection().Invert()
 			};
-			ME::Core::Math::Frustum frustum = ME::Core::Math::ExtractFrustumFromMatrix(camera->GetView() * camera->GetProjection());
+			// The extraction reads the planes off the rows, so it wants the matrix the way it's applied to column vectors
+			m_CurrentFrustum = ME::Core::Math::ExtractFrustumFromMatrix((camera->GetView() * camera->GetProjection()).Transpose());
 			m_CurrentCameraBuffer->SetData(m_CurrentCommandBuffer, &data, sizeof(CameraData), 0);
-			m_CurrentCameraFrustumBuffer->SetData(m_CurrentCommandBuffer, &frustum, sizeof(ME::Core::Math::Frustum), 0);
+			m_CurrentCameraFrustumBuffer->SetData(m_CurrentCommandBuffer, &m_CurrentFrustum, sizeof(ME::Core::Math::Frustum), 0);
 		}
 
 		// Set 0
 		Manager::MeshManager::Get().GetVertexBuffer()->Write();
 		Manager::MeshManager::Get().GetIndexBuffer()->Write();		
 		Manager::MeshManager::Get().GetMeshletBuffer()->Write();	// Unused
-		Manager::MeshManager::Get().GetMeshBoxBuffer()->Write();	// In FrustumCulling shader
+		Manager::MeshManager::Get().GetMeshBoxBuffer()->Write();	// Unused
 		Manager::MeshManager::Get().GetDrawBuffer()->Write();		// Unused
         // Set 1
 		m_CurrentCameraBuffer->Write();
@@ -1008,11 +949,19 @@ namespace ME::Render
     {
 		Render::RenderCommand::NewFrame();
 		AcquireNewBuffers();
+
+		// Moves a few meshes toward the front of the pools while nothing of this frame is uploaded yet.
+		// Every compaction waits for the frames in flight, so it only runs once in a while
+		if (++m_FramesSinceCompaction >= ME_MESH_MNG_COMPACTION_INTERVAL)
+		{
+			m_FramesSinceCompaction = 0;
+			Manager::MeshManager::Get().CompactPools();
+		}
     }
 
     void Renderer::EndFrameImpl()
     {
-		m_QueuedMeshes.Clear();
+		m_QueuedMeshes = QueuedMeshMap();
 
         Render::RenderCommand::EndFrame();
 		Render::RenderCommand::Present();
@@ -1029,11 +978,15 @@ namespace ME::Render
 		renderingInfo.Opacity = meshComponent.Opacity;
 		renderingInfo.ShadowsVisible = meshComponent.ShadowsVisible;
 
+		const Core::Math::Transform& transform = transformComponent.Transform;
+		const InstanceTransform instanceTransform = { transform.Position(), transform.QRotation(), transform.Scale() };
+
 		if (m_QueuedMeshes.Contains(meshComponent.Mesh->GetMeshID()))
 		{
-			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].Transforms.EmplaceBack(transformComponent.Transform.Matrix().Transpose());
+			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].Transforms.EmplaceBack(instanceTransform);
 			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].MeshRenderingInfos.EmplaceBack(renderingInfo);
 			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].MeshIDs.EmplaceBack(static_cast<uint32>(meshComponent.Mesh->GetMeshID()));
+			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].Bounds.EmplaceBack(Core::Math::TransformBounds(meshComponent.Mesh->GetMeshBox(), transform));
 			m_QueuedMeshes[meshComponent.Mesh->GetMeshID()].Data.instanceCount++;
 		    return;
 		}
@@ -1042,9 +995,10 @@ namespace ME::Render
 		constants.MeshID = static_cast<uint32>(meshComponent.Mesh->GetMeshID());
 
 		MeshInfos infos = {};
-		infos.Transforms = { transformComponent.Transform.Matrix() };
+		infos.Transforms = { instanceTransform };
 		infos.MeshRenderingInfos = { renderingInfo };
 		infos.MeshIDs = { constants.MeshID };
+		infos.Bounds = { Core::Math::TransformBounds(meshComponent.Mesh->GetMeshBox(), transform) };
 		infos.MeshInfo = constants;
 		infos.Data.instanceCount = 1;
 		infos.Data.firstIndex = static_cast<uint32>(meshComponent.Mesh->GetIndexAllocation()->Offset) / sizeof(uint32);
@@ -1081,54 +1035,88 @@ namespace ME::Render
     void Renderer::ProcessQueuedMeshes()
     {
 		uint32 currentInstanceId = 0;
-		uint32 maxInstanceCount = 0;
-
+		// Draws actually written, they're packed so the G-Pass draws exactly this many
+		uint32 drawCount = 0;
+
+		// One slot lookup each, everything below works on plain pointers instead of copying references
+		StorageBuffer* meshTransforms = RenderCommand::Resolve(m_CurrentMeshTransforms);
+		StorageBuffer* meshRenderingInfos = RenderCommand::Resolve(m_CurrentMeshRenderingInfos);
+		StorageBuffer* meshIDs = RenderCommand::Resolve(m_CurrentMeshIDs);
+		ME_ASSERT(meshTransforms && meshRenderingInfos && meshIDs, "Per-frame mesh buffers were released!");
+
+		Core::FrameArray<uint32> visibleIndices = {};
+		Core::FrameArray<float32> transformValues = {};
+		Core::FrameArray<Core::Math::Matrix4x4> matrices = {};
 		for (auto& mesh : m_QueuedMeshes)
 		{
-			mesh.Value2.Data.firstInstance = currentInstanceId;
-			m_CurrentInputMeshInfos->SetData(&mesh.Value2.Data,
+			// Instances outside the camera are dropped here so they're never uploaded. The visible ones are moved
+			// to the front, the indices are ascending so no instance is overwritten before it's moved
+			MeshInfos& infos = mesh.Value2;
+			visibleIndices.Resize(infos.Bounds.Size());
+			const SIZE_T visibleCount = Core::Math::CullBoxes(m_CurrentFrustum, infos.Bounds.Data(), infos.Bounds.Size(), visibleIndices.Data());
+			for (SIZE_T i = 0; i < visibleCount; i++)
+			{
+				infos.Transforms[i] = infos.Transforms[visibleIndices[i]];
+				infos.MeshRenderingInfos[i] = infos.MeshRenderingInfos[visibleIndices[i]];
+			}
+			infos.Transforms.Resize(visibleCount);
+			infos.MeshRenderingInfos.Resize(visibleCount);
+			infos.MeshIDs.Resize(visibleCount);
+			infos.Bounds.Resize(visibleCount);
+			infos.Data.instanceCount = static_cast<uint32>(visibleCount);
+
+			// A mesh with nothing visible gets no draw, so the draws stay packed
+			if (visibleCount == 0)
+				continue;
+
+			// Column-major straight out of the batch, the way the shaders read them
+			transformValues.Resize(visibleCount * 10);
+			float32* values = transformValues.Data();
+			const Core::Math::TransformArrays arrays = {
+				values, values + visibleCount, values + visibleCount * 2,
+				values + visibleCount * 3, values + visibleCount * 4, values + visibleCount * 5, values + visibleCount * 6,
+				values + visibleCount * 7, values + visibleCount * 8, values + visibleCount * 9
+			};
+			for (SIZE_T i = 0; i < visibleCount; i++)
+			{
+				const InstanceTransform& instance = infos.Transforms[i];
+				values[i] = instance.Position.X;
+				values[visibleCount + i] = instance.Position.Y;
+				values[visibleCount * 2 + i] = instance.Position.Z;
+				values[visibleCount * 3 + i] = instance.Rotation.w;
+				values[visibleCount * 4 + i] = instance.Rotation.x;
+				values[visibleCount * 5 + i] = instance.Rotation.y;
+				values[visibleCount * 6 + i] = instance.Rotation.z;
+				values[visibleCount * 7 + i] = instance.Scale.X;
+				values[visibleCount * 8 + i] = instance.Scale.Y;
+				values[visibleCount * 9 + i] = instance.Scale.Z;
+			}
+			matrices.Resize(visibleCount);
+			Core::Math::ComposeTransforms(arrays, visibleCount, matrices.Data(), Core::Math::MatrixLayout::ColumnMajor);
+
+			infos.Data.firstInstance = currentInstanceId;
+			m_CurrentInputMeshInfos->SetData(&infos.Data,
 				sizeof(DrawIndirectIndexedData),
-				currentInstanceId * sizeof(DrawIndirectIndexedData));
-			m_CurrentMeshTransforms->SetData(mesh.Value2.Transforms.Data(),
-				mesh.Value2.Transforms.Size() * sizeof(Core::Math::Matrix4x4),
+				drawCount * sizeof(DrawIndirectIndexedData));
+			meshTransforms->SetData(matrices.Data(),
+				matrices.Size() * sizeof(Core::Math::Matrix4x4),
 				currentInstanceId * sizeof(Core::Math::Matrix4x4)
 			);
-			m_CurrentMeshRenderingInfos->SetData(mesh.Value2.MeshRenderingInfos.Data(),
-				mesh.Value2.MeshRenderingInfos.Size() * sizeof(MeshShadingInfo),
+			meshRenderingInfos->SetData(infos.MeshRenderingInfos.Data(),
+				infos.MeshRenderingInfos.Size() * sizeof(MeshShadingInfo),
 				currentInstanceId * sizeof(MeshShadingInfo)
 			);
-			m_CurrentMeshIDs->SetData(mesh.Value2.MeshIDs.Data(),
-				mesh.Value2.MeshIDs.Size() * sizeof(uint32),
+			meshIDs->SetData(infos.MeshIDs.Data(),
+				infos.MeshIDs.Size() * sizeof(uint32),
 				currentInstanceId * sizeof(uint32));
-			currentInstanceId += mesh.Value2.Data.instanceCount;
-			maxInstanceCount = Core::Algorithm::Max(maxInstanceCount, mesh.Value2.Data.instanceCount);
+			currentInstanceId += infos.Data.instanceCount;
+			drawCount++;
 		}
 
 		m_CurrentInputMeshInfos->Write();
-		m_CurrentOutputMeshInfos->Write();
-		m_CurrentOutputMeshInfoCount->Write();
-		m_CurrentMeshTransforms->Write();
-		m_CurrentMeshIDs->Write();
-		m_CurrentMeshRenderingInfos->Write();
-
-		Manager::MeshManager::Get().GetVertexBuffer()->Bind(m_CurrentCommandBuffer, m_FrustumCullPipeline);
-		m_CurrentCameraFrustumBuffer->Bind(m_CurrentCommandBuffer, m_FrustumCullPipeline);
-		m_CurrentMeshTransforms->Bind(m_CurrentCommandBuffer, m_FrustumCullPipeline);
-		m_CurrentInputMeshInfos->Bind(m_CurrentCommandBuffer, m_FrustumCullPipeline);
-
-		uint32 meshCount = static_cast<uint32>(m_QueuedMeshes.Size());
-		m_FrustumCullPipeline->SetConstants(m_CurrentCommandBuffer, ShaderStage::Compute, &meshCount, sizeof(uint32));
-		m_FrustumCullPipeline->Bind(m_CurrentCommandBuffer);
-
-        RenderCommand::Dispatch(m_CurrentCommandBuffer, 
-			static_cast<uint32>((static_cast<uint32>(m_QueuedMeshes.Size()) + 127) / 128), (maxInstanceCount + 3) / 4, 1);
-
-		m_CurrentOutputMeshInfos->Barrier(m_CurrentCommandBuffer,
-			{ AccessFlags::ShaderWrite, PipelineStageFlags::ComputeShader },
-			{ AccessFlags::IndirectCommandRead, PipelineStageFlags::DrawIndirect });
-		m_CurrentOutputMeshInfoCount->Barrier(m_CurrentCommandBuffer,
-			{ AccessFlags::ShaderWrite, PipelineStageFlags::ComputeShader }, 
-			{ AccessFlags::IndirectCommandRead, PipelineStageFlags::DrawIndirect });
+		meshTransforms->Write();
+		meshIDs->Write();
+		meshRenderingInfos->Write();
 
 		Render::ClearValue clrVal = {};
 		clrVal.ColorClearValue = Core::Math::Vector4D32(0.f, 0.f, 0.f, 1.f);
@@ -1155,16 +1143,15 @@ namespace ME::Render
 
 		Manager::MeshManager::Get().GetVertexBuffer()->Bind(m_CurrentCommandBuffer, m_GeometryPipeline);
 		m_CurrentCameraFrustumBuffer->Bind(m_CurrentCommandBuffer, m_GeometryPipeline);
-		m_CurrentMeshTransforms->Bind(m_CurrentCommandBuffer, m_GeometryPipeline);
+		meshTransforms->Bind(m_CurrentCommandBuffer, m_GeometryPipeline);
 		m_CurrentInputMeshInfos->Bind(m_CurrentCommandBuffer, m_GeometryPipeline);
 
 		Manager::MeshManager::Get().GetVertexBuffer()->Bind(m_CurrentCommandBuffer, 0);
 		Manager::MeshManager::Get().GetIndexBuffer()->Bind(m_CurrentCommandBuffer, 0);
 
-		RenderCommand::DrawIndexedIndirectCount(m_CurrentCommandBuffer, PipelineStageFlags::ComputeShader,
-			m_CurrentOutputMeshInfos, 0,
-			m_CurrentOutputMeshInfoCount, 0,
-			static_cast<uint32>(m_QueuedMeshes.Size()), sizeof(DrawIndirectIndexedData));	
+		if (drawCount != 0)
+			RenderCommand::DrawIndexedIndirect(m_CurrentCommandBuffer, m_CurrentInputMeshInfos, 0,
+				drawCount, sizeof(DrawIndirectIndexedData));
     
 		m_GPass->End(m_CurrentCommandBuffer);
 	}
@@ -1179,13 +1166,11 @@ namespace ME::Render
 		m_CurrentCameraBuffer = m_CameraBuffer->AcquireNextBuffer();
 		m_CurrentCameraFrustumBuffer = m_CameraFrustumBuffer->AcquireNextBuffer();
 
-		m_CurrentMeshTransforms = m_MeshTransforms->AcquireNextBuffer();
-		m_CurrentMeshRenderingInfos = m_MeshRenderingInfos->AcquireNextBuffer();
-		m_CurrentMeshIDs = m_MeshIDs->AcquireNextBuffer();
+		m_CurrentMeshTransforms = RenderCommand::GetHandle(m_MeshTransforms->AcquireNextBuffer());
+		m_CurrentMeshRenderingInfos = RenderCommand::GetHandle(m_MeshRenderingInfos->AcquireNextBuffer());
+		m_CurrentMeshIDs = RenderCommand::GetHandle(m_MeshIDs->AcquireNextBuffer());
 
 		m_CurrentInputMeshInfos = m_InputMeshInfos->AcquireNextBuffer();
-		m_CurrentOutputMeshInfos = m_OutputMeshInfos->AcquireNextBuffer();
-		m_CurrentOutputMeshInfoCount = m_OutputMeshInfoCount->AcquireNextBuffer();
     }
 
     void Renderer::LightStage()
@@ -1,5 +1,8 @@
 #pragma once
 #include <Core.hpp>
+#include <Core/Memory/Allocators/ArenaAllocator.hpp>
+#include <Core/Math/FrustumCulling.hpp>
+#include <Core/Math/TransformBatch.hpp>
 
 #include "Base/RenderAPI.hpp"
 #include "Base/Pipeline.hpp"
@@ -63,11 +66,25 @@ namespace ME::Render
 			uint32 Padding[3];
 		};
 
+		// Composed into GPU matrices in one batch once the instances are culled
+		struct InstanceTransform
+		{
+			ME::Core::Math::Vector3D Position;
+			ME::Core::Math::Quaternion Rotation;
+			ME::Core::Math::Vector3D Scale;
+		};
+
+		static constexpr SIZE_T MeshInstanceInlineCount = 4;
+
 	    struct alignas(16) MeshInfos
 		{
-			ME::Core::Array<MeshShadingInfo> MeshRenderingInfos;
-			ME::Core::Array<ME::Core::Math::Matrix4x4> Transforms;
-			ME::Core::Array<uint32> MeshIDs;
+			// Most meshes are drawn a few times per frame, the instance data stays inline until then
+			// and spills into the frame arena after that, it's copied into the storage buffers before the frame ends
+			ME::Core::SmallArray<MeshShadingInfo, MeshInstanceInlineCount, ME::Core::Memory::ArenaAllocator<MeshShadingInfo>> MeshRenderingInfos;
+			ME::Core::SmallArray<InstanceTransform, MeshInstanceInlineCount, ME::Core::Memory::ArenaAllocator<InstanceTransform>> Transforms;
+			ME::Core::SmallArray<uint32, MeshInstanceInlineCount, ME::Core::Memory::ArenaAllocator<uint32>> MeshIDs;
+			// World space bounds of every instance, culled against the camera before the instances are uploaded
+			ME::Core::SmallArray<ME::Core::Math::BoundingBox, MeshInstanceInlineCount, ME::Core::Memory::ArenaAllocator<ME::Core::Math::BoundingBox>> Bounds;
 			MeshConstants MeshInfo;
 			DrawIndirectIndexedData Data;
 			uint32 Padding[3];
@@ -134,7 +151,6 @@ namespace ME::Render
 		void MergeStage();
 
 	private:
-		ME::Core::Memory::Reference<ME::Render::Pipeline> m_FrustumCullPipeline;
 		// G-Pass
 		ME::Core::Memory::Reference<ME::Render::RenderPass> m_GPass;
 		ME::Core::Memory::Reference<ME::Render::RFramebuffer> m_GFramebuffer;
@@ -168,8 +184,6 @@ namespace ME::Render
 	    ME::Core::Memory::Reference<ME::Render::RStorageBuffer> m_MeshIDs;
 
 		ME::Core::Memory::Reference<ME::Render::RStorageBuffer> m_InputMeshInfos;
-		ME::Core::Memory::Reference<ME::Render::RIndirectBuffer> m_OutputMeshInfos;
-		ME::Core::Memory::Reference<ME::Render::RIndirectBuffer> m_OutputMeshInfoCount;
 
 	    uint32 m_ImguiSet;
 
@@ -183,19 +197,27 @@ namespace ME::Render
 		ME::Core::Memory::Reference<ME::Render::Uniform> m_CurrentCameraBuffer;
 		ME::Core::Memory::Reference<ME::Render::Uniform> m_CurrentCameraFrustumBuffer;
 
-		ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_CurrentMeshTransforms;
-		ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_CurrentMeshRenderingInfos;
-		ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_CurrentMeshIDs;
+		// Only ProcessQueuedMeshes uses them, it resolves them through the resource tracker
+		ME::Render::StorageBufferHandle m_CurrentMeshTransforms;
+		ME::Render::StorageBufferHandle m_CurrentMeshRenderingInfos;
+		ME::Render::StorageBufferHandle m_CurrentMeshIDs;
 
+		// The G-Pass draws from it, the indirect draws take a reference
 		ME::Core::Memory::Reference<ME::Render::StorageBuffer> m_CurrentInputMeshInfos;
-		ME::Core::Memory::Reference<ME::Render::IndirectBuffer> m_CurrentOutputMeshInfos;
-		ME::Core::Memory::Reference<ME::Render::IndirectBuffer> m_CurrentOutputMeshInfoCount;
 
 		ME::Core::Memory::WeakReference<ME::Render::Camera> m_CurrentCamera;
+		ME::Core::Math::Frustum m_CurrentFrustum;
 
 	private:
-	    ME::Core::UnorderedMap<uint64, MeshInfos> m_QueuedMeshes;
+		// Rebuilt every frame. Its nodes and buckets live in the double buffered arena, so the map
+		// made at the end of one frame stays valid while the next one fills it
+		using QueuedMeshMap = ME::Core::UnorderedMap<uint64, MeshInfos, ME::Core::Memory::Hasher<uint64>,
+			ME::Core::Memory::DoubleBufferedArenaAllocator<void>>;
+
+	    QueuedMeshMap m_QueuedMeshes;
 	    ME::Core::Array<DrawIndirectIndexedData> m_DrawIndirectData;
+
+		uint32 m_FramesSinceCompaction;
 	};
 }
 
@@ -1,6 +1,8 @@
 #include "AssetLoader.hpp"
 
+#include <Core/Containers/SmallArray.hpp>
 #include <Core/Containers/UnorderedMap.hpp>
+#include <Core/Containers/String/StringUtils.hpp>
 #include <Core/Platform/Base/IO.hpp>
 
 #include "Application/Application.hpp"
@@ -20,31 +22,6 @@ namespace ME::Utility
 	constexpr const char8* DefaultMeshName = TEXT("unnamed");
 	namespace LocalFunctions
 	{
-		void Split(const ME::Core::String& str,
-			ME::Core::Array<ME::Core::String>& out,
-			ME::Core::String splitStr)
-		{
-			out.Clear();
-
-			ME::Core::String temp;
-
-			for (int32 i = 0; i < static_cast<int32>(str.Size()); i++)
-			{
-				ME::Core::String test = str.Substring(i, splitStr.Size());
-
-				if (test == splitStr)
-				{
-					out.EmplaceBack(temp);
-					temp.Clear();
-					i += static_cast<int32>(splitStr.Size()) - 1;
-				}
-				else
-					temp += str[i];
-			}
-			if (!temp.Empty())
-				out.EmplaceBack(temp);
-		}
-
 		void TrimLineEnding(ME::Core::String& in)
 		{
 			if (!in.Empty() && (in[in.Size() - 1] == TEXT('\r') || in[in.Size() - 1] == '\n'))
@@ -88,9 +65,10 @@ namespace ME::Utility
 		}
 
 		template <class T>
-		inline const T& FindElement(const ME::Core::Array<T>& elements, ME::Core::String& index)
+		inline const T& FindElement(const ME::Core::Array<T>& elements, ME::Core::StringView index)
 		{
-			int32 idx = static_cast<int32>(ME::Core::StringToInt(index, nullptr));
+			int32 idx = 0;
+			ME::Core::Utils::ParseInt(index, idx);
 			if (idx == 0)
 			{
 				ME_ERROR("Invalid vertex index 0 in OBJ file.");
@@ -214,8 +192,8 @@ namespace ME::Utility
 		ME::Core::String line;
 		ME::Core::String token = TEXT("");
 		ME::Core::String value = TEXT("");
-		ME::Core::Array<ME::Core::String> values(4);
-		ME::Core::Array<ME::Core::String> faceValues(3);
+		ME::Core::SmallArray<ME::Core::StringView, 4> values;
+		ME::Core::SmallArray<ME::Core::StringView, 3> faceValues;
 
 		uint32 faceCount = 0;
 
@@ -256,45 +234,45 @@ namespace ME::Utility
 			{
 				Core::Math::Vector3D32 position;
 				value = LocalFunctions::GetTokenValues(line);
-				LocalFunctions::Split(value, values, TEXT(" "));
-				position.X = static_cast<float32>(Core::StringToFloat(values[0], nullptr));
-				position.Y = static_cast<float32>(Core::StringToFloat(values[1], nullptr));
-				position.Z = static_cast<float32>(Core::StringToFloat(values[2], nullptr));
+				Core::Utils::Split(value, values, TEXT(" \t"), Core::Utils::SplitOptions::SkipEmpty | Core::Utils::SplitOptions::AnyOf);
+				Core::Utils::ParseFloat(values[0], position.X);
+				Core::Utils::ParseFloat(values[1], position.Y);
+				Core::Utils::ParseFloat(values[2], position.Z);
 				positions.EmplaceBack(position);
 			}
 			else if (token == TEXT("vt"))
 			{
 				Core::Math::Vector2D32 coords;
 				value = LocalFunctions::GetTokenValues(line);
-				LocalFunctions::Split(value, values, TEXT(" "));
-				coords.X = static_cast<float32>(Core::StringToFloat(values[0], nullptr));
-				coords.Y = static_cast<float32>(Core::StringToFloat(values[1], nullptr));
+				Core::Utils::Split(value, values, TEXT(" \t"), Core::Utils::SplitOptions::SkipEmpty | Core::Utils::SplitOptions::AnyOf);
+				Core::Utils::ParseFloat(values[0], coords.X);
+				Core::Utils::ParseFloat(values[1], coords.Y);
 				uvCoords.EmplaceBack(coords);
 			}
 			else if (token == TEXT("vn"))
 			{
 				Core::Math::Vector3D32 normal;
 				value = LocalFunctions::GetTokenValues(line);
-				LocalFunctions::Split(value, values, TEXT(" "));
-				normal.X = static_cast<float32>(Core::StringToFloat(values[0], nullptr));
-				normal.Y = static_cast<float32>(Core::StringToFloat(values[1], nullptr));
-				normal.Z = static_cast<float32>(Core::StringToFloat(values[2], nullptr));
+				Core::Utils::Split(value, values, TEXT(" \t"), Core::Utils::SplitOptions::SkipEmpty | Core::Utils::SplitOptions::AnyOf);
+				Core::Utils::ParseFloat(values[0], normal.X);
+				Core::Utils::ParseFloat(values[1], normal.Y);
+				Core::Utils::ParseFloat(values[2], normal.Z);
 				normals.EmplaceBack(normal);
 			}
 			else if (token == TEXT("vp")) continue;
 			else if (token == TEXT("f"))
 			{
 				value = LocalFunctions::GetTokenValues(line);
-				LocalFunctions::Split(value, values, TEXT(" "));
+				Core::Utils::Split(value, values, TEXT(" \t"), Core::Utils::SplitOptions::SkipEmpty | Core::Utils::SplitOptions::AnyOf);
 				if (values.Size() < 3)
 					continue;
 
 				faceIndices.Clear();
 				faceVertices.Clear();
 
-				for (const Core::String& val : values)
+				for (const Core::StringView& val : values)
 				{
-					LocalFunctions::Split(val, faceValues, TEXT("/"));
+					Core::Utils::Split(val, faceValues, TEXT("/"));
 
 					Assets::Vertex vertex;
 					vertex.Position = LocalFunctions::FindElement(positions, faceValues[0]);
@@ -412,7 +390,7 @@ namespace ME::Utility
 		uint8* targaData = new uint8[imageSize];
 		memcpy(targaData, data + sizeof(TRGHeader), imageSize);
 
-		uint8* imageData = new uint8[imageSize];
+		Assets::Image::PixelArray imageData(imageSize);
 		delete[] data;
 
 		int32 index = 0;
@@ -436,7 +414,7 @@ namespace ME::Utility
 		delete[] targaData;
 
 		AssetLoadResult result;
-		result.Images.PushBack(ME::Core::Memory::Reference<Assets::Image>(new Assets::Image(imageData, imageSize, resolution, file->GetFileInfo().Name)));
+		result.Images.PushBack(ME::Core::Memory::Reference<Assets::Image>(new Assets::Image(std::move(imageData), resolution, file->GetFileInfo().Name)));
 
 		file->Close();
 		return result;
@@ -504,7 +482,9 @@ namespace ME::Utility
 				case FourCC('d', 'a', 't', 'a'):
 				{
 					file->ReadBinary(&header.DataSize, sizeof(uint32));
-					header.Data = new uint8[header.DataSize];
+					if (header.DataSize == 0)
+						break;
+					header.Data = static_cast<uint8*>(ME::Core::Memory::LargeBlockHeap::Allocate(header.DataSize));
 					file->ReadBinary(header.Data, header.DataSize);
 					if (header.DataSize % 2 != 0)
 					    file->ReadBinary(dump, sizeof(uint8));
@@ -1,12 +1,15 @@
 #pragma once
 #include "Core.hpp"
 #include "Core/Algorithm.hpp"
+#include "Core/Memory/Memory.hpp"
 #include "Core/Memory/Allocators/Allocator.hpp"
 #include "Core/Utility/Logging/Logger.hpp"
 
+#include <cstring>
 #include <vector>
 
 constexpr uint8 ARR_RESIZE_MULTIPLYER = 2;
+constexpr uint8 ARR_DEFAULT_CAPACITY = 20;
 
 namespace ME::Core
 {
@@ -144,74 +147,62 @@ namespace ME::Core
 	    using Iterator = ArrayIterator<Array>;
 	    using ConstIterator = ArrayConstIterator<Array>;
 
+	private:
+		static constexpr bool IsRelocatable = Memory::IsTriviallyRelocatable<DataType>;
+
 	public:
-		Array()
-			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(0), m_Capacity(20)
+		// Doesn't allocate, the first insertion does
+		Array() noexcept
+			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(0), m_Capacity(0)
 		{
-			Allocate(m_Capacity);
 		}
 
 		Array(SIZE_T size)
-			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(size), m_Capacity(size)
+			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(0), m_Capacity(0)
 		{
-			Allocate(m_Capacity);
-			m_Size = size;
-			for (SIZE_T i = 0; i < m_Size; i++)
+			if (size == 0)
+				return;
+
+			Allocate(size);
+			for (SIZE_T i = 0; i < size; i++)
 				m_Allocator.Construct(&m_Data[i]);
+			m_Size = size;
 		}
 
 		Array(const Array& other)
+			: m_Allocator(other.m_Allocator), m_Data(nullptr), m_Size(0), m_Capacity(0)
 		{
-			if (this != &other)
-			{
-				m_Allocator = other.m_Allocator;
-				m_Capacity = other.m_Capacity;
-				m_Size = 0;
-				m_Data = nullptr;
-
-				Allocate(m_Capacity);
+			if (other.m_Size == 0)
+				return;
 
-				m_Size = other.m_Size;
-				for (SIZE_T i = 0; i < m_Size; i++)
-					m_Allocator.Construct(&m_Data[i], other.m_Data[i]);
-			}
+			Allocate(other.m_Size);
+			CopyConstruct(m_Data, other.m_Data, other.m_Size);
+			m_Size = other.m_Size;
 		}
 
 		Array(const std::initializer_list<DataType>& other)
-			: m_Allocator(AllocatorType()), m_Data(nullptr)
+			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(0), m_Capacity(0)
 		{
-			m_Data = nullptr;
-			m_Size = 0;
-
-			Allocate(other.size() > 20 ? other.size() * ARR_RESIZE_MULTIPLYER : 20);
+			if (other.size() == 0)
+				return;
 
+			Allocate(other.size());
+			CopyConstruct(m_Data, other.begin(), other.size());
 			m_Size = other.size();
-			for (SIZE_T i = 0; i < other.size(); i++)
-				m_Allocator.Construct(&m_Data[i], other.begin()[i]);
 		}
 
 		Array(Array&& other) noexcept
+			: m_Allocator(other.m_Allocator), m_Data(other.m_Data), m_Size(other.m_Size), m_Capacity(other.m_Capacity)
 		{
-			m_Allocator = other.m_Allocator;
-			m_Size = other.m_Size;
-			m_Capacity = other.m_Capacity;
-
+			other.m_Data = nullptr;
 			other.m_Size = 0;
 			other.m_Capacity = 0;
-
-			m_Data = other.m_Data;
-			other.m_Data = nullptr;
 		}
 
 		~Array()
 		{
 			Clear();
-
-			if (m_Data)
-			{
-				m_Allocator.Deallocate(m_Data, m_Capacity);
-				m_Data = nullptr;
-			}
+			Deallocate();
 		}
 
 	public:
@@ -230,6 +221,11 @@ namespace ME::Core
 			return m_Data;
 		}
 
+		ME_NODISCARD inline const DataType* Data() const
+		{
+			return m_Data;
+		}
+
 		inline Iterator begin()
 		{
 			return Begin();
@@ -306,33 +302,37 @@ namespace ME::Core
 			if (this != &other)
 			{
 				Clear();
-				if (m_Data)
-				{
-					m_Allocator.Deallocate(m_Data, m_Capacity);
-					m_Data = nullptr;
-				}
 				m_Allocator = other.m_Allocator;
 
-				Allocate(other.m_Capacity);
+				// Keep the current block when the elements fit
+				if (other.m_Size > m_Capacity)
+				{
+					Deallocate();
+					Allocate(other.m_Size);
+				}
 
+				CopyConstruct(m_Data, other.m_Data, other.m_Size);
 				m_Size = other.m_Size;
-				for (SIZE_T i = 0; i < m_Size; i++)
-					m_Allocator.Construct(&m_Data[i], other.m_Data[i]);
 			}
 			return *this;
 		}
 
 		Array& operator=(Array&& other) noexcept
         {
-			m_Allocator = other.m_Allocator;
-			m_Size = other.m_Size;
-			m_Capacity = other.m_Capacity;
+			if (this != &other)
+			{
+				Clear();
+				Deallocate();
 
-			other.m_Size = 0;
-			other.m_Capacity = 0;
+				m_Allocator = other.m_Allocator;
+				m_Data = other.m_Data;
+				m_Size = other.m_Size;
+				m_Capacity = other.m_Capacity;
 
-			m_Data = other.m_Data;
-			other.m_Data = nullptr;
+				other.m_Data = nullptr;
+				other.m_Size = 0;
+				other.m_Capacity = 0;
+			}
 			return *this;
 		}
 
@@ -364,29 +364,39 @@ namespace ME::Core
 			if (m_Size == 0)
 				return;
 
-			for (SIZE_T i = 0; i < m_Size; i++)
-				m_Allocator.Destroy(&m_Data[i]);
+			if constexpr (!std::is_trivially_destructible_v<DataType>)
+			{
+				for (SIZE_T i = 0; i < m_Size; i++)
+					m_Allocator.Destroy(&m_Data[i]);
+			}
 			m_Size = 0;
 		}
 
+		// Makes room for at least 'size' elements. Returns true if the array reallocated
 		bool Reserve(SIZE_T size)
 		{
 			return PReserve(size);
 		}
 
+		// Grows with default constructed elements or destroys the ones past 'size'
 		void Resize(SIZE_T size)
 		{
-			if (size <= m_Capacity)
-				m_Size = size;
+			PResize(size);
+		}
+
+		// Reallocates to exactly Size() elements, releasing the block when empty
+		void ShrinkToFit()
+		{
+			PShrinkToFit();
 		}
 
 		void Shrink()
 		{
-			PShrink();
+			PShrinkToFit();
 		}
 
 	public:
-		ME_NODISCARD inline bool Empty()
+		ME_NODISCARD inline bool Empty() const
 		{
 			return m_Size <= 0;
 		}
@@ -415,7 +425,7 @@ namespace ME::Core
 
 		Iterator Insert(ConstIterator position, const std::initializer_list<DataType>& list)
 		{
-			return PInsert(position, list);
+			return PInsert(position, list.begin(), list.end());
 		}
 
 		template <typename InputIt>
@@ -426,12 +436,12 @@ namespace ME::Core
 
 		void PushBack(const DataType& value)
 		{
-			PPushBack(value);
+			PEmplaceBack(value);
 		}
 
 		void PushBack(DataType&& value) noexcept
 		{
-			PPushBack(std::move(value));
+			PEmplaceBack(std::move(value));
 		}
 
 		template <class... val>
@@ -442,27 +452,27 @@ namespace ME::Core
 
 		Iterator Erase(Iterator it)
 		{
-			return PErase(it);
+			return PErase(it.Ptr() - m_Data, 1);
 		}
 
 		Iterator Erase(ConstIterator it)
 		{
-			return PErase(it);
+			return PErase(it.Ptr() - m_Data, 1);
 		}
 
 		Iterator Erase(Iterator first, Iterator last)
 		{
-			return PErase(first, last);
+			return PErase(first.Ptr() - m_Data, last - first);
 		}
 
 		Iterator Erase(ConstIterator first, ConstIterator last)
 		{
-			return PErase(first, last);
+			return PErase(first.Ptr() - m_Data, last - first);
 		}
 
 		Iterator EraseAt(SIZE_T index)
 		{
-			return PErase(Begin() + index);
+			return PErase(index, 1);
 		}
 
 		void PopBack()
@@ -471,164 +481,185 @@ namespace ME::Core
 		}
 
 	private:
-		void Allocate(SIZE_T newCapacity)
+		// Moves 'count' live elements from 'source' into uninitialized memory at 'destination' and ends their lifetime
+		// in the source. Ranges may overlap only when moving towards lower addresses
+		void Relocate(Ptr destination, Ptr source, SIZE_T count)
 		{
-		    DataType* newBlock = m_Allocator.Allocate(newCapacity);
+			if (count == 0)
+				return;
 
-			SIZE_T elementsToMove = (m_Data && m_Capacity > 0) ? ME::Core::Algorithm::Min(m_Size, newCapacity) : 0;
+			if constexpr (IsRelocatable)
+				memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(DataType));
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+				{
+					m_Allocator.Construct(&destination[i], std::move(source[i]));
+					m_Allocator.Destroy(&source[i]);
+				}
+			}
+		}
 
-			if (m_Data && m_Capacity > 0)
+		// Same as Relocate but walks backwards, for overlapping moves towards higher addresses
+		void RelocateBackward(Ptr destination, Ptr source, SIZE_T count)
+		{
+			if constexpr (IsRelocatable)
+				Relocate(destination, source, count);
+			else
 			{
-				if constexpr (std::is_trivially_copyable_v<DataType>)
+				for (SIZE_T i = count; i > 0; i--)
 				{
-					memcpy(newBlock, m_Data, elementsToMove * sizeof(DataType));
+					m_Allocator.Construct(&destination[i - 1], std::move(source[i - 1]));
+					m_Allocator.Destroy(&source[i - 1]);
 				}
-				else
+			}
+		}
+
+		void CopyConstruct(Ptr destination, const DataType* source, SIZE_T count)
+		{
+			if constexpr (std::is_trivially_copyable_v<DataType>)
+			{
+				if (count > 0)
+					memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(DataType));
+			}
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+					m_Allocator.Construct(&destination[i], source[i]);
+			}
+		}
+
+		void Allocate(SIZE_T newCapacity)
+		{
+			if (newCapacity < m_Size)
+			{
+				if constexpr (!std::is_trivially_destructible_v<DataType>)
 				{
-					for (SIZE_T i = 0; i < elementsToMove; i++)
-					{
-						new (&newBlock[i]) DataType(std::move(m_Data[i]));
-						m_Data[i].~DataType();
-					}
+					for (SIZE_T i = newCapacity; i < m_Size; i++)
+						m_Allocator.Destroy(&m_Data[i]);
 				}
+				m_Size = newCapacity;
+			}
+
+			DataType* newBlock = newCapacity > 0 ? m_Allocator.Allocate(newCapacity) : nullptr;
 
+			if (m_Data)
+			{
+				Relocate(newBlock, m_Data, m_Size);
 				m_Allocator.Deallocate(m_Data, m_Capacity);
 			}
 
 			m_Data = newBlock;
 			m_Capacity = newCapacity;
-			m_Size = elementsToMove;
-		}
-
-		inline void CheckAndAllocate()
-		{
-			if (m_Size >= m_Capacity)
-				Allocate(m_Capacity <= 0 ? 20 : m_Capacity * ARR_RESIZE_MULTIPLYER);
 		}
 
-	private:
-		void PPushBack(const DataType& value)
+		void Deallocate()
 		{
-			CheckAndAllocate();
-			m_Allocator.Construct(&m_Data[m_Size], value);
-			m_Size++;
+			if (m_Data)
+			{
+				m_Allocator.Deallocate(m_Data, m_Capacity);
+				m_Data = nullptr;
+			}
+			m_Capacity = 0;
 		}
 
-		void PPushBack(DataType&& value)
+		inline SIZE_T GrowCapacity(SIZE_T required) const
 		{
-			CheckAndAllocate();
-			m_Allocator.Construct(&m_Data[m_Size], std::move(value));
-			m_Size++;
+			const SIZE_T grown = m_Capacity <= 0 ? ARR_DEFAULT_CAPACITY : m_Capacity * ARR_RESIZE_MULTIPLYER;
+			return ME::Core::Algorithm::Max(grown, required);
 		}
 
-		template <class... val>
-		ReturnType& PEmplaceBack(val&&... args)
+		// Makes sure [offset, offset + count) is free by moving the tail back, the gap is left uninitialized
+		Ptr POpenGap(SIZE_T offset, SIZE_T count)
 		{
-			CheckAndAllocate();
-
-			Ptr lastLoc = &m_Data[m_Size];
-
-			m_Allocator.Construct(lastLoc, std::forward<val>(args)...);
-			m_Size++;
-
-			DataType& result = *lastLoc;
+			const SIZE_T newSize = m_Size + count;
+			if (newSize > m_Capacity)
+			{
+				// Relocate straight into the new block so the tail only moves once
+				const SIZE_T newCapacity = GrowCapacity(newSize);
+				DataType* newBlock = m_Allocator.Allocate(newCapacity);
+				if (m_Data)
+				{
+					Relocate(newBlock, m_Data, offset);
+					Relocate(newBlock + offset + count, m_Data + offset, m_Size - offset);
+					m_Allocator.Deallocate(m_Data, m_Capacity);
+				}
+				m_Data = newBlock;
+				m_Capacity = newCapacity;
+			}
+			else
+				RelocateBackward(m_Data + offset + count, m_Data + offset, m_Size - offset);
 
-			return result;
+			m_Size = newSize;
+			return m_Data + offset;
 		}
 
+	private:
 		template <class... val>
-		Iterator PEmplace(ConstIterator it, val&&... args)
+		ReturnType& PEmplaceBack(val&&... args)
 		{
-			SIZE_T offset = it - m_Data;
-
-			Ptr itPtr = m_Data + offset;
-			Ptr lastLoc = &m_Data[m_Size];
-
-			CheckAndAllocate();
-
-			if (itPtr == lastLoc)
+			if (m_Size < m_Capacity)
 			{
+				Ptr lastLoc = &m_Data[m_Size];
 				m_Allocator.Construct(lastLoc, std::forward<val>(args)...);
 				m_Size++;
+				return *lastLoc;
 			}
-			else
-			{
-				for (Ptr pos = lastLoc; pos > itPtr; --pos)
-				{
-					m_Allocator.Construct(pos, std::move(*(pos - 1)));
-					m_Allocator.Destroy(pos - 1);
-				}
 
-				m_Allocator.Destroy(itPtr);
-				m_Allocator.Construct(itPtr, std::forward<val>(args)...);
-				m_Size++;
+			// Construct in the new block before the old one goes away, the arguments may refer to our own elements
+			const SIZE_T newCapacity = GrowCapacity(m_Size + 1);
+			DataType* newBlock = m_Allocator.Allocate(newCapacity);
+			m_Allocator.Construct(&newBlock[m_Size], std::forward<val>(args)...);
+			if (m_Data)
+			{
+				Relocate(newBlock, m_Data, m_Size);
+				m_Allocator.Deallocate(m_Data, m_Capacity);
 			}
 
-			return Iterator(itPtr);
+			m_Data = newBlock;
+			m_Capacity = newCapacity;
+			return m_Data[m_Size++];
 		}
 
-		void PInsertShift(SIZE_T offset, SIZE_T count)
+		template <class... val>
+		Iterator PEmplace(ConstIterator it, val&&... args)
 		{
-			if (count == 0) return;
-
-			SIZE_T new_size = m_Size + count;
-			if (new_size > m_Capacity)
-				Allocate(ME::Core::Algorithm::Max(m_Capacity * ARR_RESIZE_MULTIPLYER, new_size));
-			Ptr targetPtr = m_Data + offset;
-
-			SIZE_T old_size = m_Size;
-
-			for (SIZE_T i = 0; i < count; ++i)
-			{
-				m_Allocator.Construct(&m_Data[new_size - 1 - i], std::move(m_Data[old_size - 1 - i]));
-				m_Allocator.Destroy(&m_Data[old_size - 1 - i]);
-			}
+			const SIZE_T offset = it.Ptr() - m_Data;
+			if (offset == m_Size)
+				return Iterator(&PEmplaceBack(std::forward<val>(args)...));
 
-			for (SIZE_T i = old_size - 1 - count; i >= offset; --i)
-			{
-				m_Data[i + count] = std::move(m_Data[i]);
-			}
-
-			m_Size = new_size;
+			// Built up front, the arguments may refer to elements which are about to move
+			DataType value(std::forward<val>(args)...);
+			Ptr gap = POpenGap(offset, 1);
+			m_Allocator.Construct(gap, std::move(value));
+			return Iterator(gap);
 		}
 
 		Iterator PInsert(ConstIterator position, const SIZE_T count, const DataType& value)
 		{
-			SIZE_T currentPos = position - Begin();
-			Reserve(m_Size + count);
-			Iterator result = Begin() + currentPos;
+			const SIZE_T offset = position.Ptr() - m_Data;
+			if (count == 0)
+				return Iterator(m_Data + offset);
 
-			for (SIZE_T i = m_Size; i > currentPos; --i)
-				PEmplaceBack(std::move(operator[](i - 1)));
-            for (SIZE_T i = 0; i < count; ++i)
-				PEmplace(position + i, value);
-			return result;
+			DataType copy(value);
+			Ptr gap = POpenGap(offset, count);
+			for (SIZE_T i = 0; i < count; ++i)
+				m_Allocator.Construct(&gap[i], copy);
+			return Iterator(gap);
 		}
 
 		template<typename InputIt>
 		Iterator PInsert(ConstIterator position, InputIt first, InputIt last)
 		{
-			SIZE_T count = last - first;
-			SIZE_T currentPos = position - Begin();
-			Reserve(m_Size + count);
-			Iterator result = Begin() + currentPos;
-			for (SIZE_T i = m_Size; i > currentPos; --i)
-				PEmplaceBack(std::move(operator[](i - 1)));
-			for (SIZE_T i = 0; i < count; ++i)
-				PEmplace(position + i, *(first + i));
-			return result;
-		}
+			const SIZE_T offset = position.Ptr() - m_Data;
+			const SIZE_T count = static_cast<SIZE_T>(last - first);
+			if (count == 0)
+				return Iterator(m_Data + offset);
 
-		Iterator PInsert(ConstIterator position, const std::initializer_list<DataType>& list)
-		{
-			SIZE_T currentPos = position - Begin();
-			Reserve(m_Size + list.size());
-			Iterator result = Begin() + currentPos;
-			for (SIZE_T i = m_Size; i > currentPos; --i)
-				PEmplaceBack(std::move(operator[](i - 1)));
-			for (SIZE_T i = 0; i < list.size(); ++i)
-				PEmplace(position + i, list.size() + i);
-			return result;
+			Ptr gap = POpenGap(offset, count);
+			for (SIZE_T i = 0; i < count; ++i, ++first)
+				m_Allocator.Construct(&gap[i], *first);
+			return Iterator(gap);
 		}
 
 		void PPopBack()
@@ -640,62 +671,30 @@ namespace ME::Core
 			}
 		}
 
-		Iterator PErase(Iterator it)
+		Iterator PErase(SIZE_T offset, SIZE_T count)
 		{
-			Ptr wherePtr = it.m_Ptr;
-
-			for (Ptr pos = wherePtr; pos < m_Data + m_Size - 1; ++pos)
-				*pos = std::move(*(pos + 1));
-
-			m_Allocator.Destroy(m_Data + m_Size - 1);
-
-			--m_Size;
-
-			return Iterator(wherePtr);
-		}
+			if (count == 0)
+				return Iterator(m_Data + offset);
 
-		Iterator PErase(ConstIterator it)
-		{
-			Ptr wherePtr = it.Ptr();
-
-			for (Ptr pos = wherePtr; pos < m_Data + m_Size - 1; ++pos)
-				*pos = std::move(*(pos + 1));
-
-			m_Allocator.Destroy(m_Data + m_Size - 1);
-
-			--m_Size;
-
-			return Iterator(wherePtr);
-		}
-
-		Iterator PErase(Iterator first, Iterator last)
-		{
-			SIZE_T pos = first - Begin();
-			SIZE_T count = last - first;
-
-			for (SIZE_T i = pos; i < pos + count; ++i)
-				m_Allocator.Destroy(m_Data + i);
-
-			for (SIZE_T i = pos + count; i < m_Size; ++i)
-				m_Data[pos + (i - (pos + count))] = std::move(m_Data[i]);
-
-			m_Size -= count;
-			return Begin() + pos;
-		}
-
-		Iterator PErase(ConstIterator first, ConstIterator last)
-		{
-			SIZE_T pos = first - Begin();
-			SIZE_T count = last - first;
-
-			for (SIZE_T i = pos; i < pos + count; ++i)
-				m_Allocator.Destroy(m_Data + i);
-
-			for (SIZE_T i = pos + count; i < m_Size; ++i)
-				m_Data[pos + (i - (pos + count))] = std::move(m_Data[i]);
+			if constexpr (IsRelocatable)
+			{
+				if constexpr (!std::is_trivially_destructible_v<DataType>)
+				{
+					for (SIZE_T i = offset; i < offset + count; ++i)
+						m_Allocator.Destroy(m_Data + i);
+				}
+				Relocate(m_Data + offset, m_Data + offset + count, m_Size - offset - count);
+			}
+			else
+			{
+				for (SIZE_T i = offset + count; i < m_Size; ++i)
+					m_Data[i - count] = std::move(m_Data[i]);
+				for (SIZE_T i = m_Size - count; i < m_Size; ++i)
+					m_Allocator.Destroy(m_Data + i);
+			}
 
 			m_Size -= count;
-			return Begin() + pos;
+			return Iterator(m_Data + offset);
 		}
 
 		bool PReserve(SIZE_T size)
@@ -708,44 +707,70 @@ namespace ME::Core
 			return true;
 		}
 
-		void PShrink()
+		void PResize(SIZE_T size)
 		{
-			if constexpr(!std::is_trivially_destructible_v<T>)
-				for (SIZE_T i = m_Size; i < m_Capacity; ++i)
-    			    m_Allocator.Destroy(&m_Data[i]);
-			m_Allocator.Deallocate(m_Data + m_Size, m_Capacity - m_Size);
-			m_Capacity = m_Size;
-			m_Data = m_Capacity <= 0 ? nullptr : m_Data;
+			if (size < m_Size)
+			{
+				if constexpr (!std::is_trivially_destructible_v<DataType>)
+				{
+					for (SIZE_T i = size; i < m_Size; ++i)
+						m_Allocator.Destroy(&m_Data[i]);
+				}
+				m_Size = size;
+				return;
+			}
+
+			if (size > m_Capacity)
+				Allocate(size);
+			for (SIZE_T i = m_Size; i < size; ++i)
+				m_Allocator.Construct(&m_Data[i]);
+			m_Size = size;
+		}
+
+		void PShrinkToFit()
+		{
+			if (m_Size == m_Capacity)
+				return;
+
+			if (m_Size == 0)
+				Deallocate();
+			else
+				Allocate(m_Size);
 		}
 
 		void PAppend(const Array& array)
 		{
-			SIZE_T new_size = m_Size + array.Size();
-			if (new_size > m_Capacity) {
-				Allocate(ME::Core::Algorithm::Max(m_Capacity * ARR_RESIZE_MULTIPLYER, new_size));
-			}
+			if (array.m_Size == 0)
+				return;
 
-			for (SIZE_T i = 0; i < array.Size(); ++i) {
-				m_Allocator.Construct(&m_Data[m_Size + i], array.m_Data[i]);
+			if (m_Size + array.m_Size > m_Capacity)
+			{
+				// 'array' may be this array, keep its old block alive until the copy is done
+				Array copy = &array == this ? array : Array();
+				const Array& source = &array == this ? copy : array;
+				Allocate(GrowCapacity(m_Size + source.m_Size));
+				CopyConstruct(m_Data + m_Size, source.m_Data, source.m_Size);
+				m_Size += source.m_Size;
+				return;
 			}
-			m_Size = new_size;
+
+			CopyConstruct(m_Data + m_Size, array.m_Data, array.m_Size);
+			m_Size += array.m_Size;
 		}
 
 		void PAppend(Array&& array)
 		{
-			SIZE_T new_size = m_Size + array.Size();
-			if (new_size > m_Capacity) {
-				Allocate(ME::Core::Algorithm::Max(m_Capacity * ARR_RESIZE_MULTIPLYER, new_size));
-			}
+			if (&array == this || array.m_Size == 0)
+				return PAppend(static_cast<const Array&>(array));
 
-			for (SIZE_T i = 0; i < array.Size(); ++i) {
-				m_Allocator.Construct(&m_Data[m_Size + i], std::move(array.m_Data[i]));
-			}
+			if (m_Size + array.m_Size > m_Capacity)
+				Allocate(GrowCapacity(m_Size + array.m_Size));
+
+			Relocate(m_Data + m_Size, array.m_Data, array.m_Size);
+			m_Size += array.m_Size;
 
-			m_Size = new_size;
 			array.m_Size = 0;
-			array.m_Capacity = 0;
-			array.m_Data = nullptr;
+			array.Deallocate();
 		}
 
 	private:
@@ -0,0 +1,895 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Utility/Logging/Logger.hpp"
+
+#include <algorithm>
+
+// Target node size. A few cache lines per node keeps the search inside a node cheap
+// while the fan-out keeps the tree shallow
+constexpr SIZE_T BTREE_NODE_SIZE = 256;
+constexpr SIZE_T BTREE_MIN_NODE_CAPACITY = 8;
+
+namespace ME::Core
+{
+	// Leaves hold the elements in order and are linked both ways, so a full walk never touches the inner nodes
+	template<class SlotType>
+	struct BTreeLeaf
+	{
+		static constexpr SIZE_T Capacity = BTREE_NODE_SIZE / sizeof(SlotType) > BTREE_MIN_NODE_CAPACITY
+			? BTREE_NODE_SIZE / sizeof(SlotType) : BTREE_MIN_NODE_CAPACITY;
+
+		SIZE_T Count;
+		BTreeLeaf* Previous;
+		BTreeLeaf* Next;
+		// One spare slot so a full leaf can take the new element before it gets split
+		alignas(SlotType) uint8 Slots[(Capacity + 1) * sizeof(SlotType)];
+
+		inline SlotType* Data() { return reinterpret_cast<SlotType*>(Slots); }
+		inline const SlotType* Data() const { return reinterpret_cast<const SlotType*>(Slots); }
+	};
+
+	// Children[i] holds keys below Keys[i], Children[i + 1] holds keys equal to or above it
+	template<class KeyType>
+	struct BTreeInner
+	{
+		static constexpr SIZE_T Capacity = BTREE_NODE_SIZE / (sizeof(KeyType) + sizeof(void*)) > BTREE_MIN_NODE_CAPACITY
+			? BTREE_NODE_SIZE / (sizeof(KeyType) + sizeof(void*)) : BTREE_MIN_NODE_CAPACITY;
+
+		SIZE_T Count;
+		alignas(KeyType) uint8 KeySlots[(Capacity + 1) * sizeof(KeyType)];
+		void* Children[Capacity + 2];
+
+		inline KeyType* Keys() { return reinterpret_cast<KeyType*>(KeySlots); }
+		inline const KeyType* Keys() const { return reinterpret_cast<const KeyType*>(KeySlots); }
+	};
+
+	template<typename _Tree>
+	class BTreeIterator
+	{
+	public:
+		using DataType = typename _Tree::SlotType;
+		using LeafType = typename _Tree::LeafType;
+		using RefType = DataType&;
+
+	public:
+		BTreeIterator() : m_Leaf(nullptr), m_Index(0) {}
+		BTreeIterator(LeafType* leaf, SIZE_T index) : m_Leaf(leaf), m_Index(index) {}
+
+	public:
+		BTreeIterator& operator++()
+		{
+			if (++m_Index == m_Leaf->Count)
+			{
+				m_Leaf = m_Leaf->Next;
+				m_Index = 0;
+			}
+			return *this;
+		}
+
+		BTreeIterator operator++(int)
+		{
+			BTreeIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		// End() has no leaf to step back from, decrement only valid iterators
+		BTreeIterator& operator--()
+		{
+			ME_ASSERT(m_Leaf != nullptr, "Can't decrement the end iterator of a BTree!");
+			if (m_Index == 0)
+			{
+				m_Leaf = m_Leaf->Previous;
+				m_Index = m_Leaf ? m_Leaf->Count - 1 : 0;
+			}
+			else
+				--m_Index;
+			return *this;
+		}
+
+		BTreeIterator operator--(int)
+		{
+			BTreeIterator temp = *this;
+			--(*this);
+			return temp;
+		}
+
+		bool operator==(const BTreeIterator& it) const
+		{
+			return m_Leaf == it.m_Leaf && m_Index == it.m_Index;
+		}
+
+		bool operator!=(const BTreeIterator& it) const
+		{
+			return !(*this == it);
+		}
+
+		DataType* operator->() const
+		{
+			return &m_Leaf->Data()[m_Index];
+		}
+
+		RefType operator*() const
+		{
+			return m_Leaf->Data()[m_Index];
+		}
+
+	private:
+		LeafType* m_Leaf;
+		SIZE_T m_Index;
+	};
+
+	// B+ tree shared by BTreeMap and BTreeSet. KeyOf::Get extracts the key from a stored slot
+	template<class keyType, class slotType, class KeyOf, class allocator>
+	class BTree
+	{
+	public:
+		using KeyType = keyType;
+		using SlotType = slotType;
+
+		using LeafType = BTreeLeaf<SlotType>;
+		using InnerType = BTreeInner<KeyType>;
+
+		using LeafAllocatorType = typename allocator::template Rebind<LeafType>::Other;
+		using InnerAllocatorType = typename allocator::template Rebind<InnerType>::Other;
+
+		using Iterator = BTreeIterator<BTree>;
+
+		static constexpr SIZE_T LeafCapacity = LeafType::Capacity;
+		static constexpr SIZE_T InnerCapacity = InnerType::Capacity;
+
+	private:
+		static constexpr SIZE_T MinLeafCount = LeafCapacity / 2;
+		static constexpr SIZE_T MinInnerCount = InnerCapacity / 2;
+		// Inner nodes keep at least four children, 4^32 elements is way past anything addressable
+		static constexpr SIZE_T MaxDepth = 32;
+
+		struct PathEntry
+		{
+			InnerType* Node;
+			SIZE_T Index;
+		};
+
+	public:
+		BTree() noexcept
+			: m_Root(nullptr), m_First(nullptr), m_Last(nullptr), m_Height(0), m_Size(0)
+		{
+		}
+
+		BTree(const BTree& other)
+			: BTree()
+		{
+			CopyFrom(other);
+		}
+
+		BTree(BTree&& other) noexcept
+			: BTree()
+		{
+			TakeFrom(other);
+		}
+
+		~BTree()
+		{
+			Clear();
+		}
+
+	public:
+		BTree& operator=(const BTree& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				CopyFrom(other);
+			}
+			return *this;
+		}
+
+		BTree& operator=(BTree&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				TakeFrom(other);
+			}
+			return *this;
+		}
+
+	public:
+		inline Iterator Find(const KeyType& key)
+		{
+			if (!m_Root)
+				return End();
+
+			LeafType* leaf = FindLeaf(key);
+			const SIZE_T index = LeafLowerBound(leaf, key);
+			if (index < leaf->Count && !(key < KeyOf::Get(leaf->Data()[index])))
+				return Iterator(leaf, index);
+			return End();
+		}
+
+		ME_NODISCARD inline bool Contains(const KeyType& key)
+		{
+			return Find(key) != End();
+		}
+
+		// First element whose key is not below 'key'
+		inline Iterator LowerBound(const KeyType& key)
+		{
+			if (!m_Root)
+				return End();
+
+			LeafType* leaf = FindLeaf(key);
+			const SIZE_T index = LeafLowerBound(leaf, key);
+			if (index < leaf->Count)
+				return Iterator(leaf, index);
+			return Iterator(leaf->Next, 0);
+		}
+
+		// Returns false if the key wasn't there
+		bool Erase(const KeyType& key)
+		{
+			if (!m_Root)
+				return false;
+
+			PathEntry path[MaxDepth];
+			LeafType* leaf = FindLeaf(key, path);
+			const SIZE_T index = LeafLowerBound(leaf, key);
+			if (index == leaf->Count || key < KeyOf::Get(leaf->Data()[index]))
+				return false;
+
+			SlotType* slots = leaf->Data();
+			m_LeafAllocator.Destroy(&slots[index]);
+			Relocate(slots + index, slots + index + 1, leaf->Count - index - 1);
+			leaf->Count--;
+			m_Size--;
+
+			RebalanceLeaf(leaf, path);
+			return true;
+		}
+
+		void Clear()
+		{
+			if (m_Root)
+				FreeNode(m_Root, m_Height);
+
+			m_Root = nullptr;
+			m_First = nullptr;
+			m_Last = nullptr;
+			m_Height = 0;
+			m_Size = 0;
+		}
+
+		ME_NODISCARD inline SIZE_T Size() const
+		{
+			return m_Size;
+		}
+
+		ME_NODISCARD inline bool Empty() const
+		{
+			return m_Size == 0;
+		}
+
+		// Number of inner levels above the leaves
+		ME_NODISCARD inline SIZE_T Height() const
+		{
+			return m_Height;
+		}
+
+		inline Iterator begin()
+		{
+			return Begin();
+		}
+
+		inline Iterator end()
+		{
+			return End();
+		}
+
+		inline Iterator Begin()
+		{
+			return m_First ? Iterator(m_First, 0) : End();
+		}
+
+		inline Iterator End()
+		{
+			return Iterator(nullptr, 0);
+		}
+
+		ME_NODISCARD inline SlotType& Front()
+		{
+			return m_First->Data()[0];
+		}
+
+		ME_NODISCARD inline SlotType& Back()
+		{
+			return m_Last->Data()[m_Last->Count - 1];
+		}
+
+	protected:
+		// Finds 'key' or constructs a new slot for it from 'args'. 'inserted' tells which one happened
+		template<class... Args>
+		SlotType* PEmplace(const KeyType& key, bool& inserted, Args&&... args)
+		{
+			if (!m_Root)
+			{
+				m_First = m_Last = AllocateLeaf();
+				m_Root = m_First;
+			}
+
+			PathEntry path[MaxDepth];
+			LeafType* leaf = FindLeaf(key, path);
+			SlotType* slots = leaf->Data();
+			const SIZE_T index = LeafLowerBound(leaf, key);
+			if (index < leaf->Count && !(key < KeyOf::Get(slots[index])))
+			{
+				inserted = false;
+				return &slots[index];
+			}
+
+			// Construct aside first, the arguments may refer to elements which are about to move
+			alignas(SlotType) uint8 buffer[sizeof(SlotType)];
+			SlotType* value = reinterpret_cast<SlotType*>(buffer);
+			m_LeafAllocator.Construct(value, std::forward<Args>(args)...);
+
+			Relocate(slots + index + 1, slots + index, leaf->Count - index);
+			Relocate(slots + index, value, 1);
+			leaf->Count++;
+			m_Size++;
+			inserted = true;
+
+			if (leaf->Count <= LeafCapacity)
+				return &slots[index];
+			return SplitLeaf(leaf, index, path);
+		}
+
+		// Adds a batch of elements. Later duplicates win, like repeated inserts would.
+		// Sorts the batch and rebuilds the tree bottom-up unless the batch is small next to the tree
+		template<class Overwrite>
+		void PInsertBulk(Array<SlotType>& batch, Overwrite overwrite)
+		{
+			if (batch.Empty())
+				return;
+
+			SlotType* data = batch.Data();
+			std::stable_sort(data, data + batch.Size(), [](const SlotType& a, const SlotType& b)
+			{
+				return KeyOf::Get(a) < KeyOf::Get(b);
+			});
+
+			if (m_Size > 0 && batch.Size() * 8 < m_Size)
+			{
+				// Only constructs from the argument when the key is new, so it is still intact otherwise
+				for (SIZE_T i = 0; i < batch.Size(); i++)
+				{
+					bool inserted = false;
+					SlotType* slot = PEmplace(KeyOf::Get(data[i]), inserted, std::move(data[i]));
+					if (!inserted)
+						overwrite(*slot, std::move(data[i]));
+				}
+				return;
+			}
+
+			// Merge the current content with the batch, the batch wins ties
+			Array<SlotType> current;
+			ExtractTo(current);
+
+			Array<SlotType> sorted;
+			sorted.Reserve(batch.Size() + current.Size());
+
+			SIZE_T i = 0, j = 0;
+			while (i < current.Size() || j < batch.Size())
+			{
+				if (j < batch.Size())
+				{
+					// Skip to the last of equal keys inside the batch
+					while (j + 1 < batch.Size() && !(KeyOf::Get(data[j]) < KeyOf::Get(data[j + 1])))
+						j++;
+				}
+
+				if (j == batch.Size() || (i < current.Size() && KeyOf::Get(current[i]) < KeyOf::Get(data[j])))
+					sorted.EmplaceBack(std::move(current[i++]));
+				else
+				{
+					if (i < current.Size() && !(KeyOf::Get(data[j]) < KeyOf::Get(current[i])))
+						i++;
+					sorted.EmplaceBack(std::move(data[j++]));
+				}
+			}
+
+			Build(sorted);
+		}
+
+	private:
+		// Both searches halve the range without branching on the comparison, which the compiler turns into
+		// conditional moves. Nodes are small enough that mispredictions cost more than the extra compares
+		inline static SIZE_T LeafLowerBound(const LeafType* leaf, const KeyType& key)
+		{
+			const SlotType* slots = leaf->Data();
+			const SlotType* base = slots;
+			SIZE_T length = leaf->Count;
+			if (length == 0)
+				return 0;
+
+			while (length > 1)
+			{
+				const SIZE_T half = length / 2;
+				base = KeyOf::Get(base[half]) < key ? base + half : base;
+				length -= half;
+			}
+			return (base - slots) + (KeyOf::Get(*base) < key);
+		}
+
+		// Index of the child which may hold 'key'
+		inline static SIZE_T InnerUpperBound(const InnerType* inner, const KeyType& key)
+		{
+			const KeyType* keys = inner->Keys();
+			const KeyType* base = keys;
+			SIZE_T length = inner->Count;
+
+			while (length > 1)
+			{
+				const SIZE_T half = length / 2;
+				base = key < base[half] ? base : base + half;
+				length -= half;
+			}
+			return (base - keys) + !(key < *base);
+		}
+
+		LeafType* FindLeaf(const KeyType& key, PathEntry* path = nullptr) const
+		{
+			void* node = m_Root;
+			for (SIZE_T depth = 0; depth < m_Height; depth++)
+			{
+				InnerType* inner = static_cast<InnerType*>(node);
+				const SIZE_T index = InnerUpperBound(inner, key);
+				if (path)
+					path[depth] = { inner, index };
+				node = inner->Children[index];
+			}
+			return static_cast<LeafType*>(node);
+		}
+
+		// Moves live objects into uninitialized memory, ranges may overlap in either direction
+		template<class T>
+		void Relocate(T* destination, T* source, SIZE_T count)
+		{
+			if (count == 0 || destination == source)
+				return;
+
+			if constexpr (Memory::IsTriviallyRelocatable<T>)
+				memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+			else if (destination > source)
+			{
+				for (SIZE_T i = count; i > 0; i--)
+				{
+					m_LeafAllocator.Construct(&destination[i - 1], std::move(source[i - 1]));
+					m_LeafAllocator.Destroy(&source[i - 1]);
+				}
+			}
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+				{
+					m_LeafAllocator.Construct(&destination[i], std::move(source[i]));
+					m_LeafAllocator.Destroy(&source[i]);
+				}
+			}
+		}
+
+		template<class T>
+		void MoveConstruct(T* destination, T* source, SIZE_T count)
+		{
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				if (count > 0)
+					memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+			}
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+					m_LeafAllocator.Construct(&destination[i], std::move(source[i]));
+			}
+		}
+
+		inline static void MoveChildren(void** destination, void** source, SIZE_T count)
+		{
+			if (count > 0)
+				memmove(destination, source, count * sizeof(void*));
+		}
+
+		LeafType* AllocateLeaf()
+		{
+			LeafType* leaf = m_LeafAllocator.Allocate(1);
+			leaf->Count = 0;
+			leaf->Previous = nullptr;
+			leaf->Next = nullptr;
+			return leaf;
+		}
+
+		InnerType* AllocateInner()
+		{
+			InnerType* inner = m_InnerAllocator.Allocate(1);
+			inner->Count = 0;
+			return inner;
+		}
+
+		void FreeNode(void* node, SIZE_T level)
+		{
+			if (level == 0)
+			{
+				LeafType* leaf = static_cast<LeafType*>(node);
+				if constexpr (!std::is_trivially_destructible_v<SlotType>)
+				{
+					for (SIZE_T i = 0; i < leaf->Count; i++)
+						m_LeafAllocator.Destroy(&leaf->Data()[i]);
+				}
+				m_LeafAllocator.Deallocate(leaf, 1);
+				return;
+			}
+
+			InnerType* inner = static_cast<InnerType*>(node);
+			for (SIZE_T i = 0; i <= inner->Count; i++)
+				FreeNode(inner->Children[i], level - 1);
+			if constexpr (!std::is_trivially_destructible_v<KeyType>)
+			{
+				for (SIZE_T i = 0; i < inner->Count; i++)
+					m_LeafAllocator.Destroy(&inner->Keys()[i]);
+			}
+			m_InnerAllocator.Deallocate(inner, 1);
+		}
+
+		// 'leaf' holds LeafCapacity + 1 elements, the new one at 'index'. Returns where it ended up
+		SlotType* SplitLeaf(LeafType* leaf, SIZE_T index, PathEntry* path)
+		{
+			// Appending to the last leaf or prepending to the first one leaves the old leaf full,
+			// so ascending or descending keys (like recycled entity IDs) don't leave half empty leaves behind
+			SIZE_T keep = leaf->Count / 2;
+			if (leaf == m_Last && index == leaf->Count - 1)
+				keep = leaf->Count - 1;
+			else if (leaf == m_First && index == 0)
+				keep = 1;
+
+			LeafType* right = AllocateLeaf();
+			Relocate(right->Data(), leaf->Data() + keep, leaf->Count - keep);
+			right->Count = leaf->Count - keep;
+			leaf->Count = keep;
+
+			right->Previous = leaf;
+			right->Next = leaf->Next;
+			if (leaf->Next)
+				leaf->Next->Previous = right;
+			else
+				m_Last = right;
+			leaf->Next = right;
+
+			InsertIntoParent(path, leaf, KeyType(KeyOf::Get(right->Data()[0])), right);
+			return index < keep ? &leaf->Data()[index] : &right->Data()[index - keep];
+		}
+
+		// Hooks 'right' in next to the freshly split 'left', splitting the parents as needed
+		void InsertIntoParent(PathEntry* path, void* left, KeyType separator, void* right)
+		{
+			SIZE_T depth = m_Height;
+			while (depth > 0)
+			{
+				--depth;
+				InnerType* parent = path[depth].Node;
+				const SIZE_T index = path[depth].Index;
+				KeyType* keys = parent->Keys();
+
+				Relocate(keys + index + 1, keys + index, parent->Count - index);
+				m_LeafAllocator.Construct(&keys[index], std::move(separator));
+				MoveChildren(parent->Children + index + 2, parent->Children + index + 1, parent->Count - index);
+				parent->Children[index + 1] = right;
+				parent->Count++;
+
+				if (parent->Count <= InnerCapacity)
+					return;
+
+				// The middle key moves up, everything after it goes to the new node
+				const SIZE_T middle = parent->Count / 2;
+				InnerType* sibling = AllocateInner();
+				sibling->Count = parent->Count - middle - 1;
+				Relocate(sibling->Keys(), keys + middle + 1, sibling->Count);
+				MoveChildren(sibling->Children, parent->Children + middle + 1, sibling->Count + 1);
+
+				separator = std::move(keys[middle]);
+				m_LeafAllocator.Destroy(&keys[middle]);
+				parent->Count = middle;
+
+				left = parent;
+				right = sibling;
+			}
+
+			InnerType* root = AllocateInner();
+			m_LeafAllocator.Construct(&root->Keys()[0], std::move(separator));
+			root->Children[0] = left;
+			root->Children[1] = right;
+			root->Count = 1;
+			m_Root = root;
+			m_Height++;
+		}
+
+		// Drops key 'index' and the child right of it
+		void RemoveFromInner(InnerType* inner, SIZE_T index)
+		{
+			KeyType* keys = inner->Keys();
+			m_LeafAllocator.Destroy(&keys[index]);
+			Relocate(keys + index, keys + index + 1, inner->Count - index - 1);
+			MoveChildren(inner->Children + index + 1, inner->Children + index + 2, inner->Count - index - 1);
+			inner->Count--;
+		}
+
+		void RebalanceLeaf(LeafType* leaf, PathEntry* path)
+		{
+			if (m_Height == 0)
+			{
+				if (leaf->Count == 0)
+				{
+					m_LeafAllocator.Deallocate(leaf, 1);
+					m_Root = m_First = m_Last = nullptr;
+				}
+				return;
+			}
+
+			if (leaf->Count >= MinLeafCount)
+				return;
+
+			InnerType* parent = path[m_Height - 1].Node;
+			const SIZE_T index = path[m_Height - 1].Index;
+			LeafType* left = index > 0 ? static_cast<LeafType*>(parent->Children[index - 1]) : nullptr;
+			LeafType* right = index < parent->Count ? static_cast<LeafType*>(parent->Children[index + 1]) : nullptr;
+
+			if (left && left->Count > MinLeafCount)
+			{
+				Relocate(leaf->Data() + 1, leaf->Data(), leaf->Count);
+				Relocate(leaf->Data(), left->Data() + left->Count - 1, 1);
+				left->Count--;
+				leaf->Count++;
+				parent->Keys()[index - 1] = KeyOf::Get(leaf->Data()[0]);
+				return;
+			}
+
+			if (right && right->Count > MinLeafCount)
+			{
+				Relocate(leaf->Data() + leaf->Count, right->Data(), 1);
+				Relocate(right->Data(), right->Data() + 1, right->Count - 1);
+				right->Count--;
+				leaf->Count++;
+				parent->Keys()[index] = KeyOf::Get(right->Data()[0]);
+				return;
+			}
+
+			if (left)
+			{
+				MergeLeaves(left, leaf);
+				RemoveFromInner(parent, index - 1);
+			}
+			else
+			{
+				MergeLeaves(leaf, right);
+				RemoveFromInner(parent, index);
+			}
+
+			RebalanceInner(path, m_Height - 1);
+		}
+
+		void MergeLeaves(LeafType* left, LeafType* right)
+		{
+			Relocate(left->Data() + left->Count, right->Data(), right->Count);
+			left->Count += right->Count;
+
+			left->Next = right->Next;
+			if (right->Next)
+				right->Next->Previous = left;
+			else
+				m_Last = left;
+
+			m_LeafAllocator.Deallocate(right, 1);
+		}
+
+		// Fixes up path[depth].Node after it lost a child, walking up as long as nodes get merged
+		void RebalanceInner(PathEntry* path, SIZE_T depth)
+		{
+			InnerType* node = path[depth].Node;
+			while (depth > 0)
+			{
+				if (node->Count >= MinInnerCount)
+					return;
+
+				InnerType* parent = path[depth - 1].Node;
+				const SIZE_T index = path[depth - 1].Index;
+				KeyType* parentKeys = parent->Keys();
+				InnerType* left = index > 0 ? static_cast<InnerType*>(parent->Children[index - 1]) : nullptr;
+				InnerType* right = index < parent->Count ? static_cast<InnerType*>(parent->Children[index + 1]) : nullptr;
+
+				if (left && left->Count > MinInnerCount)
+				{
+					// Rotate through the parent, the separator comes down and left's last key goes up
+					KeyType* keys = node->Keys();
+					Relocate(keys + 1, keys, node->Count);
+					m_LeafAllocator.Construct(&keys[0], std::move(parentKeys[index - 1]));
+					MoveChildren(node->Children + 1, node->Children, node->Count + 1);
+					node->Children[0] = left->Children[left->Count];
+					node->Count++;
+
+					parentKeys[index - 1] = std::move(left->Keys()[left->Count - 1]);
+					m_LeafAllocator.Destroy(&left->Keys()[left->Count - 1]);
+					left->Count--;
+					return;
+				}
+
+				if (right && right->Count > MinInnerCount)
+				{
+					m_LeafAllocator.Construct(&node->Keys()[node->Count], std::move(parentKeys[index]));
+					node->Children[node->Count + 1] = right->Children[0];
+					node->Count++;
+
+					KeyType* rightKeys = right->Keys();
+					parentKeys[index] = std::move(rightKeys[0]);
+					m_LeafAllocator.Destroy(&rightKeys[0]);
+					Relocate(rightKeys, rightKeys + 1, right->Count - 1);
+					MoveChildren(right->Children, right->Children + 1, right->Count);
+					right->Count--;
+					return;
+				}
+
+				if (left)
+					MergeInner(left, node, parent, index - 1);
+				else
+					MergeInner(node, right, parent, index);
+
+				node = parent;
+				depth--;
+			}
+
+			// The root ran out of keys, its only child takes over
+			if (node->Count == 0)
+			{
+				m_Root = node->Children[0];
+				m_InnerAllocator.Deallocate(node, 1);
+				m_Height--;
+			}
+		}
+
+		void MergeInner(InnerType* left, InnerType* right, InnerType* parent, SIZE_T separator)
+		{
+			KeyType* keys = left->Keys();
+			m_LeafAllocator.Construct(&keys[left->Count], std::move(parent->Keys()[separator]));
+			Relocate(keys + left->Count + 1, right->Keys(), right->Count);
+			MoveChildren(left->Children + left->Count + 1, right->Children, right->Count + 1);
+			left->Count += right->Count + 1;
+
+			m_InnerAllocator.Deallocate(right, 1);
+			RemoveFromInner(parent, separator);
+		}
+
+		// Builds the tree from sorted unique elements, which are left moved-from. Expects an empty tree
+		void Build(Array<SlotType>& sorted)
+		{
+			const SIZE_T count = sorted.Size();
+			if (count == 0)
+				return;
+
+			// Spread evenly so that every node but a lone root stays at least half full
+			const SIZE_T leafCount = (count + LeafCapacity - 1) / LeafCapacity;
+			Array<void*> nodes;
+			Array<KeyType> lowKeys;
+			nodes.Reserve(leafCount);
+			lowKeys.Reserve(leafCount);
+
+			SIZE_T offset = 0;
+			LeafType* previous = nullptr;
+			for (SIZE_T i = 0; i < leafCount; i++)
+			{
+				const SIZE_T size = count / leafCount + (i < count % leafCount ? 1 : 0);
+				LeafType* leaf = AllocateLeaf();
+				MoveConstruct(leaf->Data(), sorted.Data() + offset, size);
+				leaf->Count = size;
+				offset += size;
+
+				leaf->Previous = previous;
+				if (previous)
+					previous->Next = leaf;
+				else
+					m_First = leaf;
+				previous = leaf;
+
+				nodes.EmplaceBack(leaf);
+				lowKeys.EmplaceBack(KeyOf::Get(leaf->Data()[0]));
+			}
+			m_Last = previous;
+
+			SIZE_T height = 0;
+			while (nodes.Size() > 1)
+			{
+				const SIZE_T parentCount = (nodes.Size() + InnerCapacity) / (InnerCapacity + 1);
+				Array<void*> parents;
+				Array<KeyType> parentLowKeys;
+				parents.Reserve(parentCount);
+				parentLowKeys.Reserve(parentCount);
+
+				SIZE_T child = 0;
+				for (SIZE_T i = 0; i < parentCount; i++)
+				{
+					const SIZE_T children = nodes.Size() / parentCount + (i < nodes.Size() % parentCount ? 1 : 0);
+					InnerType* inner = AllocateInner();
+					inner->Children[0] = nodes[child];
+					for (SIZE_T c = 1; c < children; c++)
+					{
+						m_LeafAllocator.Construct(&inner->Keys()[c - 1], std::move(lowKeys[child + c]));
+						inner->Children[c] = nodes[child + c];
+					}
+					inner->Count = children - 1;
+
+					parents.EmplaceBack(inner);
+					parentLowKeys.EmplaceBack(std::move(lowKeys[child]));
+					child += children;
+				}
+
+				nodes = std::move(parents);
+				lowKeys = std::move(parentLowKeys);
+				height++;
+			}
+
+			m_Root = nodes[0];
+			m_Height = height;
+			m_Size = count;
+		}
+
+		// Moves every element out in order and leaves the tree empty
+		void ExtractTo(Array<SlotType>& out)
+		{
+			out.Reserve(out.Size() + m_Size);
+			for (LeafType* leaf = m_First; leaf; leaf = leaf->Next)
+			{
+				for (SIZE_T i = 0; i < leaf->Count; i++)
+					out.EmplaceBack(std::move(leaf->Data()[i]));
+			}
+			Clear();
+		}
+
+		void CopyFrom(const BTree& other)
+		{
+			Array<SlotType> copy;
+			copy.Reserve(other.m_Size);
+			for (const LeafType* leaf = other.m_First; leaf; leaf = leaf->Next)
+			{
+				for (SIZE_T i = 0; i < leaf->Count; i++)
+					copy.EmplaceBack(leaf->Data()[i]);
+			}
+			Build(copy);
+		}
+
+		// Expects an empty tree
+		void TakeFrom(BTree& other)
+		{
+			m_Root = other.m_Root;
+			m_First = other.m_First;
+			m_Last = other.m_Last;
+			m_Height = other.m_Height;
+			m_Size = other.m_Size;
+
+			other.m_Root = nullptr;
+			other.m_First = nullptr;
+			other.m_Last = nullptr;
+			other.m_Height = 0;
+			other.m_Size = 0;
+		}
+
+	private:
+		LeafAllocatorType m_LeafAllocator;
+		InnerAllocatorType m_InnerAllocator;
+
+	private:
+		void* m_Root;
+		LeafType* m_First;
+		LeafType* m_Last;
+
+		SIZE_T m_Height;
+		SIZE_T m_Size;
+	};
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Pair.hpp"
+#include "Core/Containers/BTree.hpp"
+
+namespace ME::Core
+{
+	template<class KeyType, class ValueType>
+	struct BTreeMapKeyOf
+	{
+		static inline const KeyType& Get(const Misc::Pair<KeyType, ValueType>& pair)
+		{
+			return pair.Value1;
+		}
+	};
+
+	// Ordered map on a B+ tree. Same interface as Map, but elements sit next to each other in the leaves,
+	// so lookups touch a few nodes and iteration walks memory in order
+	template <typename keyType, typename valType, class _allocator =
+		Memory::Allocator<Misc::Pair<keyType, valType>>>
+	class BTreeMap : public BTree<keyType, Misc::Pair<keyType, valType>, BTreeMapKeyOf<keyType, valType>, _allocator>
+	{
+	public:
+		using KeyType = keyType;
+		using ValueType = valType;
+
+		using PairType = ME::Core::Misc::Pair<KeyType, ValueType>;
+		using TreeType = BTree<KeyType, PairType, BTreeMapKeyOf<KeyType, ValueType>, _allocator>;
+		using AllocatorType = _allocator;
+
+		using Iterator = typename TreeType::Iterator;
+
+	public:
+		inline ValueType& operator[](const KeyType& key) noexcept
+		{
+			bool inserted = false;
+			return this->PEmplace(key, inserted, key, ValueType())->Value2;
+		}
+
+	public:
+		// Replaces the value if the key is already there
+		inline void Insert(const KeyType& key, const ValueType& value)
+		{
+			bool inserted = false;
+			PairType* pair = this->PEmplace(key, inserted, key, value);
+			if (!inserted)
+				pair->Value2 = value;
+		}
+
+		inline void Insert(KeyType&& key, ValueType&& value)
+		{
+			bool inserted = false;
+			// Only moved from when the key is new
+			PairType* pair = this->PEmplace(key, inserted, std::move(key), std::move(value));
+			if (!inserted)
+				pair->Value2 = std::move(value);
+		}
+
+		// Inserts many pairs at once, later duplicates win. Cheaper than one by one when the batch is large
+		inline void InsertBulk(const PairType* pairs, SIZE_T count)
+		{
+			Array<PairType> batch;
+			batch.Reserve(count);
+			for (SIZE_T i = 0; i < count; i++)
+				batch.EmplaceBack(pairs[i]);
+			InsertBulk(std::move(batch));
+		}
+
+		inline void InsertBulk(Array<PairType>&& pairs)
+		{
+			this->PInsertBulk(pairs, [](PairType& pair, PairType&& other) { pair.Value2 = std::move(other.Value2); });
+		}
+
+		inline ValueType& At(const KeyType& key)
+		{
+			Iterator it = this->Find(key);
+			ME_ASSERT(it != this->End(), "Key not found in BTreeMap");
+			return it->Value2;
+		}
+	};
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/BTree.hpp"
+
+namespace ME::Core
+{
+	template<class KeyType>
+	struct BTreeSetKeyOf
+	{
+		static inline const KeyType& Get(const KeyType& key)
+		{
+			return key;
+		}
+	};
+
+	// Ordered set on a B+ tree, see BTreeMap
+	template <typename valType, class _allocator = Memory::Allocator<valType>>
+	class BTreeSet : public BTree<valType, valType, BTreeSetKeyOf<valType>, _allocator>
+	{
+	public:
+		using ValueType = valType;
+		using TreeType = BTree<ValueType, ValueType, BTreeSetKeyOf<ValueType>, _allocator>;
+		using AllocatorType = _allocator;
+
+		using Iterator = typename TreeType::Iterator;
+
+	public:
+		// Returns false if the value was already there
+		inline bool Insert(const ValueType& value)
+		{
+			bool inserted = false;
+			this->PEmplace(value, inserted, value);
+			return inserted;
+		}
+
+		inline bool Insert(ValueType&& value)
+		{
+			bool inserted = false;
+			this->PEmplace(value, inserted, std::move(value));
+			return inserted;
+		}
+
+		inline void InsertBulk(const ValueType* values, SIZE_T count)
+		{
+			Array<ValueType> batch;
+			batch.Reserve(count);
+			for (SIZE_T i = 0; i < count; i++)
+				batch.EmplaceBack(values[i]);
+			InsertBulk(std::move(batch));
+		}
+
+		inline void InsertBulk(Array<ValueType>&& values)
+		{
+			this->PInsertBulk(values, [](ValueType&, ValueType&&) {});
+		}
+	};
+}
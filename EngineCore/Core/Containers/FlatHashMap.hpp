@@ -0,0 +1,659 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Core/Pair.hpp"
+#include "Core/Memory/Hasher.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#include <emmintrin.h>
+	#define ME_FLAT_MAP_SSE2
+#endif
+
+namespace ME::Core
+{
+	// Control byte layout (Swiss table style):
+	//  - 0x80 (sign bit set) marks an empty slot
+	//  - 0x00..0x7F holds the low 7 bits of the hash (H2) of a full slot
+	// Deletion uses backward shifting, so the table never contains tombstones.
+	namespace FlatMapHelper
+	{
+		typedef int8 ControlByte;
+
+		constexpr ControlByte Empty = static_cast<ControlByte>(-128);
+		constexpr SIZE_T GroupWidth = 16;
+		constexpr SIZE_T MinCapacity = GroupWidth;
+
+		inline SIZE_T H1(SIZE_T hash) { return hash >> 7; }
+		inline ControlByte H2(SIZE_T hash) { return static_cast<ControlByte>(hash & 0x7F); }
+
+		// 16 control bytes loaded at once, matched either with SSE2 or with a scalar loop
+		struct Group
+		{
+		public:
+			explicit Group(const ControlByte* pos)
+			{
+#ifdef ME_FLAT_MAP_SSE2
+				m_Ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+#else
+				memcpy(m_Ctrl, pos, GroupWidth);
+#endif
+			}
+
+			// Bitmask of slots whose control byte equals h2
+			inline uint32 Match(ControlByte h2) const
+			{
+#ifdef ME_FLAT_MAP_SSE2
+				return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_Ctrl, _mm_set1_epi8(h2))));
+#else
+				uint32 mask = 0;
+				for (SIZE_T i = 0; i < GroupWidth; i++)
+					mask |= static_cast<uint32>(m_Ctrl[i] == h2) << i;
+				return mask;
+#endif
+			}
+
+			// Bitmask of empty slots
+			inline uint32 MatchEmpty() const
+			{
+#ifdef ME_FLAT_MAP_SSE2
+				return static_cast<uint32>(_mm_movemask_epi8(m_Ctrl));
+#else
+				uint32 mask = 0;
+				for (SIZE_T i = 0; i < GroupWidth; i++)
+					mask |= static_cast<uint32>(m_Ctrl[i] < 0) << i;
+				return mask;
+#endif
+			}
+
+		private:
+#ifdef ME_FLAT_MAP_SSE2
+			__m128i m_Ctrl;
+#else
+			ControlByte m_Ctrl[GroupWidth];
+#endif
+		};
+	}
+
+	template <typename _Map>
+	class FlatMapIterator
+	{
+	public:
+		using SlotType = typename _Map::SlotType;
+		using ValueType = typename _Map::ReturnType;
+
+	public:
+		FlatMapIterator(const FlatMapHelper::ControlByte* ctrl, SlotType* slots, SIZE_T index, SIZE_T capacity)
+			: m_Ctrl(ctrl), m_Slots(slots), m_Index(index), m_Capacity(capacity)
+		{
+			SkipEmpty();
+		}
+
+		FlatMapIterator& operator++()
+		{
+			++m_Index;
+			SkipEmpty();
+			return *this;
+		}
+
+		FlatMapIterator operator++(int)
+		{
+			FlatMapIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		inline bool operator!=(const FlatMapIterator& it) const
+		{
+			return m_Index != it.m_Index || m_Slots != it.m_Slots;
+		}
+
+		inline bool operator==(const FlatMapIterator& it) const
+		{
+			return m_Index == it.m_Index && m_Slots == it.m_Slots;
+		}
+
+		ValueType* operator->()
+		{
+			return &m_Slots[m_Index];
+		}
+
+		inline ValueType& operator*()
+		{
+			return m_Slots[m_Index];
+		}
+
+		inline SIZE_T Index() const
+		{
+			return m_Index;
+		}
+
+	private:
+		void SkipEmpty()
+		{
+			while (m_Index < m_Capacity && m_Ctrl[m_Index] == FlatMapHelper::Empty)
+				++m_Index;
+		}
+
+	private:
+		const FlatMapHelper::ControlByte* m_Ctrl;
+		SlotType* m_Slots;
+		SIZE_T m_Index;
+		SIZE_T m_Capacity;
+	};
+
+	template <typename _Map>
+	class FlatMapConstIterator
+	{
+	public:
+		using SlotType = typename _Map::SlotType;
+		using ValueType = typename _Map::ReturnType;
+
+	public:
+		FlatMapConstIterator(const FlatMapHelper::ControlByte* ctrl, const SlotType* slots, SIZE_T index, SIZE_T capacity)
+			: m_Ctrl(ctrl), m_Slots(slots), m_Index(index), m_Capacity(capacity)
+		{
+			SkipEmpty();
+		}
+
+		FlatMapConstIterator& operator++()
+		{
+			++m_Index;
+			SkipEmpty();
+			return *this;
+		}
+
+		FlatMapConstIterator operator++(int)
+		{
+			FlatMapConstIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		inline bool operator!=(const FlatMapConstIterator& it) const
+		{
+			return m_Index != it.m_Index || m_Slots != it.m_Slots;
+		}
+
+		inline bool operator==(const FlatMapConstIterator& it) const
+		{
+			return m_Index == it.m_Index && m_Slots == it.m_Slots;
+		}
+
+		const ValueType* operator->() const
+		{
+			return &m_Slots[m_Index];
+		}
+
+		inline const ValueType& operator*() const
+		{
+			return m_Slots[m_Index];
+		}
+
+	private:
+		void SkipEmpty()
+		{
+			while (m_Index < m_Capacity && m_Ctrl[m_Index] == FlatMapHelper::Empty)
+				++m_Index;
+		}
+
+	private:
+		const FlatMapHelper::ControlByte* m_Ctrl;
+		const SlotType* m_Slots;
+		SIZE_T m_Index;
+		SIZE_T m_Capacity;
+	};
+
+	// Open-addressing hash map with contiguous slot storage.
+	// Lookups probe 16 control bytes at a time and only touch slots whose H2 tag matches.
+	template <typename keyType, typename valType, class _hasher = Core::Memory::Hasher<keyType>, class _allocator =
+	          Memory::Allocator<void>>
+	class FlatHashMap
+	{
+	public:
+		using KeyType = keyType;
+		using ValueType = valType;
+
+		using SlotType = ME::Core::Misc::Pair<KeyType, ValueType>;
+
+	public:
+		using ReturnType = SlotType;
+
+		using HasherType = _hasher;
+
+		using AllocatorType = _allocator;
+		using SlotAllocator = AllocatorType::template Rebind<SlotType>::Other;
+		using ControlAllocator = AllocatorType::template Rebind<FlatMapHelper::ControlByte>::Other;
+
+		using Iterator = FlatMapIterator<FlatHashMap>;
+		using ConstIterator = FlatMapConstIterator<FlatHashMap>;
+
+	public:
+		FlatHashMap()
+			: m_Ctrl(nullptr), m_Slots(nullptr), m_NumElements(0), m_Capacity(0),
+			  m_SlotAllocator(SlotAllocator()), m_ControlAllocator(ControlAllocator()), m_Hash(HasherType())
+		{
+		}
+
+		explicit FlatHashMap(SIZE_T initialSize)
+			: FlatHashMap()
+		{
+			PReserve(initialSize);
+		}
+
+		FlatHashMap(const FlatHashMap& other)
+			: m_Ctrl(nullptr), m_Slots(nullptr), m_NumElements(0), m_Capacity(0),
+			  m_SlotAllocator(other.m_SlotAllocator), m_ControlAllocator(other.m_ControlAllocator), m_Hash(other.m_Hash)
+		{
+			CopyFrom(other);
+		}
+
+		FlatHashMap(FlatHashMap&& other) noexcept
+			: m_Ctrl(other.m_Ctrl), m_Slots(other.m_Slots), m_NumElements(other.m_NumElements), m_Capacity(other.m_Capacity),
+			  m_SlotAllocator(std::move(other.m_SlotAllocator)), m_ControlAllocator(std::move(other.m_ControlAllocator)),
+			  m_Hash(std::move(other.m_Hash))
+		{
+			other.m_Ctrl = nullptr;
+			other.m_Slots = nullptr;
+			other.m_NumElements = 0;
+			other.m_Capacity = 0;
+		}
+
+		~FlatHashMap()
+		{
+			DeallocateTable();
+		}
+
+	public:
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other)
+			{
+				DeallocateTable();
+				m_Hash = other.m_Hash;
+				m_SlotAllocator = other.m_SlotAllocator;
+				m_ControlAllocator = other.m_ControlAllocator;
+				CopyFrom(other);
+			}
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				DeallocateTable();
+
+				m_Ctrl = other.m_Ctrl;
+				m_Slots = other.m_Slots;
+				m_NumElements = other.m_NumElements;
+				m_Capacity = other.m_Capacity;
+				m_Hash = std::move(other.m_Hash);
+				m_SlotAllocator = std::move(other.m_SlotAllocator);
+				m_ControlAllocator = std::move(other.m_ControlAllocator);
+
+				other.m_Ctrl = nullptr;
+				other.m_Slots = nullptr;
+				other.m_NumElements = 0;
+				other.m_Capacity = 0;
+			}
+			return *this;
+		}
+
+	public:
+		inline Iterator begin()
+		{
+			return Begin();
+		}
+
+		inline ConstIterator begin() const
+		{
+			return CBegin();
+		}
+
+		inline Iterator Begin()
+		{
+			return Iterator(m_Ctrl, m_Slots, 0, m_Capacity);
+		}
+
+		inline ConstIterator Begin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator cbegin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator CBegin() const
+		{
+			return ConstIterator(m_Ctrl, m_Slots, 0, m_Capacity);
+		}
+
+		inline Iterator end()
+		{
+			return End();
+		}
+
+		inline ConstIterator end() const
+		{
+			return CEnd();
+		}
+
+		inline Iterator End()
+		{
+			return Iterator(m_Ctrl, m_Slots, m_Capacity, m_Capacity);
+		}
+
+		inline ConstIterator End() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator cend() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator CEnd() const
+		{
+			return ConstIterator(m_Ctrl, m_Slots, m_Capacity, m_Capacity);
+		}
+
+	public:
+		inline ValueType& At(const KeyType& key)
+		{
+			SIZE_T index = PFind(key);
+			ME_ASSERT(index != m_Capacity, "Key not found in FlatHashMap");
+			return m_Slots[index].Value2;
+		}
+
+		inline void Insert(const KeyType& key, const ValueType& value)
+		{
+			PInsert(key, value);
+		}
+
+		inline void Insert(KeyType&& key, ValueType&& value)
+		{
+			PInsert(std::move(key), std::move(value));
+		}
+
+		inline Iterator Find(const KeyType& key)
+		{
+			return Iterator(m_Ctrl, m_Slots, PFind(key), m_Capacity);
+		}
+
+		inline ConstIterator Find(const KeyType& key) const
+		{
+			return ConstIterator(m_Ctrl, m_Slots, PFind(key), m_Capacity);
+		}
+
+		void Erase(const KeyType& key)
+		{
+			SIZE_T index = PFind(key);
+			if (index != m_Capacity)
+				EraseAt(index);
+		}
+
+		void Erase(Iterator& iterator)
+		{
+			// End() has no slot to erase
+			if (iterator.Index() != m_Capacity)
+				EraseAt(iterator.Index());
+		}
+
+		inline bool Contains(const KeyType& key) const
+		{
+			return PFind(key) != m_Capacity;
+		}
+
+		inline SIZE_T Size() const
+		{
+			return m_NumElements;
+		}
+
+		inline bool Empty() const
+		{
+			return m_NumElements == 0;
+		}
+
+		inline SIZE_T Capacity() const
+		{
+			return m_Capacity;
+		}
+
+		void Clear()
+		{
+			DestroySlots();
+			if (m_Ctrl)
+				memset(m_Ctrl, FlatMapHelper::Empty, m_Capacity + FlatMapHelper::GroupWidth - 1);
+			m_NumElements = 0;
+		}
+
+		inline bool Reserve(SIZE_T capacity)
+		{
+			return PReserve(capacity);
+		}
+
+	public:
+		ValueType& operator[](const KeyType& key)
+		{
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = PFind(key, hash);
+			if (index != m_Capacity)
+				return m_Slots[index].Value2;
+
+			index = PrepareInsert(hash);
+			m_SlotAllocator.Construct(&m_Slots[index], key, ValueType());
+			return m_Slots[index].Value2;
+		}
+
+	private:
+		template <typename K, typename V>
+		void PInsert(K&& key, V&& value)
+		{
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = PFind(key, hash);
+			if (index != m_Capacity)
+			{
+				m_Slots[index].Value2 = std::forward<V>(value);
+				return;
+			}
+
+			index = PrepareInsert(hash);
+			m_SlotAllocator.Construct(&m_Slots[index], std::forward<K>(key), std::forward<V>(value));
+		}
+
+		inline SIZE_T PFind(const KeyType& key) const
+		{
+			if (m_NumElements == 0) return m_Capacity;
+			return PFind(key, m_Hash(key));
+		}
+
+		// Returns the slot index of the key or m_Capacity when it is missing
+		SIZE_T PFind(const KeyType& key, SIZE_T hash) const
+		{
+			if (m_NumElements == 0) return m_Capacity;
+
+			const SIZE_T mask = m_Capacity - 1;
+			const FlatMapHelper::ControlByte h2 = FlatMapHelper::H2(hash);
+			SIZE_T pos = FlatMapHelper::H1(hash) & mask;
+
+			while (true)
+			{
+				FlatMapHelper::Group group(m_Ctrl + pos);
+				for (uint32 match = group.Match(h2); match != 0; match &= match - 1)
+				{
+					SIZE_T index = (pos + std::countr_zero(match)) & mask;
+					if (m_Slots[index].Value1 == key)
+						return index;
+				}
+				if (group.MatchEmpty() != 0)
+					return m_Capacity;
+				pos = (pos + FlatMapHelper::GroupWidth) & mask;
+			}
+		}
+
+		// Returns a free slot for the hash, growing the table if needed. The control byte is already set
+		SIZE_T PrepareInsert(SIZE_T hash)
+		{
+			if ((m_NumElements + 1) * 8 > m_Capacity * 7)
+				Rehash(m_Capacity == 0 ? FlatMapHelper::MinCapacity : m_Capacity * 2);
+
+			SIZE_T index = FindFirstEmpty(hash);
+			SetCtrl(index, FlatMapHelper::H2(hash));
+			m_NumElements++;
+			return index;
+		}
+
+		SIZE_T FindFirstEmpty(SIZE_T hash) const
+		{
+			const SIZE_T mask = m_Capacity - 1;
+			SIZE_T pos = FlatMapHelper::H1(hash) & mask;
+
+			while (true)
+			{
+				uint32 empty = FlatMapHelper::Group(m_Ctrl + pos).MatchEmpty();
+				if (empty != 0)
+					return (pos + std::countr_zero(empty)) & mask;
+				pos = (pos + FlatMapHelper::GroupWidth) & mask;
+			}
+		}
+
+		// Linear probing lets us pull the following run of slots back instead of leaving a tombstone
+		void EraseAt(SIZE_T index)
+		{
+			const SIZE_T mask = m_Capacity - 1;
+
+			m_SlotAllocator.Destroy(&m_Slots[index]);
+			SetCtrl(index, FlatMapHelper::Empty);
+			m_NumElements--;
+
+			SIZE_T hole = index;
+			SIZE_T next = (hole + 1) & mask;
+			while (m_Ctrl[next] != FlatMapHelper::Empty)
+			{
+				SIZE_T home = FlatMapHelper::H1(m_Hash(m_Slots[next].Value1)) & mask;
+				// Move the element only if the hole lies between its home slot and its current slot
+				if (((next - home) & mask) >= ((next - hole) & mask))
+				{
+					m_SlotAllocator.Construct(&m_Slots[hole], std::move(m_Slots[next].Value1), std::move(m_Slots[next].Value2));
+					m_SlotAllocator.Destroy(&m_Slots[next]);
+					SetCtrl(hole, m_Ctrl[next]);
+					SetCtrl(next, FlatMapHelper::Empty);
+					hole = next;
+				}
+				next = (next + 1) & mask;
+			}
+		}
+
+		bool PReserve(SIZE_T capacity)
+		{
+			SIZE_T required = std::bit_ceil((capacity * 8 + 6) / 7);
+			if (required < FlatMapHelper::MinCapacity)
+				required = FlatMapHelper::MinCapacity;
+			if (required <= m_Capacity)
+				return false;
+
+			Rehash(required);
+			return true;
+		}
+
+	private:
+		inline void SetCtrl(SIZE_T index, FlatMapHelper::ControlByte value)
+		{
+			m_Ctrl[index] = value;
+			// The first GroupWidth - 1 bytes are mirrored past the end so a group load never wraps
+			if (index < FlatMapHelper::GroupWidth - 1)
+				m_Ctrl[m_Capacity + index] = value;
+		}
+
+		void AllocateTable(SIZE_T capacity)
+		{
+			m_Capacity = capacity;
+			m_Ctrl = m_ControlAllocator.Allocate(capacity + FlatMapHelper::GroupWidth - 1);
+			memset(m_Ctrl, FlatMapHelper::Empty, capacity + FlatMapHelper::GroupWidth - 1);
+			m_Slots = m_SlotAllocator.Allocate(capacity);
+		}
+
+		void DeallocateTable()
+		{
+			if (m_Ctrl)
+			{
+				DestroySlots();
+				m_ControlAllocator.Deallocate(m_Ctrl, m_Capacity + FlatMapHelper::GroupWidth - 1);
+				m_SlotAllocator.Deallocate(m_Slots, m_Capacity);
+				m_Ctrl = nullptr;
+				m_Slots = nullptr;
+			}
+			m_NumElements = 0;
+			m_Capacity = 0;
+		}
+
+		void DestroySlots()
+		{
+			if constexpr (!std::is_trivially_destructible_v<SlotType>)
+			{
+				for (SIZE_T i = 0; i < m_Capacity; i++)
+					if (m_Ctrl[i] != FlatMapHelper::Empty)
+						m_SlotAllocator.Destroy(&m_Slots[i]);
+			}
+		}
+
+		void CopyFrom(const FlatHashMap& other)
+		{
+			if (other.m_Capacity == 0)
+				return;
+
+			AllocateTable(other.m_Capacity);
+			memcpy(m_Ctrl, other.m_Ctrl, m_Capacity + FlatMapHelper::GroupWidth - 1);
+			for (SIZE_T i = 0; i < m_Capacity; i++)
+				if (m_Ctrl[i] != FlatMapHelper::Empty)
+					m_SlotAllocator.Construct(&m_Slots[i], other.m_Slots[i].Value1, other.m_Slots[i].Value2);
+			m_NumElements = other.m_NumElements;
+		}
+
+		void Rehash(SIZE_T newCapacity)
+		{
+			FlatMapHelper::ControlByte* oldCtrl = m_Ctrl;
+			SlotType* oldSlots = m_Slots;
+			SIZE_T oldCapacity = m_Capacity;
+
+			AllocateTable(newCapacity);
+
+			for (SIZE_T i = 0; i < oldCapacity; i++)
+			{
+				if (oldCtrl[i] == FlatMapHelper::Empty)
+					continue;
+
+				SIZE_T hash = m_Hash(oldSlots[i].Value1);
+				SIZE_T index = FindFirstEmpty(hash);
+				SetCtrl(index, FlatMapHelper::H2(hash));
+				m_SlotAllocator.Construct(&m_Slots[index], std::move(oldSlots[i].Value1), std::move(oldSlots[i].Value2));
+				m_SlotAllocator.Destroy(&oldSlots[i]);
+			}
+
+			if (oldCtrl)
+			{
+				m_ControlAllocator.Deallocate(oldCtrl, oldCapacity + FlatMapHelper::GroupWidth - 1);
+				m_SlotAllocator.Deallocate(oldSlots, oldCapacity);
+			}
+		}
+
+	private:
+		FlatMapHelper::ControlByte* m_Ctrl;
+		SlotType* m_Slots;
+		SIZE_T m_NumElements;
+		SIZE_T m_Capacity;
+
+	private:
+		SlotAllocator m_SlotAllocator;
+		ControlAllocator m_ControlAllocator;
+		HasherType m_Hash;
+	};
+}
+
+#undef ME_FLAT_MAP_SSE2
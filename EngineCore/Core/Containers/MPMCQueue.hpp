@@ -0,0 +1,154 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+
+#include <bit>
+
+namespace ME::Core
+{
+	template<class T>
+	struct MPMCQueueCell
+	{
+		// Equal to the position when free for the producer at that position,
+		// position + 1 once filled for the consumer at that position
+		Atomic_SIZE_T Sequence;
+		alignas(T) uint8 Storage[sizeof(T)];
+
+		inline T* Data() { return reinterpret_cast<T*>(Storage); }
+	};
+
+	// Bounded lock-free queue for any number of producers and consumers (Dmitry Vyukov's design).
+	// Every cell carries a sequence number, so a producer and a consumer only ever contend on the
+	// position counter of their own side and never wait for each other unless the queue is full or empty
+	template<class T, class allocator = Memory::Allocator<MPMCQueueCell<T>>>
+	class MPMCQueue
+	{
+	public:
+		using DataType = T;
+		using CellType = MPMCQueueCell<T>;
+		using AllocatorType = allocator;
+
+	public:
+		// Capacity is rounded up to a power of two
+		explicit MPMCQueue(SIZE_T capacity)
+			: m_Capacity(std::bit_ceil(capacity < 2 ? SIZE_T(2) : capacity)), m_Mask(m_Capacity - 1)
+		{
+			m_Cells = m_Allocator.Allocate(m_Capacity);
+			for (SIZE_T i = 0; i < m_Capacity; i++)
+				m_Allocator.Construct(&m_Cells[i].Sequence, i);
+		}
+
+		MPMCQueue(const MPMCQueue&) = delete;
+		MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+		~MPMCQueue()
+		{
+			if constexpr (!std::is_trivially_destructible_v<DataType>)
+			{
+				const SIZE_T tail = m_EnqueuePosition.load(std::memory_order_relaxed);
+				for (SIZE_T head = m_DequeuePosition.load(std::memory_order_relaxed); head != tail; head++)
+					m_Allocator.Destroy(m_Cells[head & m_Mask].Data());
+			}
+			m_Allocator.Deallocate(m_Cells, m_Capacity);
+		}
+
+	public:
+		// Returns false if the queue is full
+		template<class... val>
+		bool TryEmplace(val&&... args)
+		{
+			CellType* cell;
+			SIZE_T position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[position & m_Mask];
+				const SIZE_T sequence = cell->Sequence.load(std::memory_order_acquire);
+				const SSIZE_T difference = static_cast<SSIZE_T>(sequence) - static_cast<SSIZE_T>(position);
+
+				if (difference == 0)
+				{
+					if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+					return false;
+				else
+					position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			}
+
+			m_Allocator.Construct(cell->Data(), std::forward<val>(args)...);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		inline bool TryPush(const DataType& value)
+		{
+			return TryEmplace(value);
+		}
+
+		inline bool TryPush(DataType&& value)
+		{
+			return TryEmplace(std::move(value));
+		}
+
+		// Returns false if the queue is empty
+		bool TryPop(DataType& out)
+		{
+			CellType* cell;
+			SIZE_T position = m_DequeuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[position & m_Mask];
+				const SIZE_T sequence = cell->Sequence.load(std::memory_order_acquire);
+				const SSIZE_T difference = static_cast<SSIZE_T>(sequence) - static_cast<SSIZE_T>(position + 1);
+
+				if (difference == 0)
+				{
+					if (m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+					return false;
+				else
+					position = m_DequeuePosition.load(std::memory_order_relaxed);
+			}
+
+			DataType* value = cell->Data();
+			out = std::move(*value);
+			m_Allocator.Destroy(value);
+			// Frees the cell for the producer one lap ahead
+			cell->Sequence.store(position + m_Capacity, std::memory_order_release);
+			return true;
+		}
+
+	public:
+		ME_NODISCARD inline SIZE_T Capacity() const
+		{
+			return m_Capacity;
+		}
+
+		// Only exact while nobody pushes or pops
+		ME_NODISCARD inline SIZE_T SizeApprox() const
+		{
+			const SIZE_T tail = m_EnqueuePosition.load(std::memory_order_acquire);
+			const SIZE_T head = m_DequeuePosition.load(std::memory_order_acquire);
+			return tail > head ? tail - head : 0;
+		}
+
+		ME_NODISCARD inline bool Empty() const
+		{
+			return SizeApprox() == 0;
+		}
+
+	private:
+		AllocatorType m_Allocator;
+		CellType* m_Cells;
+		const SIZE_T m_Capacity;
+		const SIZE_T m_Mask;
+
+	private:
+		alignas(Memory::CacheLineSize) Atomic_SIZE_T m_EnqueuePosition = 0;
+		alignas(Memory::CacheLineSize) Atomic_SIZE_T m_DequeuePosition = 0;
+	};
+}
@@ -2,6 +2,7 @@
 #include "Core.hpp"
 #include "Core/Pair.hpp"
 #include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
 #include "Core/Algorithm.hpp"
 #include "Core/Utility/Logging/Logger.hpp"
 
@@ -175,7 +176,7 @@ namespace ME::Core
 	};
 
 	template <typename keyType, typename valType, class _allocator =
-		Memory::Allocator<MapBranch<keyType, valType>>>
+		Memory::PoolAllocator<MapBranch<keyType, valType>>>
     class Map
 	{
 	public:
@@ -0,0 +1,120 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+
+#include <bit>
+
+namespace ME::Core
+{
+	// Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+	// Each side keeps a private copy of the other side's index and only reloads it when the
+	// ring looks full (or empty), so in the common case a push or pop touches no shared cache line
+	template<class T, class allocator = Memory::Allocator<T>>
+	class SPSCQueue
+	{
+	public:
+		using DataType = T;
+		using AllocatorType = allocator;
+
+	public:
+		// Capacity is rounded up to a power of two
+		explicit SPSCQueue(SIZE_T capacity)
+			: m_Capacity(std::bit_ceil(capacity < 2 ? SIZE_T(2) : capacity)), m_Mask(m_Capacity - 1)
+		{
+			m_Buffer = m_Allocator.Allocate(m_Capacity);
+		}
+
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		~SPSCQueue()
+		{
+			if constexpr (!std::is_trivially_destructible_v<DataType>)
+			{
+				const SIZE_T tail = m_Tail.load(std::memory_order_relaxed);
+				for (SIZE_T head = m_Head.load(std::memory_order_relaxed); head != tail; head++)
+					m_Allocator.Destroy(&m_Buffer[head & m_Mask]);
+			}
+			m_Allocator.Deallocate(m_Buffer, m_Capacity);
+		}
+
+	public:
+		// Producer side. Returns false if the queue is full
+		template<class... val>
+		bool TryEmplace(val&&... args)
+		{
+			const SIZE_T tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead == m_Capacity)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead == m_Capacity)
+					return false;
+			}
+
+			m_Allocator.Construct(&m_Buffer[tail & m_Mask], std::forward<val>(args)...);
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		inline bool TryPush(const DataType& value)
+		{
+			return TryEmplace(value);
+		}
+
+		inline bool TryPush(DataType&& value)
+		{
+			return TryEmplace(std::move(value));
+		}
+
+		// Consumer side. Returns false if the queue is empty
+		bool TryPop(DataType& out)
+		{
+			const SIZE_T head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return false;
+			}
+
+			DataType& value = m_Buffer[head & m_Mask];
+			out = std::move(value);
+			m_Allocator.Destroy(&value);
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+	public:
+		ME_NODISCARD inline SIZE_T Capacity() const
+		{
+			return m_Capacity;
+		}
+
+		// Only exact while neither side is running
+		ME_NODISCARD inline SIZE_T SizeApprox() const
+		{
+			return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+		}
+
+		ME_NODISCARD inline bool Empty() const
+		{
+			return SizeApprox() == 0;
+		}
+
+	private:
+		AllocatorType m_Allocator;
+		DataType* m_Buffer;
+		const SIZE_T m_Capacity;
+		const SIZE_T m_Mask;
+
+	private:
+		// Consumer owned
+		alignas(Memory::CacheLineSize) Atomic_SIZE_T m_Head = 0;
+		SIZE_T m_CachedTail = 0;
+
+		// Producer owned
+		alignas(Memory::CacheLineSize) Atomic_SIZE_T m_Tail = 0;
+		SIZE_T m_CachedHead = 0;
+	};
+}
@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
 #include "Core/Algorithm.hpp"
 
 #define ME_MAP_ITER_CHECK(ret) if (this->m_Ptr == nullptr)			\
@@ -175,7 +176,7 @@ namespace ME::Core
 	};
 
 	template <typename valType, class _allocator =
-		Memory::Allocator<SetBranch<valType>>>
+		Memory::PoolAllocator<SetBranch<valType>>>
 	class Set
 	{
 	public:
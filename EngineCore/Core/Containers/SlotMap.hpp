@@ -0,0 +1,261 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Utility/Logging/Logger.hpp"
+
+namespace ME::Core
+{
+	// Refers to a value of a SlotMap. The generation changes every time a slot is reused,
+	// so a handle to an erased value never resolves to whatever took its place
+	struct SlotHandle
+	{
+		static constexpr uint32 InvalidIndex = ~uint32(0);
+
+		uint32 Index = InvalidIndex;
+		uint32 Generation = 0;
+
+		ME_NODISCARD inline bool IsValid() const { return Index != InvalidIndex; }
+
+		inline bool operator==(const SlotHandle& other) const
+		{
+			return Index == other.Index && Generation == other.Generation;
+		}
+	};
+
+	// Values packed in a dense array and addressed through handles made of a slot index and a generation.
+	// Checking a handle is one slot read and a compare, erased slots are reused through a free list.
+	// Erase swaps the last value into the hole, so the order of values isn't stable
+	template<class T, class allocator = Memory::Allocator<T>>
+	class SlotMap
+	{
+	public:
+		using DataType = T;
+		using HandleType = SlotHandle;
+		using IndexType = uint32;
+
+		using AllocatorType = allocator;
+
+		using Iterator = ArrayIterator<SlotMap>;
+		using ConstIterator = ArrayConstIterator<SlotMap>;
+
+		static constexpr IndexType InvalidIndex = SlotHandle::InvalidIndex;
+
+	private:
+		// The generation is odd while the slot holds a value. A free slot keeps the next free slot in DenseIndex
+		struct Slot
+		{
+			IndexType DenseIndex;
+			uint32 Generation;
+		};
+
+	public:
+		SlotMap() : m_FreeHead(InvalidIndex) {}
+
+	public:
+		ME_NODISCARD inline bool Contains(HandleType handle) const
+		{
+			return DenseIndexOf(handle) != InvalidIndex;
+		}
+
+		ME_NODISCARD inline DataType* Find(HandleType handle)
+		{
+			const IndexType index = DenseIndexOf(handle);
+			return index == InvalidIndex ? nullptr : &m_Values[index];
+		}
+
+		ME_NODISCARD inline const DataType* Find(HandleType handle) const
+		{
+			const IndexType index = DenseIndexOf(handle);
+			return index == InvalidIndex ? nullptr : &m_Values[index];
+		}
+
+		ME_NODISCARD inline DataType& Get(HandleType handle)
+		{
+			const IndexType index = DenseIndexOf(handle);
+			ME_CORE_ASSERT(index != InvalidIndex, "Stale or invalid SlotMap handle!");
+			return m_Values[index];
+		}
+
+		ME_NODISCARD inline const DataType& Get(HandleType handle) const
+		{
+			const IndexType index = DenseIndexOf(handle);
+			ME_CORE_ASSERT(index != InvalidIndex, "Stale or invalid SlotMap handle!");
+			return m_Values[index];
+		}
+
+		template<class... val>
+		HandleType Emplace(val&&... args)
+		{
+			IndexType slotIndex = m_FreeHead;
+			if (slotIndex != InvalidIndex)
+				m_FreeHead = m_Slots[slotIndex].DenseIndex;
+			else
+			{
+				slotIndex = static_cast<IndexType>(m_Slots.Size());
+				m_Slots.EmplaceBack(Slot{ InvalidIndex, 0 });
+			}
+
+			Slot& slot = m_Slots[slotIndex];
+			slot.DenseIndex = static_cast<IndexType>(m_Values.Size());
+			slot.Generation++;
+
+			m_Values.EmplaceBack(std::forward<val>(args)...);
+			m_SlotIndices.EmplaceBack(slotIndex);
+			return HandleType{ slotIndex, slot.Generation };
+		}
+
+		inline HandleType Insert(const DataType& value)
+		{
+			return Emplace(value);
+		}
+
+		inline HandleType Insert(DataType&& value)
+		{
+			return Emplace(std::move(value));
+		}
+
+		// Returns false if the handle is stale. Moves the last value into the freed spot
+		bool Erase(HandleType handle)
+		{
+			const IndexType index = DenseIndexOf(handle);
+			if (index == InvalidIndex)
+				return false;
+
+			const IndexType last = static_cast<IndexType>(m_Values.Size() - 1);
+			if (index != last)
+			{
+				const IndexType lastSlot = m_SlotIndices[last];
+				m_Values[index] = std::move(m_Values[last]);
+				m_SlotIndices[index] = lastSlot;
+				m_Slots[lastSlot].DenseIndex = index;
+			}
+			m_Values.PopBack();
+			m_SlotIndices.PopBack();
+
+			Slot& slot = m_Slots[handle.Index];
+			slot.Generation++;
+			slot.DenseIndex = m_FreeHead;
+			m_FreeHead = handle.Index;
+			return true;
+		}
+
+		// Invalidates every handle, slots are kept for reuse
+		void Clear()
+		{
+			for (SIZE_T i = 0; i < m_SlotIndices.Size(); i++)
+			{
+				const IndexType slotIndex = m_SlotIndices[i];
+				Slot& slot = m_Slots[slotIndex];
+				slot.Generation++;
+				slot.DenseIndex = m_FreeHead;
+				m_FreeHead = slotIndex;
+			}
+			m_SlotIndices.Clear();
+			m_Values.Clear();
+		}
+
+		void Reserve(SIZE_T count)
+		{
+			m_Slots.Reserve(count);
+			m_SlotIndices.Reserve(count);
+			m_Values.Reserve(count);
+		}
+
+	public:
+		// Handle of the value at a position of the dense array
+		ME_NODISCARD inline HandleType HandleAt(SIZE_T index) const
+		{
+			const IndexType slotIndex = m_SlotIndices[index];
+			return HandleType{ slotIndex, m_Slots[slotIndex].Generation };
+		}
+
+		ME_NODISCARD inline SIZE_T Size() const
+		{
+			return m_Values.Size();
+		}
+
+		ME_NODISCARD inline bool Empty() const
+		{
+			return m_Values.Empty();
+		}
+
+		ME_NODISCARD inline DataType* Data()
+		{
+			return m_Values.Data();
+		}
+
+		ME_NODISCARD inline const DataType* Data() const
+		{
+			return m_Values.Data();
+		}
+
+		inline DataType& operator[](SIZE_T index)
+		{
+			return m_Values[index];
+		}
+
+		inline const DataType& operator[](SIZE_T index) const
+		{
+			return m_Values[index];
+		}
+
+		inline Iterator begin()
+		{
+			return Begin();
+		}
+
+		inline Iterator end()
+		{
+			return End();
+		}
+
+		inline Iterator Begin()
+		{
+			return Iterator(m_Values.Data());
+		}
+
+		inline Iterator End()
+		{
+			return Iterator(m_Values.Data() + m_Values.Size());
+		}
+
+		inline ConstIterator begin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator end() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator CBegin() const
+		{
+			return ConstIterator(m_Values.Data());
+		}
+
+		inline ConstIterator CEnd() const
+		{
+			return ConstIterator(m_Values.Data() + m_Values.Size());
+		}
+
+	private:
+		ME_NODISCARD inline IndexType DenseIndexOf(HandleType handle) const
+		{
+			if (handle.Index >= m_Slots.Size())
+				return InvalidIndex;
+
+			const Slot& slot = m_Slots[handle.Index];
+			return slot.Generation == handle.Generation && (slot.Generation & 1) ? slot.DenseIndex : InvalidIndex;
+		}
+
+	private:
+		Array<Slot> m_Slots;
+		// Slot of every value, in the same order as the values
+		Array<IndexType> m_SlotIndices;
+		Array<DataType, AllocatorType> m_Values;
+
+		IndexType m_FreeHead;
+	};
+}
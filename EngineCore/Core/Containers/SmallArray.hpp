@@ -0,0 +1,463 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+
+namespace ME::Core
+{
+	// Array which keeps up to N elements inside the object and moves them to the heap once it grows past that.
+	// Meant for short lived or per-item arrays which are almost always tiny
+	template<class T, SIZE_T N, class allocator = Memory::Allocator<T>>
+	class SmallArray
+	{
+		static_assert(N > 0, "SmallArray needs at least one inline element, use Array otherwise.");
+
+	public:
+		using DataType = T;
+
+	public:
+		using ReturnType = DataType;
+		using Ptr = T*;
+
+		using AllocatorType = allocator;
+
+		using Iterator = ArrayIterator<SmallArray>;
+		using ConstIterator = ArrayConstIterator<SmallArray>;
+
+		static constexpr SIZE_T InlineCapacity = N;
+
+	private:
+		static constexpr bool IsRelocatable = Memory::IsTriviallyRelocatable<DataType>;
+
+	public:
+		SmallArray() noexcept
+			: m_Allocator(AllocatorType()), m_Data(GetInline()), m_Size(0), m_Capacity(N)
+		{
+		}
+
+		SmallArray(SIZE_T size)
+			: SmallArray()
+		{
+			Resize(size);
+		}
+
+		SmallArray(const SmallArray& other)
+			: m_Allocator(other.m_Allocator), m_Data(GetInline()), m_Size(0), m_Capacity(N)
+		{
+			Reserve(other.m_Size);
+			CopyConstruct(m_Data, other.m_Data, other.m_Size);
+			m_Size = other.m_Size;
+		}
+
+		SmallArray(const std::initializer_list<DataType>& other)
+			: SmallArray()
+		{
+			Reserve(other.size());
+			CopyConstruct(m_Data, other.begin(), other.size());
+			m_Size = other.size();
+		}
+
+		SmallArray(SmallArray&& other) noexcept
+			: m_Allocator(other.m_Allocator), m_Data(GetInline()), m_Size(0), m_Capacity(N)
+		{
+			TakeFrom(other);
+		}
+
+		~SmallArray()
+		{
+			Clear();
+			Deallocate();
+		}
+
+	public:
+		ME_NODISCARD inline SIZE_T Size() const
+		{
+			return m_Size;
+		}
+
+		ME_NODISCARD inline SIZE_T Capacity() const
+		{
+			return m_Capacity;
+		}
+
+		ME_NODISCARD inline bool IsInline() const
+		{
+			return m_Data == GetInline();
+		}
+
+		ME_NODISCARD inline DataType* Data()
+		{
+			return m_Data;
+		}
+
+		ME_NODISCARD inline const DataType* Data() const
+		{
+			return m_Data;
+		}
+
+		inline Iterator begin()
+		{
+			return Begin();
+		}
+
+		inline Iterator end()
+		{
+			return End();
+		}
+
+		inline Iterator Begin()
+		{
+			return Iterator(m_Data);
+		}
+
+		inline Iterator End()
+		{
+			return Iterator(m_Data + m_Size);
+		}
+
+		inline ConstIterator begin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator end() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator Begin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator End() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator CBegin() const
+		{
+			return ConstIterator(m_Data);
+		}
+
+		inline ConstIterator CEnd() const
+		{
+			return ConstIterator(m_Data + m_Size);
+		}
+
+		ME_NODISCARD inline DataType& Front()
+		{
+			return *(m_Data);
+		}
+
+		ME_NODISCARD inline DataType& Back()
+		{
+			return *(m_Data + m_Size - 1);
+		}
+
+	public:
+		SmallArray& operator=(const SmallArray& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				Reserve(other.m_Size);
+				CopyConstruct(m_Data, other.m_Data, other.m_Size);
+				m_Size = other.m_Size;
+			}
+			return *this;
+		}
+
+		SmallArray& operator=(SmallArray&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				Deallocate();
+				TakeFrom(other);
+			}
+			return *this;
+		}
+
+		ReturnType& operator[](const SIZE_T index) noexcept
+		{
+			ME_CORE_ASSERT(index < m_Size, "Index in array is out of range!");
+			return m_Data[index];
+		}
+
+		const ReturnType& operator[](const SIZE_T index) const noexcept
+		{
+			ME_CORE_ASSERT(index < m_Size, "Index in array is out of range!");
+			return m_Data[index];
+		}
+
+	public:
+		void Clear()
+		{
+			if constexpr (!std::is_trivially_destructible_v<DataType>)
+			{
+				for (SIZE_T i = 0; i < m_Size; i++)
+					m_Allocator.Destroy(&m_Data[i]);
+			}
+			m_Size = 0;
+		}
+
+		// Makes room for at least 'size' elements. Returns true if the elements moved to a new block
+		bool Reserve(SIZE_T size)
+		{
+			if (size <= m_Capacity)
+				return false;
+
+			Reallocate(size);
+			return true;
+		}
+
+		void Resize(SIZE_T size)
+		{
+			if (size < m_Size)
+			{
+				if constexpr (!std::is_trivially_destructible_v<DataType>)
+				{
+					for (SIZE_T i = size; i < m_Size; ++i)
+						m_Allocator.Destroy(&m_Data[i]);
+				}
+				m_Size = size;
+				return;
+			}
+
+			Reserve(size);
+			for (SIZE_T i = m_Size; i < size; ++i)
+				m_Allocator.Construct(&m_Data[i]);
+			m_Size = size;
+		}
+
+		// Moves the elements back inline when they fit, otherwise reallocates to exactly Size()
+		void ShrinkToFit()
+		{
+			if (IsInline() || m_Size == m_Capacity)
+				return;
+
+			Reallocate(m_Size);
+		}
+
+	public:
+		ME_NODISCARD inline bool Empty() const
+		{
+			return m_Size == 0;
+		}
+
+	public:
+		template <class... val>
+		Iterator Emplace(ConstIterator it, val&&... args)
+		{
+			const SIZE_T offset = it.Ptr() - m_Data;
+			if (offset == m_Size)
+				return Iterator(&EmplaceBack(std::forward<val>(args)...));
+
+			// Built up front, the arguments may refer to elements which are about to move
+			DataType value(std::forward<val>(args)...);
+			Reserve(m_Size + 1 > m_Capacity ? m_Capacity * ARR_RESIZE_MULTIPLYER : m_Size + 1);
+			Relocate(m_Data + offset + 1, m_Data + offset, m_Size - offset, true);
+			m_Allocator.Construct(m_Data + offset, std::move(value));
+			m_Size++;
+			return Iterator(m_Data + offset);
+		}
+
+		Iterator Insert(ConstIterator position, const DataType& value)
+		{
+			return Emplace(position, value);
+		}
+
+		Iterator Insert(ConstIterator position, DataType&& value)
+		{
+			return Emplace(position, std::move(value));
+		}
+
+		void PushBack(const DataType& value)
+		{
+			EmplaceBack(value);
+		}
+
+		void PushBack(DataType&& value)
+		{
+			EmplaceBack(std::move(value));
+		}
+
+		template <class... val>
+		ReturnType& EmplaceBack(val&&... args)
+		{
+			if (m_Size < m_Capacity)
+			{
+				m_Allocator.Construct(m_Data + m_Size, std::forward<val>(args)...);
+				return m_Data[m_Size++];
+			}
+
+			// Construct in the new block first, the arguments may refer to our own elements
+			const SIZE_T newCapacity = m_Capacity * ARR_RESIZE_MULTIPLYER;
+			DataType* newBlock = m_Allocator.Allocate(newCapacity);
+			m_Allocator.Construct(newBlock + m_Size, std::forward<val>(args)...);
+			Relocate(newBlock, m_Data, m_Size, false);
+			Deallocate();
+
+			m_Data = newBlock;
+			m_Capacity = newCapacity;
+			return m_Data[m_Size++];
+		}
+
+		Iterator Erase(ConstIterator it)
+		{
+			return PErase(it.Ptr() - m_Data, 1);
+		}
+
+		Iterator Erase(ConstIterator first, ConstIterator last)
+		{
+			return PErase(first.Ptr() - m_Data, last - first);
+		}
+
+		Iterator EraseAt(SIZE_T index)
+		{
+			return PErase(index, 1);
+		}
+
+		void PopBack()
+		{
+			if (m_Size > 0)
+			{
+				m_Size--;
+				m_Allocator.Destroy(&m_Data[m_Size]);
+			}
+		}
+
+	private:
+		inline DataType* GetInline()
+		{
+			return reinterpret_cast<DataType*>(m_Inline);
+		}
+
+		inline const DataType* GetInline() const
+		{
+			return reinterpret_cast<const DataType*>(m_Inline);
+		}
+
+		// Moves live elements into uninitialized memory and ends their lifetime in the source.
+		// 'backward' has to be set for overlapping moves towards higher addresses
+		void Relocate(Ptr destination, Ptr source, SIZE_T count, bool backward)
+		{
+			if (count == 0)
+				return;
+
+			if constexpr (IsRelocatable)
+				memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(DataType));
+			else if (backward)
+			{
+				for (SIZE_T i = count; i > 0; i--)
+				{
+					m_Allocator.Construct(&destination[i - 1], std::move(source[i - 1]));
+					m_Allocator.Destroy(&source[i - 1]);
+				}
+			}
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+				{
+					m_Allocator.Construct(&destination[i], std::move(source[i]));
+					m_Allocator.Destroy(&source[i]);
+				}
+			}
+		}
+
+		void CopyConstruct(Ptr destination, const DataType* source, SIZE_T count)
+		{
+			if constexpr (std::is_trivially_copyable_v<DataType>)
+			{
+				if (count > 0)
+					memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(DataType));
+			}
+			else
+			{
+				for (SIZE_T i = 0; i < count; i++)
+					m_Allocator.Construct(&destination[i], source[i]);
+			}
+		}
+
+		// Moves the elements to a block of 'newCapacity' elements, the inline storage when they fit
+		void Reallocate(SIZE_T newCapacity)
+		{
+			const bool toInline = newCapacity <= N;
+			if (toInline && IsInline())
+				return;
+
+			DataType* newBlock = toInline ? GetInline() : m_Allocator.Allocate(newCapacity);
+			Relocate(newBlock, m_Data, m_Size, false);
+			Deallocate();
+
+			m_Data = newBlock;
+			m_Capacity = toInline ? N : newCapacity;
+		}
+
+		// Frees the heap block, if any, and points back at the inline storage. Elements must be gone already
+		void Deallocate()
+		{
+			if (!IsInline())
+				m_Allocator.Deallocate(m_Data, m_Capacity);
+			m_Data = GetInline();
+			m_Capacity = N;
+		}
+
+		// Expects an empty array on the inline storage
+		void TakeFrom(SmallArray& other)
+		{
+			m_Allocator = other.m_Allocator;
+			if (other.IsInline())
+			{
+				Relocate(m_Data, other.m_Data, other.m_Size, false);
+				m_Size = other.m_Size;
+			}
+			else
+			{
+				m_Data = other.m_Data;
+				m_Size = other.m_Size;
+				m_Capacity = other.m_Capacity;
+				other.m_Data = other.GetInline();
+				other.m_Capacity = N;
+			}
+			other.m_Size = 0;
+		}
+
+		Iterator PErase(SIZE_T offset, SIZE_T count)
+		{
+			if (count == 0)
+				return Iterator(m_Data + offset);
+
+			if constexpr (IsRelocatable)
+			{
+				if constexpr (!std::is_trivially_destructible_v<DataType>)
+				{
+					for (SIZE_T i = offset; i < offset + count; ++i)
+						m_Allocator.Destroy(m_Data + i);
+				}
+				Relocate(m_Data + offset, m_Data + offset + count, m_Size - offset - count, false);
+			}
+			else
+			{
+				for (SIZE_T i = offset + count; i < m_Size; ++i)
+					m_Data[i - count] = std::move(m_Data[i]);
+				for (SIZE_T i = m_Size - count; i < m_Size; ++i)
+					m_Allocator.Destroy(m_Data + i);
+			}
+
+			m_Size -= count;
+			return Iterator(m_Data + offset);
+		}
+
+	private:
+		AllocatorType m_Allocator;
+
+	private:
+		DataType* m_Data;
+
+		SIZE_T m_Size;
+		SIZE_T m_Capacity;
+
+		alignas(DataType) uint8 m_Inline[N * sizeof(DataType)];
+	};
+}
@@ -0,0 +1,308 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Utility/Logging/Logger.hpp"
+
+#include <cstring>
+
+// Entries per sparse page, a power of two. 1024 indices make a 4 KB page
+constexpr SIZE_T SPARSE_SET_PAGE_SIZE = 1024;
+
+namespace ME::Core
+{
+	// Maps small integer keys (entity IDs and the like) to values kept packed in a dense array.
+	// The sparse side is split into pages which are only allocated once a key lands in them,
+	// so a lookup is two array reads and large unused key ranges cost one null pointer per page.
+	// Erase swaps the last value into the hole, so the order of values isn't stable
+	template<class T, class allocator = Memory::Allocator<T>>
+	class SparseSet
+	{
+		static_assert((SPARSE_SET_PAGE_SIZE & (SPARSE_SET_PAGE_SIZE - 1)) == 0, "Sparse page size has to be a power of two.");
+
+	public:
+		using DataType = T;
+		using KeyType = uint64;
+		using IndexType = uint32;
+
+		using AllocatorType = allocator;
+		using PageAllocatorType = typename allocator::template Rebind<IndexType>::Other;
+
+		using Iterator = ArrayIterator<SparseSet>;
+		using ConstIterator = ArrayConstIterator<SparseSet>;
+
+		static constexpr IndexType InvalidIndex = ~IndexType(0);
+
+	public:
+		SparseSet() = default;
+
+		SparseSet(const SparseSet& other)
+			: m_Keys(other.m_Keys), m_Values(other.m_Values)
+		{
+			CopyPages(other);
+		}
+
+		SparseSet(SparseSet&& other) noexcept
+			: m_Pages(std::move(other.m_Pages)), m_Keys(std::move(other.m_Keys)), m_Values(std::move(other.m_Values))
+		{
+		}
+
+		~SparseSet()
+		{
+			FreePages();
+		}
+
+	public:
+		SparseSet& operator=(const SparseSet& other)
+		{
+			if (this != &other)
+			{
+				FreePages();
+				m_Keys = other.m_Keys;
+				m_Values = other.m_Values;
+				CopyPages(other);
+			}
+			return *this;
+		}
+
+		SparseSet& operator=(SparseSet&& other) noexcept
+		{
+			if (this != &other)
+			{
+				FreePages();
+				m_Pages = std::move(other.m_Pages);
+				m_Keys = std::move(other.m_Keys);
+				m_Values = std::move(other.m_Values);
+			}
+			return *this;
+		}
+
+	public:
+		ME_NODISCARD inline bool Contains(KeyType key) const
+		{
+			return IndexOf(key) != InvalidIndex;
+		}
+
+		// Position of the key's value in the dense array, InvalidIndex if it isn't there
+		ME_NODISCARD inline IndexType IndexOf(KeyType key) const
+		{
+			const SIZE_T page = key / SPARSE_SET_PAGE_SIZE;
+			if (page >= m_Pages.Size() || m_Pages[page] == nullptr)
+				return InvalidIndex;
+			return m_Pages[page][key & (SPARSE_SET_PAGE_SIZE - 1)];
+		}
+
+		ME_NODISCARD inline DataType* Find(KeyType key)
+		{
+			const IndexType index = IndexOf(key);
+			return index == InvalidIndex ? nullptr : &m_Values[index];
+		}
+
+		ME_NODISCARD inline const DataType* Find(KeyType key) const
+		{
+			const IndexType index = IndexOf(key);
+			return index == InvalidIndex ? nullptr : &m_Values[index];
+		}
+
+		ME_NODISCARD inline DataType& Get(KeyType key)
+		{
+			const IndexType index = IndexOf(key);
+			ME_CORE_ASSERT(index != InvalidIndex, "Key not found in SparseSet!");
+			return m_Values[index];
+		}
+
+		ME_NODISCARD inline const DataType& Get(KeyType key) const
+		{
+			const IndexType index = IndexOf(key);
+			ME_CORE_ASSERT(index != InvalidIndex, "Key not found in SparseSet!");
+			return m_Values[index];
+		}
+
+		// Adds a value for a key which isn't in the set yet
+		template<class... val>
+		DataType& Emplace(KeyType key, val&&... args)
+		{
+			IndexType& slot = GetOrCreateSlot(key);
+			ME_CORE_ASSERT(slot == InvalidIndex, "Key is already in the SparseSet!");
+
+			slot = static_cast<IndexType>(m_Values.Size());
+			m_Keys.EmplaceBack(key);
+			return m_Values.EmplaceBack(std::forward<val>(args)...);
+		}
+
+		inline DataType& Insert(KeyType key, const DataType& value)
+		{
+			return Emplace(key, value);
+		}
+
+		inline DataType& Insert(KeyType key, DataType&& value)
+		{
+			return Emplace(key, std::move(value));
+		}
+
+		// Returns false if the key wasn't there. Moves the last value into the freed spot
+		bool Erase(KeyType key)
+		{
+			const SIZE_T page = key / SPARSE_SET_PAGE_SIZE;
+			if (page >= m_Pages.Size() || m_Pages[page] == nullptr)
+				return false;
+
+			IndexType& slot = m_Pages[page][key & (SPARSE_SET_PAGE_SIZE - 1)];
+			const IndexType index = slot;
+			if (index == InvalidIndex)
+				return false;
+
+			const IndexType last = static_cast<IndexType>(m_Values.Size() - 1);
+			if (index != last)
+			{
+				const KeyType lastKey = m_Keys[last];
+				m_Values[index] = std::move(m_Values[last]);
+				m_Keys[index] = lastKey;
+				m_Pages[lastKey / SPARSE_SET_PAGE_SIZE][lastKey & (SPARSE_SET_PAGE_SIZE - 1)] = index;
+			}
+
+			slot = InvalidIndex;
+			m_Values.PopBack();
+			m_Keys.PopBack();
+			return true;
+		}
+
+		// Drops the values but keeps the pages around, they are likely to be needed again
+		void Clear()
+		{
+			for (SIZE_T i = 0; i < m_Keys.Size(); i++)
+			{
+				const KeyType key = m_Keys[i];
+				m_Pages[key / SPARSE_SET_PAGE_SIZE][key & (SPARSE_SET_PAGE_SIZE - 1)] = InvalidIndex;
+			}
+			m_Keys.Clear();
+			m_Values.Clear();
+		}
+
+		// Reserves room for 'count' values, pointers into the set stay valid until it grows past that
+		void Reserve(SIZE_T count)
+		{
+			m_Keys.Reserve(count);
+			m_Values.Reserve(count);
+		}
+
+	public:
+		ME_NODISCARD inline SIZE_T Size() const
+		{
+			return m_Values.Size();
+		}
+
+		ME_NODISCARD inline bool Empty() const
+		{
+			return m_Values.Empty();
+		}
+
+		// Keys in the same order as the values
+		ME_NODISCARD inline const Array<KeyType>& Keys() const
+		{
+			return m_Keys;
+		}
+
+		ME_NODISCARD inline DataType* Data()
+		{
+			return m_Values.Data();
+		}
+
+		ME_NODISCARD inline const DataType* Data() const
+		{
+			return m_Values.Data();
+		}
+
+		inline Iterator begin()
+		{
+			return Begin();
+		}
+
+		inline Iterator end()
+		{
+			return End();
+		}
+
+		inline Iterator Begin()
+		{
+			return Iterator(m_Values.Data());
+		}
+
+		inline Iterator End()
+		{
+			return Iterator(m_Values.Data() + m_Values.Size());
+		}
+
+		inline ConstIterator begin() const
+		{
+			return CBegin();
+		}
+
+		inline ConstIterator end() const
+		{
+			return CEnd();
+		}
+
+		inline ConstIterator CBegin() const
+		{
+			return ConstIterator(m_Values.Data());
+		}
+
+		inline ConstIterator CEnd() const
+		{
+			return ConstIterator(m_Values.Data() + m_Values.Size());
+		}
+
+	private:
+		IndexType& GetOrCreateSlot(KeyType key)
+		{
+			const SIZE_T page = key / SPARSE_SET_PAGE_SIZE;
+			if (page >= m_Pages.Size())
+				m_Pages.Resize(page + 1);
+
+			if (m_Pages[page] == nullptr)
+				m_Pages[page] = AllocatePage();
+			return m_Pages[page][key & (SPARSE_SET_PAGE_SIZE - 1)];
+		}
+
+		IndexType* AllocatePage()
+		{
+			IndexType* page = m_PageAllocator.Allocate(SPARSE_SET_PAGE_SIZE);
+			// Every byte 0xFF makes every entry InvalidIndex
+			memset(page, 0xFF, SPARSE_SET_PAGE_SIZE * sizeof(IndexType));
+			return page;
+		}
+
+		void CopyPages(const SparseSet& other)
+		{
+			m_Pages.Resize(other.m_Pages.Size());
+			for (SIZE_T i = 0; i < other.m_Pages.Size(); i++)
+			{
+				m_Pages[i] = nullptr;
+				if (other.m_Pages[i] == nullptr)
+					continue;
+
+				m_Pages[i] = m_PageAllocator.Allocate(SPARSE_SET_PAGE_SIZE);
+				memcpy(m_Pages[i], other.m_Pages[i], SPARSE_SET_PAGE_SIZE * sizeof(IndexType));
+			}
+		}
+
+		void FreePages()
+		{
+			for (SIZE_T i = 0; i < m_Pages.Size(); i++)
+			{
+				if (m_Pages[i] != nullptr)
+					m_PageAllocator.Deallocate(m_Pages[i], SPARSE_SET_PAGE_SIZE);
+			}
+			m_Pages.Clear();
+		}
+
+	private:
+		PageAllocatorType m_PageAllocator;
+
+	private:
+		Array<IndexType*> m_Pages;
+		Array<KeyType> m_Keys;
+		Array<DataType, AllocatorType> m_Values;
+	};
+}
@@ -132,134 +132,82 @@ namespace ME::Core
 
 	public:
 		PString()
-			: m_Allocator(AllocatorType()), m_Data(nullptr), m_Size(0), m_Capacity(10)
+			: m_Allocator(AllocatorType()), m_IsHeap(false), m_Size(0)
 		{
-			Allocate(m_Capacity);
+			m_Inline[0] = '\0';
 		}
 
 		PString(DataType str)
-			: m_Allocator(AllocatorType())
+			: PString(&str, 1)
 		{
-			m_Size = 1;
-			m_Capacity = 10;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(&str, m_Size);
-			m_Data[m_Size] = '\0';
 		}
 
 		PString(const DataType* str)
-			: m_Allocator(AllocatorType())
+			: PString(str, GetStringSize(str))
 		{
-			m_Size = GetStringSize(str);
-			m_Capacity = m_Size + 1;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(str, m_Size);
-			m_Data[m_Size] = '\0';
 		}
 
 		PString(const DataType* str, SIZE_T size)
-			: m_Allocator(AllocatorType())
+			: m_Allocator(AllocatorType()), m_IsHeap(false), m_Size(0)
 		{
-			m_Size = size;
-			m_Capacity = m_Size + 1;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(str, size);
-			m_Data[m_Size] = '\0';
+			InitFrom(str, size);
 		}
 
 		PString(asciichar ch)
-			: m_Allocator(AllocatorType())
+			: PString(reinterpret_cast<const DataType*>(&ch), 1)
 		{
 			static_assert(sizeof(DataType) == 1, "This constructor is available for only UTF8 string!");
-			m_Size = 1;
-			m_Capacity = 10;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(reinterpret_cast<const DataType*>(&ch), m_Size);
-			m_Data[m_Size] = '\0';
 		}
 
 		PString(const asciichar* str)
-			: m_Allocator(AllocatorType())
+			: PString(reinterpret_cast<const DataType*>(str), GetStringSize(reinterpret_cast<const DataType*>(str)))
 		{
 			static_assert(sizeof(DataType) == 1, "This constructor is available for only UTF8 string!");
-			m_Size = GetStringSize(reinterpret_cast<const DataType*>(str));
-			m_Capacity = m_Size + 1;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(reinterpret_cast<const DataType*>(str), m_Size);
-			m_Data[m_Size] = '\0';
 		}
 
 	    PString(const asciichar* str, SIZE_T size)
-			: m_Allocator(AllocatorType())
+			: PString(reinterpret_cast<const DataType*>(str), size)
 		{
 			static_assert(sizeof(DataType) == 1, "This constructor is available for only UTF8 string!");
-			m_Size = size;
-			m_Capacity = m_Size + 1;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(reinterpret_cast<const DataType*>(str), size);
-			m_Data[m_Size] = 0;
 		}
 
 		PString(const PString& other)
-			: m_Allocator(AllocatorType())
+			: m_Allocator(other.m_Allocator), m_IsHeap(false), m_Size(0)
 		{
-			m_Size = other.m_Size;
-			m_Capacity = other.m_Capacity;
-			m_Data = nullptr;
-
-			Allocate(m_Capacity);
-			CopyString(other.m_Data, m_Size);
-			m_Data[m_Size] = '\0';
+			InitFrom(other.GetData(), other.m_Size);
 		}
 
 		PString(PString&& other) noexcept
-			: m_Allocator(other.m_Allocator), m_Data(other.m_Data), m_Size(other.m_Size), m_Capacity(other.m_Capacity)
+			: m_Allocator(std::move(other.m_Allocator)), m_IsHeap(false), m_Size(0)
 		{
-			other.m_Size = 0;
-			other.m_Capacity = 0;
-			other.m_Data = nullptr;
+			MoveFrom(other);
 		}
 
 		~PString()
 		{
-			if (m_Data)
-			{
-				m_Allocator.Deallocate(m_Data, m_Capacity * sizeof(DataType));
-				m_Data = nullptr;
-			}
+			DeallocateHeap();
 		}
 
 	public:
 		inline SIZE_T Size() const noexcept { return m_Size; }
-		inline SIZE_T Capacity() const noexcept { return m_Capacity; }
-		inline const DataType* String() const noexcept { return m_Data; }
+		inline SIZE_T Capacity() const noexcept { return m_IsHeap ? m_Heap.Capacity : InlineCapacity; }
+		inline bool IsInline() const noexcept { return !m_IsHeap; }
+		inline const DataType* String() const noexcept { return GetData(); }
 
-		inline Iterator begin() { return Iterator(m_Data); }
-		inline Iterator end() { return Iterator(m_Data + m_Size); }
-		inline Iterator Begin() { return Iterator(m_Data); }
-		inline Iterator End() { return Iterator(m_Data + m_Size); }
+		inline Iterator begin() { return Iterator(GetData()); }
+		inline Iterator end() { return Iterator(GetData() + m_Size); }
+		inline Iterator Begin() { return Iterator(GetData()); }
+		inline Iterator End() { return Iterator(GetData() + m_Size); }
 
 	public:
 		PStringView<type> ToStringView() const
 		{
-			return PStringView<type>(m_Data, m_Size);
+			return PStringView<type>(GetData(), m_Size);
 		}
 
 		operator PStringView<DataType>() const
 		{
-			return PStringView<DataType>(m_Data, m_Size);
+			return PStringView<DataType>(GetData(), m_Size);
 		}
 
 	public:
@@ -282,17 +230,30 @@ namespace ME::Core
 		{
 			if (this != &other)
 			{
-				if (m_Data)
+				// Reuse the current buffer when it is large enough
+				if (other.m_Size + 1 > Capacity())
 				{
-					m_Allocator.Deallocate(m_Data, m_Capacity * sizeof(DataType));
+					// Nothing of the old contents is kept, so Allocate() has nothing to copy
+					DeallocateHeap();
+					m_Allocator = other.m_Allocator;
+					m_Size = 0;
+					Allocate(other.m_Size + 1);
 				}
-				m_Allocator = other.m_Allocator;
+
 				m_Size = other.m_Size;
-				m_Capacity = other.m_Capacity;
-				m_Data = nullptr;
+				CopyString(other.GetData(), m_Size);
+				GetData()[m_Size] = '\0';
+			}
+			return *this;
+		}
 
-				Allocate(m_Capacity);
-				CopyString(other.m_Data, m_Size);
+		PString& operator=(PString&& other) noexcept
+		{
+			if (this != &other)
+			{
+				DeallocateHeap();
+				m_Allocator = std::move(other.m_Allocator);
+				MoveFrom(other);
 			}
 			return *this;
 		}
@@ -352,13 +313,15 @@ namespace ME::Core
 
 			if constexpr (std::is_trivially_copyable_v<DataType>)
 			{
-				return memcmp(m_Data, str.m_Data, m_Size * sizeof(DataType)) == 0;
+				return memcmp(GetData(), str.GetData(), m_Size * sizeof(DataType)) == 0;
 			}
 			else
 			{
+				const DataType* data = GetData();
+				const DataType* otherData = str.GetData();
 				for (SIZE_T i = 0; i < m_Size; i++)
 				{
-					if (m_Data[i] != str.m_Data[i])
+					if (data[i] != otherData[i])
 						return false;
 				}
 				return true;
@@ -368,26 +331,25 @@ namespace ME::Core
 		ReturnType& operator[](const SIZE_T index) noexcept
 		{
 			ME_CORE_ASSERT(index < m_Size, "Index in array is out of range!");
-			return m_Data[index];
+			return GetData()[index];
 		}
 
 		const ReturnType& operator[](const SIZE_T index) const noexcept
 		{
 			ME_CORE_ASSERT(index < m_Size, "Index in array is out of range!");
-			return m_Data[index];
+			return GetData()[index];
 		}
 
 	public:
 		void Clear()
 		{
 			m_Size = 0;
-			if (m_Data)
-				m_Data[0] = '\0';
+			GetData()[0] = '\0';
 		}
 
 		bool Resize(SIZE_T size)
 		{
-			if (size + 1 <= m_Capacity)
+			if (size + 1 <= Capacity())
 			{
 				return false;
 			}
@@ -401,7 +363,7 @@ namespace ME::Core
 			if (m_Size > 0)
 			{
 				m_Size--;
-				m_Data[m_Size] = '\0';
+				GetData()[m_Size] = '\0';
 			}
 		}
 
@@ -418,7 +380,7 @@ namespace ME::Core
 			ME_CORE_ASSERT(start <= m_Size, "Start index out of range!");
 			SIZE_T remaining = m_Size - start;
 			SIZE_T newSize = (length > remaining) ? remaining : length;
-			return PString(m_Data + start, newSize);
+			return PString(GetData() + start, newSize);
 		}
 
 	public:
@@ -543,67 +505,123 @@ namespace ME::Core
 		void Assign(const DataType*& ptr, SIZE_T size)
 		{
 			ME_ASSERT(ptr != nullptr, "Assigning nullptr to string!");
-			if (size + 1 > m_Capacity)
+			if (size + 1 > Capacity())
 				Allocate(size + 1);
 
 			CopyString(ptr, size);
 			m_Size = size;
-			m_Data[m_Size] = '\0';
+			GetData()[m_Size] = '\0';
 		}
 
 	private:
+		inline DataType* GetData() noexcept { return m_IsHeap ? m_Heap.Data : m_Inline; }
+		inline const DataType* GetData() const noexcept { return m_IsHeap ? m_Heap.Data : m_Inline; }
+
+		// Capacities up to InlineCapacity live in the object itself, everything above goes to the heap
 		void Allocate(SIZE_T newCapacity)
 		{
-			Ptr newBlock = m_Allocator.Allocate(newCapacity * sizeof(DataType));
+			DataType* oldData = GetData();
 			SIZE_T copySize = m_Size < newCapacity - 1 ? m_Size : newCapacity - 1;
 
-			if (m_Data)
+			if (newCapacity <= InlineCapacity)
+			{
+				if (IsInline())
+					return;
+
+				// The inline buffer overlays the heap block data, read it out first
+				HeapData oldBlock = m_Heap;
+				memcpy(m_Inline, oldBlock.Data, copySize * sizeof(DataType));
+				m_Allocator.Deallocate(oldBlock.Data, oldBlock.Capacity);
+				m_IsHeap = false;
+			}
+			else
 			{
-				for (SIZE_T i = 0; i < copySize; i++)
-					newBlock[i] = m_Data[i];
-				m_Allocator.Deallocate(m_Data, m_Capacity * sizeof(DataType));
+				Ptr newBlock = m_Allocator.Allocate(newCapacity);
+				memcpy(newBlock, oldData, copySize * sizeof(DataType));
+				DeallocateHeap();
+
+				m_Heap.Data = newBlock;
+				m_Heap.Capacity = newCapacity;
+				m_IsHeap = true;
 			}
 
-			m_Data = newBlock;
-			m_Capacity = newCapacity;
-			if (copySize < m_Size) m_Size = copySize;
-			m_Data[m_Size] = '\0';
+			m_Size = copySize;
+			GetData()[m_Size] = '\0';
+		}
+
+		void DeallocateHeap()
+		{
+			if (m_IsHeap)
+			{
+				m_Allocator.Deallocate(m_Heap.Data, m_Heap.Capacity);
+				m_IsHeap = false;
+			}
+		}
+
+		void InitFrom(const DataType* str, SIZE_T size)
+		{
+			if (size + 1 > InlineCapacity)
+				Allocate(size + 1);
+
+			CopyString(str, size);
+			m_Size = size;
+			GetData()[m_Size] = '\0';
+		}
+
+		void MoveFrom(PString& other)
+		{
+			m_Size = other.m_Size;
+			m_IsHeap = other.m_IsHeap;
+			if (other.IsInline())
+				memcpy(m_Inline, other.m_Inline, (m_Size + 1) * sizeof(DataType));
+			else
+				m_Heap = other.m_Heap;
+
+			other.m_Size = 0;
+			other.m_IsHeap = false;
+			other.m_Inline[0] = '\0';
 		}
 
 		void CopyString(const DataType* str, SIZE_T size)
 		{
-			memcpy(m_Data, str, size * sizeof(DataType));
+			memcpy(GetData(), str, size * sizeof(DataType));
 		}
 
 		PString& AddToString(const DataType* str, SIZE_T size)
 		{
-			if (m_Size + size + 1 > m_Capacity)
+			if (m_Size + size + 1 > Capacity())
+			{
+				// The appended text may point into our own buffer
+				const DataType* data = GetData();
+				bool aliased = str >= data && str < data + m_Size;
+				SIZE_T offset = str - data;
+
 				Allocate((m_Size + size + 1) * STR_RESIZE_MULTIPLYER);
+				if (aliased)
+					str = GetData() + offset;
+			}
 
-			for (SIZE_T i = 0; i < size; i++)
-				m_Data[m_Size + i] = str[i];
+			DataType* data = GetData();
+			memmove(data + m_Size, str, size * sizeof(DataType));
 
 			m_Size += size;
-			m_Data[m_Size] = '\0';
+			data[m_Size] = '\0';
 			return *this;
 		}
 
 		PString& AddChar(const DataType& character)
 		{
-			if (m_Size + 1 >= m_Capacity)
-				Allocate(m_Capacity * STR_RESIZE_MULTIPLYER);
-
-			if (m_Size == 0)
+			if (m_Size + 1 >= Capacity())
 			{
-				m_Data[0] = character;
-				m_Size++;
-				m_Data[m_Size] = '\0';
-				return *this;
+				DataType copy = character;
+				Allocate(Capacity() * STR_RESIZE_MULTIPLYER);
+				return AddChar(copy);
 			}
 
-			m_Data[m_Size] = character;
+			DataType* data = GetData();
+			data[m_Size] = character;
 			m_Size++;
-			m_Data[m_Size] = '\0';
+			data[m_Size] = '\0';
 			return *this;
 		}
 
@@ -612,20 +630,21 @@ namespace ME::Core
 		// Needle - data to find in string
 		SIZE_T PFind(const DataType* needle, SIZE_T needleSize, SIZE_T startAt) const
 		{
+			const DataType* data = GetData();
 			if (needleSize == 0 || startAt >= m_Size || needleSize > m_Size - startAt)
 				return m_Size;
 
-			const Ptr firstChar = needle[0];
+			const DataType firstChar = needle[0];
 			SIZE_T limit = m_Size - needleSize;
 
 			for (SIZE_T i = startAt; i <= limit; ++i)
 			{
-				if (m_Data[i] == firstChar)
+				if (data[i] == firstChar)
 				{
 					bool match = true;
 					for (SIZE_T j = 1; j < needleSize; ++j)
 					{
-						if (m_Data[i + j] != needle[j])
+						if (data[i + j] != needle[j])
 						{
 							match = false;
 							break;
@@ -640,6 +659,7 @@ namespace ME::Core
 
 		SIZE_T PFindFirst(const DataType* needle, SIZE_T needleSize, SIZE_T startAt) const
 		{
+			const DataType* data = GetData();
 			if (!needle || needleSize == 0 || startAt >= m_Size)
 				return m_Size;
 
@@ -649,7 +669,7 @@ namespace ME::Core
 				{
 					for (SIZE_T j = 0; j < needleSize; ++j)
 					{
-						if (m_Data[i] == needle[j])
+						if (data[i] == needle[j])
 							return i;
 					}
 				}
@@ -663,7 +683,7 @@ namespace ME::Core
 						table[static_cast<uint8>(needle[j])] = true;
 
 					for (SIZE_T i = startAt; i < m_Size; ++i)
-						if (table[static_cast<uint8>(m_Data[i])])
+						if (table[static_cast<uint8>(data[i])])
 							return i;
 				}
 				else if constexpr (sizeof(DataType) == 2)
@@ -673,7 +693,7 @@ namespace ME::Core
 						table.set(static_cast<uint16>(needle[j]));
 
 					for (SIZE_T i = startAt; i < m_Size; ++i)
-						if (table.test(static_cast<uint16>(m_Data[i])))
+						if (table.test(static_cast<uint16>(data[i])))
 							return i;
 				}
 				else
@@ -688,6 +708,7 @@ namespace ME::Core
 
 		SIZE_T PFindFirstNot(const DataType* needle, SIZE_T needleSize, SIZE_T startAt) const
 		{
+			const DataType* data = GetData();
 			if (!needle || needleSize == 0 || startAt >= m_Size)
 				return m_Size;
 
@@ -698,7 +719,7 @@ namespace ME::Core
 					bool found = false;
 					for (SIZE_T j = 0; j < needleSize; ++j)
 					{
-						if (m_Data[i] == needle[j])
+						if (data[i] == needle[j])
 						{
 							found = true;
 							break;
@@ -717,7 +738,7 @@ namespace ME::Core
 						table[static_cast<uint8>(needle[j])] = true;
 
 					for (SIZE_T i = startAt; i < m_Size; ++i)
-						if (!table[static_cast<uint8>(m_Data[i])])
+						if (!table[static_cast<uint8>(data[i])])
 							return i;
 				}
 				else if constexpr (sizeof(DataType) == 2)
@@ -727,7 +748,7 @@ namespace ME::Core
 						table.set(static_cast<uint16>(needle[j]));
 
 					for (SIZE_T i = startAt; i < m_Size; ++i)
-						if (!table.test(static_cast<uint16>(m_Data[i])))
+						if (!table.test(static_cast<uint16>(data[i])))
 							return i;
 				}
 				else
@@ -742,6 +763,7 @@ namespace ME::Core
 
 		SIZE_T PFindLast(const DataType* needle, SIZE_T needleSize, SIZE_T startAt) const
 		{
+			const DataType* data = GetData();
 			if (!needle || needleSize == 0 || startAt >= m_Size)
 				return m_Size;
 
@@ -751,7 +773,7 @@ namespace ME::Core
 				{
 					for (SIZE_T j = 0; j < needleSize; ++j)
 					{
-						if (m_Data[i] == needle[j])
+						if (data[i] == needle[j])
 							return i;
 					}
 				}
@@ -765,7 +787,7 @@ namespace ME::Core
 						table[static_cast<uint8>(needle[j])] = true;
 
 					for (SIZE_T i = startAt; i != ~0ull; --i)
-						if (table[static_cast<uint8>(m_Data[i])])
+						if (table[static_cast<uint8>(data[i])])
 							return i;
 				}
 				else if constexpr (sizeof(DataType) == 2)
@@ -775,7 +797,7 @@ namespace ME::Core
 						table.set(static_cast<uint16>(needle[j]));
 
 					for (SIZE_T i = startAt; i != ~0ull; --i)
-						if (table.test(static_cast<uint16>(m_Data[i])))
+						if (table.test(static_cast<uint16>(data[i])))
 							return i;
 				}
 				else
@@ -790,6 +812,7 @@ namespace ME::Core
 
 		SIZE_T PFindLastNot(const DataType* needle, SIZE_T needleSize, SIZE_T startAt) const
 		{
+			const DataType* data = GetData();
 			if (!needle || needleSize == 0 || startAt >= m_Size)
 				return m_Size;
 
@@ -800,7 +823,7 @@ namespace ME::Core
 					bool found = false;
 					for (SIZE_T j = 0; j < needleSize; ++j)
 					{
-						if (m_Data[i] == needle[j])
+						if (data[i] == needle[j])
 						{
 							found = true;
 							break;
@@ -819,7 +842,7 @@ namespace ME::Core
 						table[static_cast<uint8>(needle[j])] = true;
 
 					for (SIZE_T i = startAt; i != ~0ull; --i)
-						if (!table[static_cast<uint8>(m_Data[i])])
+						if (!table[static_cast<uint8>(data[i])])
 							return i;
 				}
 				else if constexpr (sizeof(DataType) == 2)
@@ -829,7 +852,7 @@ namespace ME::Core
 						table.set(static_cast<uint16>(needle[j]));
 
 					for (SIZE_T i = startAt; i != ~0ull; --i)
-						if (!table.test(static_cast<uint16>(m_Data[i])))
+						if (!table.test(static_cast<uint16>(data[i])))
 							return i;
 				}
 				else
@@ -843,10 +866,24 @@ namespace ME::Core
 		}
 
 	private:
+		struct HeapData
+		{
+			Ptr Data;
+			SIZE_T Capacity;
+		};
+
+		// Small strings are stored in place of the heap pointer and capacity.
+		// m_IsHeap sits in the padding after an empty allocator, so String stays 32 bytes
+		static constexpr SIZE_T InlineCapacity = sizeof(HeapData) / sizeof(DataType);
+
 		AllocatorType m_Allocator;
-		Ptr m_Data;
+		bool m_IsHeap;
 		SIZE_T m_Size;
-		SIZE_T m_Capacity;
+		union
+		{
+			HeapData m_Heap;
+			DataType m_Inline[InlineCapacity];
+		};
 
 	};
 
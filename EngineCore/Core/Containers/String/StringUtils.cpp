@@ -1,5 +1,13 @@
 #include "StringUtils.hpp"
 
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <emmintrin.h>
+    #define ME_STRING_UTILS_SSE2
+#endif
+
 namespace ME::Core::Utils
 {
     namespace Helper
@@ -20,6 +28,63 @@ namespace ME::Core::Utils
             hex[1] = HexValues[number & 0x0F];
             return hex;
         }
+
+        // Sets up to this size are matched with one compare per character, larger ones use a lookup table
+        constexpr SIZE_T MaxVectorSetSize = 8;
+
+        inline SIZE_T CountTrailingZeros(uint32 mask)
+        {
+            return static_cast<SIZE_T>(std::countr_zero(mask));
+        }
+
+        inline void BuildCharacterTable(ME::Core::StringView characters, bool (&table)[256])
+        {
+            memset(table, 0, sizeof(table));
+            for (SIZE_T i = 0; i < characters.Size(); ++i)
+                table[static_cast<uint8>(characters[i])] = true;
+        }
+
+        // Returns the first position at or after 'pos' whose character is (or with 'negate' is not) in the set
+        SIZE_T FindInSet(ME::Core::StringView str, ME::Core::StringView characters, SIZE_T pos, bool negate)
+        {
+            const SIZE_T size = str.Size();
+            const uint8* data = reinterpret_cast<const uint8*>(str.String());
+
+            if (characters.Size() == 0)
+                return negate && pos < size ? pos : size;
+
+#ifdef ME_STRING_UTILS_SSE2
+            if (characters.Size() <= MaxVectorSetSize)
+            {
+                __m128i set[MaxVectorSetSize];
+                const SIZE_T setSize = characters.Size();
+                for (SIZE_T i = 0; i < setSize; ++i)
+                    set[i] = _mm_set1_epi8(static_cast<char>(characters[i]));
+
+                const uint32 flip = negate ? 0xFFFFu : 0u;
+                for (; pos + 16 <= size; pos += 16)
+                {
+                    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+                    __m128i matches = _mm_cmpeq_epi8(block, set[0]);
+                    for (SIZE_T i = 1; i < setSize; ++i)
+                        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, set[i]));
+
+                    uint32 mask = static_cast<uint32>(_mm_movemask_epi8(matches)) ^ flip;
+                    if (mask != 0)
+                        return pos + CountTrailingZeros(mask);
+                }
+            }
+#endif
+
+            bool table[256];
+            BuildCharacterTable(characters, table);
+            for (; pos < size; ++pos)
+            {
+                if (table[data[pos]] != negate)
+                    return pos;
+            }
+            return size;
+        }
     }
 
     ME::Core::String ConvertNumberToHex(int64 number)
@@ -93,4 +158,84 @@ namespace ME::Core::Utils
 
         return result;
     }
+
+    SIZE_T Find(ME::Core::StringView str, char8 character, SIZE_T pos)
+    {
+        const SIZE_T size = str.Size();
+        const uint8* data = reinterpret_cast<const uint8*>(str.String());
+
+#ifdef ME_STRING_UTILS_SSE2
+        const __m128i pattern = _mm_set1_epi8(static_cast<char>(character));
+        for (; pos + 16 <= size; pos += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+            if (mask != 0)
+                return pos + Helper::CountTrailingZeros(mask);
+        }
+#endif
+
+        for (; pos < size; ++pos)
+        {
+            if (data[pos] == static_cast<uint8>(character))
+                return pos;
+        }
+        return size;
+    }
+
+    SIZE_T Find(ME::Core::StringView str, ME::Core::StringView needle, SIZE_T pos)
+    {
+        const SIZE_T size = str.Size();
+        const SIZE_T needleSize = needle.Size();
+
+        if (needleSize == 0)
+            return pos <= size ? pos : size;
+        if (needleSize == 1)
+            return Find(str, needle[0], pos);
+        if (pos >= size || size - pos < needleSize)
+            return size;
+
+        const uint8* data = reinterpret_cast<const uint8*>(str.String());
+        const uint8* pattern = reinterpret_cast<const uint8*>(needle.String());
+        const SIZE_T last = size - needleSize; // Last position the needle can start at
+
+#ifdef ME_STRING_UTILS_SSE2
+        // Candidates have to match both the first and the last character of the needle,
+        // which filters out nearly everything before the memcmp
+        const __m128i first = _mm_set1_epi8(static_cast<char>(pattern[0]));
+        const __m128i lastCharacter = _mm_set1_epi8(static_cast<char>(pattern[needleSize - 1]));
+        for (; pos + 16 <= last + 1; pos += 16)
+        {
+            __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + needleSize - 1));
+            uint32 mask = static_cast<uint32>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, lastCharacter))));
+
+            while (mask != 0)
+            {
+                SIZE_T candidate = pos + Helper::CountTrailingZeros(mask);
+                if (memcmp(data + candidate + 1, pattern + 1, needleSize - 2) == 0)
+                    return candidate;
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        for (; pos <= last; ++pos)
+        {
+            if (data[pos] == pattern[0] && memcmp(data + pos + 1, pattern + 1, needleSize - 1) == 0)
+                return pos;
+        }
+        return size;
+    }
+
+    SIZE_T FindFirstOf(ME::Core::StringView str, ME::Core::StringView characters, SIZE_T pos)
+    {
+        return Helper::FindInSet(str, characters, pos, false);
+    }
+
+    SIZE_T FindFirstNotOf(ME::Core::StringView str, ME::Core::StringView characters, SIZE_T pos)
+    {
+        return Helper::FindInSet(str, characters, pos, true);
+    }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "Core.hpp"
 #include "BasicString.hpp"
+#include "StringView.hpp"
+#include "Core/Containers/Array.hpp"
 
 namespace ME::Core::Utils
 {
@@ -16,4 +18,193 @@ namespace ME::Core::Utils
 
     
     COREAPI uint64 ConvertHexToNumber(const ME::Core::String& hex);
+
+    // Search functions over views. They scan 16 bytes per step with SSE2 where available
+    // and return str.Size() when nothing is found, the same as PString::Find*.
+
+    COREAPI SIZE_T Find(ME::Core::StringView str, char8 character, SIZE_T pos = 0);
+    COREAPI SIZE_T Find(ME::Core::StringView str, ME::Core::StringView needle, SIZE_T pos = 0);
+    COREAPI SIZE_T FindFirstOf(ME::Core::StringView str, ME::Core::StringView characters, SIZE_T pos = 0);
+    COREAPI SIZE_T FindFirstNotOf(ME::Core::StringView str, ME::Core::StringView characters, SIZE_T pos = 0);
+
+    // from_chars style parsers. They read the number at the start of 'str' (no whitespace is skipped) and return
+    // the count of consumed characters, or 0 when there is no number or it doesn't fit the type; 'value' is only
+    // written on success. Floats are correctly rounded, so a shortest round-trip print parses back to the same bits.
+
+    COREAPI SIZE_T ParseFloat(ME::Core::StringView str, float64& value);
+    COREAPI SIZE_T ParseFloat(ME::Core::StringView str, float32& value);
+    COREAPI SIZE_T ParseInt(ME::Core::StringView str, int64& value, int8 base = 10);
+    COREAPI SIZE_T ParseInt(ME::Core::StringView str, int32& value, int8 base = 10);
+    COREAPI SIZE_T ParseUint(ME::Core::StringView str, uint64& value, int8 base = 10);
+    COREAPI SIZE_T ParseUint(ME::Core::StringView str, uint32& value, int8 base = 10);
+
+    enum class SplitOptions : uint8
+    {
+        None = 0,
+        SkipEmpty = BIT(0), // Consecutive delimiters don't produce empty tokens
+        AnyOf = BIT(1),     // Every character of the delimiter is a delimiter on its own
+    };
+
+    inline SplitOptions operator|(SplitOptions a, SplitOptions b)
+    {
+        return static_cast<SplitOptions>(static_cast<uint8>(a) | static_cast<uint8>(b));
+    }
+
+    inline bool operator&(SplitOptions a, SplitOptions b)
+    {
+        return (static_cast<uint8>(a) & static_cast<uint8>(b)) != 0;
+    }
+
+    // Walks a string and yields views of the tokens between delimiters. Nothing is copied,
+    // so the tokens stay valid only while the source buffer does.
+    class StringTokenizer
+    {
+    public:
+        StringTokenizer(ME::Core::StringView str, ME::Core::StringView delimiter, SplitOptions options = SplitOptions::None)
+            : m_String(str), m_Delimiter(delimiter), m_Position(0), m_Options(options),
+            m_Character(delimiter.Size() == 1 ? delimiter[0] : 0), m_SingleCharacter(delimiter.Size() == 1), m_Finished(false)
+        {
+        }
+
+        StringTokenizer(ME::Core::StringView str, char8 delimiter, SplitOptions options = SplitOptions::None)
+            : m_String(str), m_Delimiter(), m_Position(0), m_Options(options),
+            m_Character(delimiter), m_SingleCharacter(true), m_Finished(false)
+        {
+        }
+
+    public:
+        // Stores the next token in 'token'. Returns false when the string is exhausted. The last token is
+        // dropped when it's empty, so a trailing delimiter doesn't add one
+        bool Next(ME::Core::StringView& token)
+        {
+            while (!m_Finished)
+            {
+                SIZE_T start = m_Position;
+                SIZE_T end;
+                SIZE_T delimiterSize;
+
+                if (m_SingleCharacter)
+                {
+                    end = Find(m_String, m_Character, start);
+                    delimiterSize = 1;
+                }
+                else if (m_Delimiter.Size() == 0)
+                {
+                    end = m_String.Size();
+                    delimiterSize = 0;
+                }
+                else if (m_Options & SplitOptions::AnyOf)
+                {
+                    end = FindFirstOf(m_String, m_Delimiter, start);
+                    delimiterSize = 1;
+                }
+                else
+                {
+                    end = Find(m_String, m_Delimiter, start);
+                    delimiterSize = m_Delimiter.Size();
+                }
+
+                if (end >= m_String.Size())
+                {
+                    end = m_String.Size();
+                    m_Finished = true;
+                }
+                else
+                    m_Position = end + delimiterSize;
+
+                if (end == start && (m_Finished || (m_Options & SplitOptions::SkipEmpty)))
+                    continue;
+
+                token = ME::Core::StringView(m_String.String() + start, end - start);
+                return true;
+            }
+            return false;
+        }
+
+        // Part of the string which was not tokenized yet
+        ME::Core::StringView Rest() const
+        {
+            if (m_Finished)
+                return ME::Core::StringView(m_String.String() + m_String.Size(), 0);
+            return ME::Core::StringView(m_String.String() + m_Position, m_String.Size() - m_Position);
+        }
+
+    private:
+        ME::Core::StringView m_String;
+        ME::Core::StringView m_Delimiter;
+        SIZE_T m_Position;
+        SplitOptions m_Options;
+        char8 m_Character;
+        bool m_SingleCharacter;
+        bool m_Finished;
+    };
+
+    class StringSplitIterator
+    {
+    public:
+        StringSplitIterator()
+            : m_Tokenizer(ME::Core::StringView(), ME::Core::StringView()), m_Valid(false)
+        {
+        }
+
+        explicit StringSplitIterator(const StringTokenizer& tokenizer)
+            : m_Tokenizer(tokenizer), m_Valid(true)
+        {
+            ++(*this);
+        }
+
+    public:
+        StringSplitIterator& operator++()
+        {
+            m_Valid = m_Tokenizer.Next(m_Token);
+            return *this;
+        }
+
+        inline bool operator==(const StringSplitIterator& it) const { return !m_Valid && !it.m_Valid; }
+        inline bool operator!=(const StringSplitIterator& it) const { return m_Valid || it.m_Valid; }
+
+        inline const ME::Core::StringView& operator*() const { return m_Token; }
+        inline const ME::Core::StringView* operator->() const { return &m_Token; }
+
+    private:
+        StringTokenizer m_Tokenizer;
+        ME::Core::StringView m_Token;
+        bool m_Valid;
+    };
+
+    class StringSplitRange
+    {
+    public:
+        explicit StringSplitRange(const StringTokenizer& tokenizer) : m_Tokenizer(tokenizer) {}
+
+        inline StringSplitIterator begin() const { return StringSplitIterator(m_Tokenizer); }
+        inline StringSplitIterator end() const { return StringSplitIterator(); }
+
+    private:
+        StringTokenizer m_Tokenizer;
+    };
+
+    // for (StringView token : Split(line, TEXT(' '), SplitOptions::SkipEmpty)) ...
+    inline StringSplitRange Split(ME::Core::StringView str, char8 delimiter, SplitOptions options = SplitOptions::None)
+    {
+        return StringSplitRange(StringTokenizer(str, delimiter, options));
+    }
+
+    inline StringSplitRange Split(ME::Core::StringView str, ME::Core::StringView delimiter, SplitOptions options = SplitOptions::None)
+    {
+        return StringSplitRange(StringTokenizer(str, delimiter, options));
+    }
+
+    // Replaces the contents of 'out' (Array, SmallArray, ...) with the tokens and returns their count
+    template <class Container>
+    inline SIZE_T Split(ME::Core::StringView str, Container& out, ME::Core::StringView delimiter,
+        SplitOptions options = SplitOptions::None)
+    {
+        out.Clear();
+        StringTokenizer tokenizer(str, delimiter, options);
+        ME::Core::StringView token;
+        while (tokenizer.Next(token))
+            out.EmplaceBack(token);
+        return out.Size();
+    }
 }
\ No newline at end of file
@@ -44,12 +44,12 @@ namespace ME::Core
 			: m_Data(str.GetString()), m_Size(str.GetSize())
 	    {}
 
-		constexpr PStringView(const PStringView& other)
-			: m_Data(other.m_Data), m_Size(other.m_Size)
-	    {}
+		constexpr PStringView(const PStringView& other) = default;
+		constexpr PStringView& operator=(const PStringView& other) = default;
 
 	public:
 		inline constexpr SIZE_T Size() const noexcept { return m_Size; }
+		inline constexpr bool Empty() const noexcept { return m_Size == 0; }
 		inline constexpr PtrType String() const noexcept { return m_Data; }
 
 		constexpr PtrType begin() const { return m_Data; }
@@ -4,6 +4,9 @@
 #include "Core/Pair.hpp"
 #include "Core/Memory/Hasher.hpp"
 #include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
+
+#include <bit>
 
 namespace ME::Core
 {
@@ -13,13 +16,14 @@ namespace ME::Core
 	    ME::Core::Misc::Pair<KeyType, ValueType> Pair;
 	    KeyType& Key;
 	    ValueType& Value;
+		SIZE_T Hash;
 		MapNode* NextNode;
 
-		MapNode(const KeyType& k, const ValueType& v)
-	        : Pair({ k, v }), Key(Pair.Value1), Value(Pair.Value2), NextNode(nullptr) {}
+		MapNode(const KeyType& k, const ValueType& v, SIZE_T hash)
+	        : Pair({ k, v }), Key(Pair.Value1), Value(Pair.Value2), Hash(hash), NextNode(nullptr) {}
 
-		MapNode(KeyType&& k, ValueType&& v)
-	        : Pair({ std::move(k), std::move(v) }), Key(Pair.Value1), Value(Pair.Value2), NextNode(nullptr) {}
+		MapNode(KeyType&& k, ValueType&& v, SIZE_T hash)
+	        : Pair({ std::move(k), std::move(v) }), Key(Pair.Value1), Value(Pair.Value2), Hash(hash), NextNode(nullptr) {}
 
 		ME::Core::Misc::Pair<KeyType, ValueType>& ToPair() { return Pair; }
 	};
@@ -157,7 +161,7 @@ namespace ME::Core
 	};
 
 	template <typename keyType, typename valType, class _hasher = Core::Memory::Hasher<keyType>, class _allocator =
-	          Memory::Allocator<void>>
+	          Memory::PoolAllocator<void>>
 	class UnorderedMap
 	{
 	public:
@@ -180,15 +184,15 @@ namespace ME::Core
 
 	public:
 		UnorderedMap(SIZE_T initial_size = 16)
-			: m_MaxLoadFactor(1.0f), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0),
-			  m_NodeAllocator(NodeAllocator()), m_Hash(HasherType())
+			: m_MaxLoadFactor(1.0f), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0), m_BucketShift(0),
+			  m_NodeAllocator(NodeAllocator()), m_BucketAllocator(BucketAllocator()), m_Hash(HasherType())
 		{
-			AllocateBuckets(initial_size);
+			AllocateBuckets(RoundBucketCount(initial_size));
 		}
 
 		UnorderedMap(const UnorderedMap& other)
-			: m_MaxLoadFactor(other.m_MaxLoadFactor), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0),
-			  m_NodeAllocator(other.m_NodeAllocator), m_Hash(other.m_Hash)
+			: m_MaxLoadFactor(other.m_MaxLoadFactor), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0), m_BucketShift(0),
+			  m_NodeAllocator(other.m_NodeAllocator), m_BucketAllocator(other.m_BucketAllocator), m_Hash(other.m_Hash)
 		{
 			AllocateBuckets(other.m_NumBuckets);
 
@@ -198,8 +202,8 @@ namespace ME::Core
 				NodeType** tail = &m_Buckets[i];
 				while (current)
 				{
-					NodeType* new_node = m_NodeAllocator.Allocate(sizeof(NodeType));
-					m_NodeAllocator.Construct(new_node, current->Key, current->Value);
+					NodeType* new_node = m_NodeAllocator.Allocate(1);
+					m_NodeAllocator.Construct(new_node, current->Key, current->Value, current->Hash);
 					*tail = new_node;
 					tail = &new_node->NextNode;
 					current = current->NextNode;
@@ -210,7 +214,7 @@ namespace ME::Core
 
 		UnorderedMap(UnorderedMap&& other) noexcept
 			: m_MaxLoadFactor(other.m_MaxLoadFactor), m_Buckets(other.m_Buckets), m_NumElements(other.m_NumElements),
-			  m_NumBuckets(other.m_NumBuckets), m_NodeAllocator(std::move(other.m_NodeAllocator)),
+			  m_NumBuckets(other.m_NumBuckets), m_BucketShift(other.m_BucketShift), m_NodeAllocator(std::move(other.m_NodeAllocator)), m_BucketAllocator(std::move(other.m_BucketAllocator)),
 			  m_Hash(std::move(other.m_Hash))
 		{
 			other.m_Buckets = nullptr;
@@ -231,6 +235,7 @@ namespace ME::Core
 				DeallocateBuckets();
 				m_Hash = other.m_Hash;
 				m_NodeAllocator = other.m_NodeAllocator;
+				m_BucketAllocator = other.m_BucketAllocator;
 				m_MaxLoadFactor = other.m_MaxLoadFactor;
 				AllocateBuckets(other.m_NumBuckets);
 				for (SIZE_T i = 0; i < other.m_NumBuckets; ++i)
@@ -239,8 +244,8 @@ namespace ME::Core
 					NodeType** tail = &m_Buckets[i];
 					while (current)
 					{
-						NodeType* new_node = m_NodeAllocator.Allocate(sizeof(NodeType));
-						m_NodeAllocator.Construct(new_node, current->Key, current->Value);
+						NodeType* new_node = m_NodeAllocator.Allocate(1);
+						m_NodeAllocator.Construct(new_node, current->Key, current->Value, current->Hash);
 						*tail = new_node;
 						tail = &new_node->NextNode;
 						current = current->NextNode;
@@ -260,9 +265,11 @@ namespace ME::Core
 				m_Buckets = other.m_Buckets;
 				m_NumElements = other.m_NumElements;
 				m_NumBuckets = other.m_NumBuckets;
+				m_BucketShift = other.m_BucketShift;
 				m_MaxLoadFactor = other.m_MaxLoadFactor;
 				m_Hash = std::move(other.m_Hash);
 				m_NodeAllocator = std::move(other.m_NodeAllocator);
+				m_BucketAllocator = std::move(other.m_BucketAllocator);
 
 				other.m_Buckets = nullptr;
 				other.m_NumElements = 0;
@@ -370,13 +377,14 @@ namespace ME::Core
 
 		void Erase(const KeyType& key)
 		{
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 			NodeType* prev = nullptr;
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 				{
 					if (prev)
 						prev->NextNode = current->NextNode;
@@ -384,7 +392,7 @@ namespace ME::Core
 						m_Buckets[index] = current->NextNode;
 
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					m_NumElements--;
 					return;
 				}
@@ -397,13 +405,14 @@ namespace ME::Core
 		{
 			KeyType key = iterator->Value1;
 
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 			NodeType* prev = nullptr;
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 				{
 					if (prev)
 						prev->NextNode = current->NextNode;
@@ -411,7 +420,7 @@ namespace ME::Core
 						m_Buckets[index] = current->NextNode;
 
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					m_NumElements--;
 					return;
 				}
@@ -445,11 +454,18 @@ namespace ME::Core
 		{
 			CheckAndRehash();
 
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
+				if (current->Hash != hash)
+				{
+					current = current->NextNode;
+					continue;
+				}
+
 				if constexpr (std::is_same_v<KeyType, const asciichar*> || std::is_same_v<KeyType, const char8*>)
 				{
 					if (strcmp(reinterpret_cast<const asciichar*>(current->Key), key) == 0) 
@@ -465,8 +481,8 @@ namespace ME::Core
 				current = current->NextNode;
 			}
 
-			NodeType* newNode = m_NodeAllocator.Allocate(sizeof(NodeType));
-			new(newNode) NodeType(key, ValueType());
+			NodeType* newNode = m_NodeAllocator.Allocate(1);
+			new(newNode) NodeType(key, ValueType(), hash);
 			newNode->NextNode = m_Buckets[index];
 			m_Buckets[index] = newNode;
 			m_NumElements++;
@@ -478,12 +494,13 @@ namespace ME::Core
 		{
 			CheckAndRehash();
 
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 				{
 					current->Value = value;
 					return;
@@ -491,8 +508,8 @@ namespace ME::Core
 				current = current->NextNode;
 			}
 
-			NodeType* newNode = m_NodeAllocator.Allocate(sizeof(NodeType));
-			m_NodeAllocator.Construct(newNode, key, value);
+			NodeType* newNode = m_NodeAllocator.Allocate(1);
+			m_NodeAllocator.Construct(newNode, key, value, hash);
 			newNode->NextNode = m_Buckets[index];
 			m_Buckets[index] = newNode;
 			m_NumElements++;
@@ -502,12 +519,13 @@ namespace ME::Core
 		{
 			CheckAndRehash();
 
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 				{
 					current->Value = value;
 					return;
@@ -515,8 +533,8 @@ namespace ME::Core
 				current = current->NextNode;
 			}
 
-			NodeType* newNode = m_NodeAllocator.Allocate(sizeof(NodeType));
-			m_NodeAllocator.Construct(newNode, std::move(key), std::move(value));
+			NodeType* newNode = m_NodeAllocator.Allocate(1);
+			m_NodeAllocator.Construct(newNode, std::move(key), std::move(value), hash);
 			newNode->NextNode = m_Buckets[index];
 			m_Buckets[index] = newNode;
 			m_NumElements++;
@@ -525,12 +543,13 @@ namespace ME::Core
 		Iterator PFind(const KeyType& key)
 		{
 			if (m_NumElements <= 0) return End();
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 					return Iterator(current, m_Buckets, m_NumBuckets, index);
 				current = current->NextNode;
 			}
@@ -540,12 +559,13 @@ namespace ME::Core
 		ConstIterator PFind(const KeyType& key) const
 		{
 			if (m_NumElements <= 0) return CEnd();
-			SIZE_T index = GetBucketIndex(key);
+			SIZE_T hash = m_Hash(key);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Key == key)
+				if (current->Hash == hash && current->Key == key)
 					return ConstIterator(current, m_Buckets, m_NumBuckets, index);
 				current = current->NextNode;
 			}
@@ -554,26 +574,44 @@ namespace ME::Core
 
 		bool PReserve(SIZE_T capacity)
 		{
-			if (capacity <= m_NumBuckets)
+			SIZE_T numBuckets = RoundBucketCount(capacity);
+			if (numBuckets <= m_NumBuckets)
 				return false;
 
-			Rehash(capacity);
+			Rehash(numBuckets);
 
 			return true;
 		}
 
 	private:
-		SIZE_T GetBucketIndex(const KeyType& key) const
+		// Fibonacci hashing: the top bits of hash * 2^64/phi pick the bucket, so weak hashers still spread well
+		static inline SIZE_T GetBucketIndex(SIZE_T hash, uint8 shift)
+		{
+			return static_cast<SIZE_T>((static_cast<uint64>(hash) * 11400714819323198485ull) >> shift);
+		}
+
+		inline SIZE_T GetBucketIndex(SIZE_T hash) const
 		{
-			return m_Hash(key, m_NumBuckets);
+			return GetBucketIndex(hash, m_BucketShift);
+		}
+
+		static inline SIZE_T RoundBucketCount(SIZE_T count)
+		{
+			return std::bit_ceil(count < 2 ? static_cast<SIZE_T>(2) : count);
+		}
+
+		static inline uint8 GetBucketShift(SIZE_T numBuckets)
+		{
+			return static_cast<uint8>(64 - std::countr_zero(static_cast<uint64>(numBuckets)));
 		}
 
 		void AllocateBuckets(SIZE_T newBucketsCount)
 		{
-			m_Buckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newBucketsCount * sizeof(NodeType*)));
+			m_Buckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newBucketsCount));
 			for (SIZE_T i = 0; i < newBucketsCount; ++i)
 				m_Buckets[i] = nullptr;
 			m_NumBuckets = newBucketsCount;
+			m_BucketShift = GetBucketShift(newBucketsCount);
 		}
 
 		void DeallocateBuckets()
@@ -581,7 +619,7 @@ namespace ME::Core
 			if (m_Buckets)
 			{
 				ClearBuckets();
-				m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
+				m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets);
 				m_Buckets = nullptr;
 			}
 		}
@@ -595,7 +633,7 @@ namespace ME::Core
 				{
 					NodeType* next = current->NextNode;
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					current = next;
 				}
 				m_Buckets[i] = nullptr;
@@ -605,35 +643,15 @@ namespace ME::Core
 
 		void Rehash()
 		{
-			SIZE_T newSize = m_NumBuckets * 2;
-			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.
-				Allocate(newSize * sizeof(NodeType*)));
-			for (SIZE_T i = 0; i < newSize; ++i)
-				newBuckets[i] = nullptr;
-
-			for (SIZE_T i = 0; i < m_NumBuckets; ++i)
-			{
-				NodeType* current = m_Buckets[i];
-				while (current)
-				{
-					NodeType* next = current->NextNode;
-					SIZE_T new_index = m_Hash(current->Key, newSize);
-					current->NextNode = newBuckets[new_index];
-					newBuckets[new_index] = current;
-					current = next;
-				}
-			}
-
-			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
-			m_Buckets = newBuckets;
-			m_NumBuckets = newSize;
+			Rehash(m_NumBuckets == 0 ? 16 : m_NumBuckets * 2);
 		}
 
+		// Nodes keep their full hash, so moving them to the new buckets never calls the hasher
 		void Rehash(SIZE_T numBuckets)
 		{
 			SIZE_T newSize = numBuckets;
-			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.
-				Allocate(newSize * sizeof(NodeType*)));
+			uint8 newShift = GetBucketShift(newSize);
+			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newSize));
 			for (SIZE_T i = 0; i < newSize; ++i)
 				newBuckets[i] = nullptr;
 
@@ -643,16 +661,17 @@ namespace ME::Core
 				while (current)
 				{
 					NodeType* next = current->NextNode;
-					SIZE_T new_index = m_Hash(current->Key, newSize);
+					SIZE_T new_index = GetBucketIndex(current->Hash, newShift);
 					current->NextNode = newBuckets[new_index];
 					newBuckets[new_index] = current;
 					current = next;
 				}
 			}
 
-			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
+			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets);
 			m_Buckets = newBuckets;
 			m_NumBuckets = newSize;
+			m_BucketShift = newShift;
 		}
 
 		void CheckAndRehash()
@@ -666,6 +685,7 @@ namespace ME::Core
 		NodeType** m_Buckets;
 		SIZE_T m_NumElements;
 		SIZE_T m_NumBuckets;
+		uint8 m_BucketShift;
 
 	private:
 		NodeAllocator m_NodeAllocator;
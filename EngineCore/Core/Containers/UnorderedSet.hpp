@@ -2,6 +2,9 @@
 #include "Core.hpp"
 #include "Core/Memory/Hasher.hpp"
 #include "Core/Memory/Allocators/Allocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
+
+#include <bit>
 
 namespace ME::Core
 {
@@ -9,13 +12,14 @@ namespace ME::Core
 	struct SetNode
 	{
 		const ValueType Value;
+		SIZE_T Hash;
 		SetNode* NextNode;
 
-		SetNode(const ValueType& k) : Value(k), NextNode(nullptr)
+		SetNode(const ValueType& k, SIZE_T hash) : Value(k), Hash(hash), NextNode(nullptr)
 		{
 		}
 
-		SetNode(ValueType&& k) : Value(std::move(k)), NextNode(nullptr)
+		SetNode(ValueType&& k, SIZE_T hash) : Value(std::move(k)), Hash(hash), NextNode(nullptr)
 		{
 		}
 	};
@@ -157,7 +161,7 @@ namespace ME::Core
 	};
 
 	template <typename valueType, class _hasher = Core::Memory::Hasher<valueType>, class _allocator =
-	          Memory::Allocator<void>>
+	          Memory::PoolAllocator<void>>
 	class UnorderedSet
 	{
 	public:
@@ -178,15 +182,15 @@ namespace ME::Core
 
 	public:
 		UnorderedSet(SIZE_T initial_size = 16)
-			: m_MaxLoadFactor(1.0f), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0),
-			  m_NodeAllocator(NodeAllocator()), m_Hash(HasherType())
+			: m_MaxLoadFactor(1.0f), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0), m_BucketShift(0),
+			  m_NodeAllocator(NodeAllocator()), m_BucketAllocator(BucketAllocator()), m_Hash(HasherType())
 		{
-			AllocateBuckets(initial_size);
+			AllocateBuckets(RoundBucketCount(initial_size));
 		}
 
 		UnorderedSet(const UnorderedSet& other)
-			: m_MaxLoadFactor(other.m_MaxLoadFactor), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0),
-			  m_NodeAllocator(other.m_NodeAllocator), m_Hash(other.m_Hash)
+			: m_MaxLoadFactor(other.m_MaxLoadFactor), m_Buckets(nullptr), m_NumElements(0), m_NumBuckets(0), m_BucketShift(0),
+			  m_NodeAllocator(other.m_NodeAllocator), m_BucketAllocator(other.m_BucketAllocator), m_Hash(other.m_Hash)
 		{
 			AllocateBuckets(other.m_NumBuckets);
 
@@ -196,8 +200,8 @@ namespace ME::Core
 				NodeType** tail = &m_Buckets[i];
 				while (current)
 				{
-					NodeType* new_node = m_NodeAllocator.Allocate(sizeof(NodeType));
-					m_NodeAllocator.Construct(new_node, current->Value);
+					NodeType* new_node = m_NodeAllocator.Allocate(1);
+					m_NodeAllocator.Construct(new_node, current->Value, current->Hash);
 					*tail = new_node;
 					tail = &new_node->NextNode;
 					current = current->NextNode;
@@ -208,7 +212,7 @@ namespace ME::Core
 
 		UnorderedSet(UnorderedSet&& other) noexcept
 			: m_MaxLoadFactor(std::move(other.m_MaxLoadFactor)), m_Buckets(std::move(other.m_Buckets)), m_NumElements(std::move(other.m_NumElements)),
-			  m_NumBuckets(std::move(other.m_NumBuckets)), m_NodeAllocator(std::move(other.m_NodeAllocator)),
+			  m_NumBuckets(std::move(other.m_NumBuckets)), m_BucketShift(other.m_BucketShift), m_NodeAllocator(std::move(other.m_NodeAllocator)), m_BucketAllocator(std::move(other.m_BucketAllocator)),
 			  m_Hash(std::move(other.m_Hash))
 		{
 			other.m_Buckets = nullptr;
@@ -229,6 +233,7 @@ namespace ME::Core
 				DeallocateBuckets();
 				m_Hash = other.m_Hash;
 				m_NodeAllocator = other.m_NodeAllocator;
+				m_BucketAllocator = other.m_BucketAllocator;
 				m_MaxLoadFactor = other.m_MaxLoadFactor;
 				AllocateBuckets(other.m_NumBuckets);
 				for (SIZE_T i = 0; i < other.m_NumBuckets; ++i)
@@ -237,8 +242,8 @@ namespace ME::Core
 					NodeType** tail = &m_Buckets[i];
 					while (current)
 					{
-						NodeType* new_node = m_NodeAllocator.Allocate(sizeof(NodeType));
-						m_NodeAllocator.Construct(new_node, current->Value);
+						NodeType* new_node = m_NodeAllocator.Allocate(1);
+						m_NodeAllocator.Construct(new_node, current->Value, current->Hash);
 						*tail = new_node;
 						tail = &new_node->NextNode;
 						current = current->NextNode;
@@ -258,9 +263,11 @@ namespace ME::Core
 				m_Buckets = other.m_Buckets;
 				m_NumElements = other.m_NumElements;
 				m_NumBuckets = other.m_NumBuckets;
+				m_BucketShift = other.m_BucketShift;
 				m_MaxLoadFactor = other.m_MaxLoadFactor;
 				m_Hash = std::move(other.m_Hash);
 				m_NodeAllocator = std::move(other.m_NodeAllocator);
+				m_BucketAllocator = std::move(other.m_BucketAllocator);
 
 				other.m_Buckets = nullptr;
 				other.m_NumElements = 0;
@@ -366,13 +373,14 @@ namespace ME::Core
 
 		void Erase(const ValueType& value)
 		{
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 			NodeType* prev = nullptr;
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 				{
 					if (prev)
 						prev->NextNode = current->NextNode;
@@ -380,7 +388,7 @@ namespace ME::Core
 						m_Buckets[index] = current->NextNode;
 
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					m_NumElements--;
 					return;
 				}
@@ -393,13 +401,14 @@ namespace ME::Core
 		{
 			ValueType value = *iterator;
 
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 			NodeType* prev = nullptr;
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 				{
 					if (prev)
 						prev->NextNode = current->NextNode;
@@ -407,7 +416,7 @@ namespace ME::Core
 						m_Buckets[index] = current->NextNode;
 
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					m_NumElements--;
 					return;
 				}
@@ -436,18 +445,19 @@ namespace ME::Core
 		{
 			CheckAndRehash();
 
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 					return;
 				current = current->NextNode;
 			}
 
-			NodeType* newNode = m_NodeAllocator.Allocate(sizeof(NodeType));
-			m_NodeAllocator.Construct(newNode, value);
+			NodeType* newNode = m_NodeAllocator.Allocate(1);
+			m_NodeAllocator.Construct(newNode, value, hash);
 			newNode->NextNode = m_Buckets[index];
 			m_Buckets[index] = newNode;
 			m_NumElements++;
@@ -457,18 +467,19 @@ namespace ME::Core
 		{
 			CheckAndRehash();
 
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 					return;
 				current = current->NextNode;
 			}
 
-			NodeType* newNode = m_NodeAllocator.Allocate(sizeof(NodeType));
-			m_NodeAllocator.Construct(newNode, std::move(value));
+			NodeType* newNode = m_NodeAllocator.Allocate(1);
+			m_NodeAllocator.Construct(newNode, std::move(value), hash);
 			newNode->NextNode = m_Buckets[index];
 			m_Buckets[index] = newNode;
 			m_NumElements++;
@@ -477,12 +488,13 @@ namespace ME::Core
 		Iterator PFind(const ValueType& value)
 		{
 			if (m_NumElements <= 0) return End();
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 					return Iterator(current, m_Buckets, m_NumBuckets, index);
 				current = current->NextNode;
 			}
@@ -492,12 +504,13 @@ namespace ME::Core
 		ConstIterator PFind(const ValueType& value) const
 		{
 			if (m_NumElements <= 0) return CEnd();
-			SIZE_T index = GetBucketIndex(value);
+			SIZE_T hash = m_Hash(value);
+			SIZE_T index = GetBucketIndex(hash);
 			NodeType* current = m_Buckets[index];
 
 			while (current)
 			{
-				if (current->Value == value)
+				if (current->Hash == hash && current->Value == value)
 					return ConstIterator(current, m_Buckets, m_NumBuckets, index);
 				current = current->NextNode;
 			}
@@ -506,26 +519,44 @@ namespace ME::Core
 
 		bool PReserve(SIZE_T capacity)
 		{
-			if (capacity <= m_NumBuckets)
+			SIZE_T numBuckets = RoundBucketCount(capacity);
+			if (numBuckets <= m_NumBuckets)
 				return false;
 
-			Rehash(capacity);
+			Rehash(numBuckets);
 
 			return true;
 		}
 
 	private:
-		SIZE_T GetBucketIndex(const ValueType& value) const
+		// Fibonacci hashing: the top bits of hash * 2^64/phi pick the bucket, so weak hashers still spread well
+		static inline SIZE_T GetBucketIndex(SIZE_T hash, uint8 shift)
+		{
+			return static_cast<SIZE_T>((static_cast<uint64>(hash) * 11400714819323198485ull) >> shift);
+		}
+
+		inline SIZE_T GetBucketIndex(SIZE_T hash) const
+		{
+			return GetBucketIndex(hash, m_BucketShift);
+		}
+
+		static inline SIZE_T RoundBucketCount(SIZE_T count)
 		{
-			return m_Hash(value, m_NumBuckets);
+			return std::bit_ceil(count < 2 ? static_cast<SIZE_T>(2) : count);
+		}
+
+		static inline uint8 GetBucketShift(SIZE_T numBuckets)
+		{
+			return static_cast<uint8>(64 - std::countr_zero(static_cast<uint64>(numBuckets)));
 		}
 
 		void AllocateBuckets(SIZE_T newBucketsCount)
 		{
-			m_Buckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newBucketsCount * sizeof(NodeType*)));
+			m_Buckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newBucketsCount));
 			for (SIZE_T i = 0; i < newBucketsCount; ++i)
 				m_Buckets[i] = nullptr;
 			m_NumBuckets = newBucketsCount;
+			m_BucketShift = GetBucketShift(newBucketsCount);
 		}
 
 		void DeallocateBuckets()
@@ -533,7 +564,7 @@ namespace ME::Core
 			if (m_Buckets)
 			{
 				ClearBuckets();
-				m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
+				m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets);
 				m_Buckets = nullptr;
 			}
 		}
@@ -547,7 +578,7 @@ namespace ME::Core
 				{
 					NodeType* next = current->NextNode;
 					m_NodeAllocator.Destroy(current);
-					m_NodeAllocator.Deallocate(current, sizeof(NodeType));
+					m_NodeAllocator.Deallocate(current, 1);
 					current = next;
 				}
 				m_Buckets[i] = nullptr;
@@ -557,35 +588,15 @@ namespace ME::Core
 
 		void Rehash()
 		{
-			SIZE_T newSize = m_NumBuckets * 2;
-			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.
-				Allocate(newSize * sizeof(NodeType*)));
-			for (SIZE_T i = 0; i < newSize; ++i)
-				newBuckets[i] = nullptr;
-
-			for (SIZE_T i = 0; i < m_NumBuckets; ++i)
-			{
-				NodeType* current = m_Buckets[i];
-				while (current)
-				{
-					NodeType* next = current->NextNode;
-					SIZE_T new_index = m_Hash(current->Value, newSize);
-					current->NextNode = newBuckets[new_index];
-					newBuckets[new_index] = current;
-					current = next;
-				}
-			}
-
-			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
-			m_Buckets = newBuckets;
-			m_NumBuckets = newSize;
+			Rehash(m_NumBuckets == 0 ? 16 : m_NumBuckets * 2);
 		}
 
+		// Nodes keep their full hash, so moving them to the new buckets never calls the hasher
 		void Rehash(SIZE_T numBuckets)
 		{
 			SIZE_T newSize = numBuckets;
-			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.
-				Allocate(newSize * sizeof(NodeType*)));
+			uint8 newShift = GetBucketShift(newSize);
+			NodeType** newBuckets = reinterpret_cast<NodeType**>(m_BucketAllocator.Allocate(newSize));
 			for (SIZE_T i = 0; i < newSize; ++i)
 				newBuckets[i] = nullptr;
 
@@ -595,16 +606,17 @@ namespace ME::Core
 				while (current)
 				{
 					NodeType* next = current->NextNode;
-					SIZE_T new_index = m_Hash(current->Value, newSize);
+					SIZE_T new_index = GetBucketIndex(current->Hash, newShift);
 					current->NextNode = newBuckets[new_index];
 					newBuckets[new_index] = current;
 					current = next;
 				}
 			}
 
-			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets * sizeof(NodeType*));
+			m_BucketAllocator.Deallocate(m_Buckets, m_NumBuckets);
 			m_Buckets = newBuckets;
 			m_NumBuckets = newSize;
+			m_BucketShift = newShift;
 		}
 
 		void CheckAndRehash()
@@ -618,6 +630,7 @@ namespace ME::Core
 		NodeType** m_Buckets;
 		SIZE_T m_NumElements;
 		SIZE_T m_NumBuckets;
+		uint8 m_BucketShift;
 
 	private:
 		NodeAllocator m_NodeAllocator;
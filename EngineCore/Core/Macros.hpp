@@ -3,7 +3,7 @@
 // Bitwise operations
 
 #define BIT(x) static_cast<uint64>(1 << (x))
-#define IS_POWER_OF_2(x) x && !((x) & ((x) - 1))
+#define IS_POWER_OF_2(x) ((x) && !((x) & ((x) - 1)))
 
 // Attributes
 
@@ -43,6 +43,9 @@
 	
 	//Memory logging macros
 	#define ME_MEM_TRACE(...)		ME::Core::Utility::Logger::GetMemoryLogger()->trace(__VA_ARGS__)
+	#define ME_MEM_INFO(...)		ME::Core::Utility::Logger::GetMemoryLogger()->info(__VA_ARGS__)
+	#define ME_MEM_WARN(...)		ME::Core::Utility::Logger::GetMemoryLogger()->warn(__VA_ARGS__)
+	#define ME_MEM_ERROR(...)		ME::Core::Utility::Logger::GetMemoryLogger()->error(__VA_ARGS__)
 	
 	//Benchmark logging macros
 	#define ME_BENCHMARK_LOG(...)	ME::Core::Utility::Logger::GetBenchmarkLogger()->info(__VA_ARGS__)
@@ -70,6 +73,9 @@
 
 	//Memory logging macros
 	#define ME_MEM_TRACE(...)		SPDLOG_LOGGER_TRACE(ME::Core::Utility::Logger::GetMemoryLogger(), __VA_ARGS__)
+	#define ME_MEM_INFO(...)		SPDLOG_LOGGER_INFO(ME::Core::Utility::Logger::GetMemoryLogger(), __VA_ARGS__)
+	#define ME_MEM_WARN(...)		SPDLOG_LOGGER_WARN(ME::Core::Utility::Logger::GetMemoryLogger(), __VA_ARGS__)
+	#define ME_MEM_ERROR(...)		SPDLOG_LOGGER_ERROR(ME::Core::Utility::Logger::GetMemoryLogger(), __VA_ARGS__)
 	
 	//Benchmark logging macros
 	#define ME_BENCHMARK_LOG(...)	SPDLOG_LOGGER_INFO(ME::Core::Utility::Logger::GetBenchmarkLogger(), __VA_ARGS__)
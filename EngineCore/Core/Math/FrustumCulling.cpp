@@ -0,0 +1,288 @@
+#include "FrustumCulling.hpp"
+#include "SIMD.hpp"
+
+#include <cmath>
+
+namespace ME::Core::Math
+{
+	namespace
+	{
+		// Signed distance of the box's farthest point along the plane normal, in the same order as the SIMD paths
+		// so both agree on boxes that just touch a plane
+		inline float32 BoxDistance(const Vector4D& plane, const BoundingBox& box)
+		{
+			const float32 distance = plane.x * box.CenterPosition.X + plane.y * box.CenterPosition.Y + plane.z * box.CenterPosition.Z + plane.w;
+			const float32 radius = std::abs(plane.x) * box.Extents.X + std::abs(plane.y) * box.Extents.Y + std::abs(plane.z) * box.Extents.Z;
+			return distance + radius;
+		}
+
+		inline float32 SphereDistance(const Vector4D& plane, const BoundingSphere& sphere)
+		{
+			const float32 distance = plane.x * sphere.CenterPosition.X + plane.y * sphere.CenterPosition.Y + plane.z * sphere.CenterPosition.Z + plane.w;
+			return distance + sphere.Radius;
+		}
+
+		// Writes every lane's index and only advances past the visible ones, so there's no branch per bound.
+		// Never writes past the bounds tested so far, which keeps it inside the caller's array
+		inline SIZE_T AppendVisible(uint32 visibleMask, uint32 width, SIZE_T firstIndex, uint32* outVisibleIndices, SIZE_T written)
+		{
+			for (uint32 lane = 0; lane < width; lane++)
+			{
+				outVisibleIndices[written] = static_cast<uint32>(firstIndex + lane);
+				written += (visibleMask >> lane) & 1;
+			}
+			return written;
+		}
+
+		// One plane splat across every lane. Plain structs per width, vector types lose their alignment
+		// attributes as template arguments
+		struct PlaneLanes4
+		{
+			SIMD::Float4 X, Y, Z, W;
+			SIMD::Float4 AbsX, AbsY, AbsZ;
+		};
+
+		struct BoxLanes4
+		{
+			SIMD::Float4 CenterX, CenterY, CenterZ;
+			SIMD::Float4 ExtentX, ExtentY, ExtentZ;
+		};
+
+		struct SphereLanes4
+		{
+			SIMD::Float4 CenterX, CenterY, CenterZ, Radius;
+		};
+
+		void SplatPlanes(const Frustum& frustum, PlaneLanes4 (&planes)[6])
+		{
+			for (uint32 i = 0; i < 6; i++)
+			{
+				const Vector4D& plane = frustum.Planes[i];
+				planes[i] = { SIMD::Splat(plane.x), SIMD::Splat(plane.y), SIMD::Splat(plane.z), SIMD::Splat(plane.w),
+					SIMD::Splat(std::abs(plane.x)), SIMD::Splat(std::abs(plane.y)), SIMD::Splat(std::abs(plane.z)) };
+			}
+		}
+
+		// Four boxes from the array into one lane each. The padding words are loaded too and dropped
+		BoxLanes4 LoadBoxes(const BoundingBox* boxes)
+		{
+			SIMD::Float4 c0 = SIMD::Load(&boxes[0].CenterPosition.X), c1 = SIMD::Load(&boxes[1].CenterPosition.X);
+			SIMD::Float4 c2 = SIMD::Load(&boxes[2].CenterPosition.X), c3 = SIMD::Load(&boxes[3].CenterPosition.X);
+			SIMD::Float4 e0 = SIMD::Load(&boxes[0].Extents.X), e1 = SIMD::Load(&boxes[1].Extents.X);
+			SIMD::Float4 e2 = SIMD::Load(&boxes[2].Extents.X), e3 = SIMD::Load(&boxes[3].Extents.X);
+			SIMD::Transpose(c0, c1, c2, c3);
+			SIMD::Transpose(e0, e1, e2, e3);
+			return { c0, c1, c2, e0, e1, e2 };
+		}
+
+		SphereLanes4 LoadSpheres(const BoundingSphere* spheres)
+		{
+			SIMD::Float4 s0 = SIMD::Load(&spheres[0].CenterPosition.X), s1 = SIMD::Load(&spheres[1].CenterPosition.X);
+			SIMD::Float4 s2 = SIMD::Load(&spheres[2].CenterPosition.X), s3 = SIMD::Load(&spheres[3].CenterPosition.X);
+			SIMD::Transpose(s0, s1, s2, s3);
+			return { s0, s1, s2, s3 };
+		}
+
+		// Bit per lane, set when the bound is on the visible side of all six planes
+		uint32 VisibleBoxes(const PlaneLanes4 (&planes)[6], const BoxLanes4& boxes)
+		{
+			const SIMD::Float4 zero = SIMD::Splat(0.0f);
+			SIMD::Float4 outside = zero;
+			for (const PlaneLanes4& plane : planes)
+			{
+				SIMD::Float4 distance = SIMD::Mul(plane.X, boxes.CenterX);
+				distance = SIMD::Add(distance, SIMD::Mul(plane.Y, boxes.CenterY));
+				distance = SIMD::Add(distance, SIMD::Mul(plane.Z, boxes.CenterZ));
+				distance = SIMD::Add(distance, plane.W);
+
+				SIMD::Float4 radius = SIMD::Mul(plane.AbsX, boxes.ExtentX);
+				radius = SIMD::Add(radius, SIMD::Mul(plane.AbsY, boxes.ExtentY));
+				radius = SIMD::Add(radius, SIMD::Mul(plane.AbsZ, boxes.ExtentZ));
+
+				outside = SIMD::Or(outside, SIMD::CompareLess(SIMD::Add(distance, radius), zero));
+			}
+			return ~SIMD::MoveMask(outside) & 0xF;
+		}
+
+		uint32 VisibleSpheres(const PlaneLanes4 (&planes)[6], const SphereLanes4& spheres)
+		{
+			const SIMD::Float4 zero = SIMD::Splat(0.0f);
+			SIMD::Float4 outside = zero;
+			for (const PlaneLanes4& plane : planes)
+			{
+				SIMD::Float4 distance = SIMD::Mul(plane.X, spheres.CenterX);
+				distance = SIMD::Add(distance, SIMD::Mul(plane.Y, spheres.CenterY));
+				distance = SIMD::Add(distance, SIMD::Mul(plane.Z, spheres.CenterZ));
+				distance = SIMD::Add(distance, plane.W);
+
+				outside = SIMD::Or(outside, SIMD::CompareLess(SIMD::Add(distance, spheres.Radius), zero));
+			}
+			return ~SIMD::MoveMask(outside) & 0xF;
+		}
+
+#if defined(ME_SIMD_AVX2)
+		struct PlaneLanes8
+		{
+			__m256 X, Y, Z, W;
+			__m256 AbsX, AbsY, AbsZ;
+		};
+
+		// Two groups of four bounds side by side, the first group in the lower half
+		inline __m256 Combine(SIMD::Float4 low, SIMD::Float4 high)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+		}
+
+		void SplatPlanes(const Frustum& frustum, PlaneLanes8 (&planes)[6])
+		{
+			for (uint32 i = 0; i < 6; i++)
+			{
+				const Vector4D& plane = frustum.Planes[i];
+				planes[i] = { _mm256_set1_ps(plane.x), _mm256_set1_ps(plane.y), _mm256_set1_ps(plane.z), _mm256_set1_ps(plane.w),
+					_mm256_set1_ps(std::abs(plane.x)), _mm256_set1_ps(std::abs(plane.y)), _mm256_set1_ps(std::abs(plane.z)) };
+			}
+		}
+
+		uint32 VisibleBoxes(const PlaneLanes8 (&planes)[6], const BoxLanes4& low, const BoxLanes4& high)
+		{
+			const __m256 centerX = Combine(low.CenterX, high.CenterX);
+			const __m256 centerY = Combine(low.CenterY, high.CenterY);
+			const __m256 centerZ = Combine(low.CenterZ, high.CenterZ);
+			const __m256 extentX = Combine(low.ExtentX, high.ExtentX);
+			const __m256 extentY = Combine(low.ExtentY, high.ExtentY);
+			const __m256 extentZ = Combine(low.ExtentZ, high.ExtentZ);
+
+			const __m256 zero = _mm256_setzero_ps();
+			__m256 outside = zero;
+			for (const PlaneLanes8& plane : planes)
+			{
+				__m256 distance = _mm256_mul_ps(plane.X, centerX);
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(plane.Y, centerY));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(plane.Z, centerZ));
+				distance = _mm256_add_ps(distance, plane.W);
+
+				__m256 radius = _mm256_mul_ps(plane.AbsX, extentX);
+				radius = _mm256_add_ps(radius, _mm256_mul_ps(plane.AbsY, extentY));
+				radius = _mm256_add_ps(radius, _mm256_mul_ps(plane.AbsZ, extentZ));
+
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+			}
+			return ~static_cast<uint32>(_mm256_movemask_ps(outside)) & 0xFF;
+		}
+
+		uint32 VisibleSpheres(const PlaneLanes8 (&planes)[6], const SphereLanes4& low, const SphereLanes4& high)
+		{
+			const __m256 centerX = Combine(low.CenterX, high.CenterX);
+			const __m256 centerY = Combine(low.CenterY, high.CenterY);
+			const __m256 centerZ = Combine(low.CenterZ, high.CenterZ);
+			const __m256 radius = Combine(low.Radius, high.Radius);
+
+			const __m256 zero = _mm256_setzero_ps();
+			__m256 outside = zero;
+			for (const PlaneLanes8& plane : planes)
+			{
+				__m256 distance = _mm256_mul_ps(plane.X, centerX);
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(plane.Y, centerY));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(plane.Z, centerZ));
+				distance = _mm256_add_ps(distance, plane.W);
+
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+			}
+			return ~static_cast<uint32>(_mm256_movemask_ps(outside)) & 0xFF;
+		}
+#endif
+	}
+
+	BoundingBox TransformBounds(const BoundingBox& box, const Transform& transform)
+	{
+		// Each world axis gets the local extents projected onto it by the absolute rotation and scale
+		const Matrix4x4 rotation = Matrix4x4::FromQuaternion(transform.QRotation());
+		const Vector3D scaledExtents = Vector3D(
+			std::abs(transform.Scale().X) * box.Extents.X,
+			std::abs(transform.Scale().Y) * box.Extents.Y,
+			std::abs(transform.Scale().Z) * box.Extents.Z);
+
+		BoundingBox result = {};
+		result.CenterPosition = transform * box.CenterPosition;
+		result.Extents = Vector3D(
+			std::abs(rotation.m11) * scaledExtents.X + std::abs(rotation.m12) * scaledExtents.Y + std::abs(rotation.m13) * scaledExtents.Z,
+			std::abs(rotation.m21) * scaledExtents.X + std::abs(rotation.m22) * scaledExtents.Y + std::abs(rotation.m23) * scaledExtents.Z,
+			std::abs(rotation.m31) * scaledExtents.X + std::abs(rotation.m32) * scaledExtents.Y + std::abs(rotation.m33) * scaledExtents.Z);
+		return result;
+	}
+
+	BoundingSphere TransformBounds(const BoundingSphere& sphere, const Transform& transform)
+	{
+		const Vector3D& scale = transform.Scale();
+		BoundingSphere result = {};
+		result.CenterPosition = transform * sphere.CenterPosition;
+		result.Radius = sphere.Radius * std::fmax(std::abs(scale.X), std::fmax(std::abs(scale.Y), std::abs(scale.Z)));
+		return result;
+	}
+
+	bool IsVisible(const Frustum& frustum, const BoundingBox& box)
+	{
+		for (const Vector4D& plane : frustum.Planes)
+			if (BoxDistance(plane, box) < 0.0f)
+				return false;
+		return true;
+	}
+
+	bool IsVisible(const Frustum& frustum, const BoundingSphere& sphere)
+	{
+		for (const Vector4D& plane : frustum.Planes)
+			if (SphereDistance(plane, sphere) < 0.0f)
+				return false;
+		return true;
+	}
+
+	SIZE_T CullBoxes(const Frustum& frustum, const BoundingBox* boxes, SIZE_T count, uint32* outVisibleIndices)
+	{
+		SIZE_T index = 0;
+		SIZE_T written = 0;
+
+#if defined(ME_SIMD_AVX2)
+		PlaneLanes8 wide[6];
+		SplatPlanes(frustum, wide);
+		for (; index + 8 <= count; index += 8)
+		{
+			const uint32 visible = VisibleBoxes(wide, LoadBoxes(boxes + index), LoadBoxes(boxes + index + 4));
+			written = AppendVisible(visible, 8, index, outVisibleIndices, written);
+		}
+#endif
+
+		PlaneLanes4 planes[6];
+		SplatPlanes(frustum, planes);
+		for (; index + 4 <= count; index += 4)
+			written = AppendVisible(VisibleBoxes(planes, LoadBoxes(boxes + index)), 4, index, outVisibleIndices, written);
+
+		for (; index < count; index++)
+			written = AppendVisible(IsVisible(frustum, boxes[index]) ? 1 : 0, 1, index, outVisibleIndices, written);
+		return written;
+	}
+
+	SIZE_T CullSpheres(const Frustum& frustum, const BoundingSphere* spheres, SIZE_T count, uint32* outVisibleIndices)
+	{
+		SIZE_T index = 0;
+		SIZE_T written = 0;
+
+#if defined(ME_SIMD_AVX2)
+		PlaneLanes8 wide[6];
+		SplatPlanes(frustum, wide);
+		for (; index + 8 <= count; index += 8)
+		{
+			const uint32 visible = VisibleSpheres(wide, LoadSpheres(spheres + index), LoadSpheres(spheres + index + 4));
+			written = AppendVisible(visible, 8, index, outVisibleIndices, written);
+		}
+#endif
+
+		PlaneLanes4 planes[6];
+		SplatPlanes(frustum, planes);
+		for (; index + 4 <= count; index += 4)
+			written = AppendVisible(VisibleSpheres(planes, LoadSpheres(spheres + index)), 4, index, outVisibleIndices, written);
+
+		for (; index < count; index++)
+			written = AppendVisible(IsVisible(frustum, spheres[index]) ? 1 : 0, 1, index, outVisibleIndices, written);
+		return written;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Core/Math/Math.hpp"
+#include "Core/Math/Transform.hpp"
+
+namespace ME::Core::Math
+{
+	// Axis aligned box as center and half size, laid out like BoundingBox in the shaders
+	struct alignas(16) BoundingBox
+	{
+		Vector3D32 CenterPosition;
+		uint32 Padding1;
+		Vector3D32 Extents;
+		uint32 Padding2;
+	};
+
+	struct alignas(16) BoundingSphere
+	{
+		Vector3D32 CenterPosition;
+		float32 Radius;
+	};
+
+	// Bounds of the local bounds after the transform scaled, rotated and moved them. The box stays axis aligned
+	// and grows to fit the rotated one
+	COREAPI BoundingBox TransformBounds(const BoundingBox& box, const Transform& transform);
+	COREAPI BoundingSphere TransformBounds(const BoundingSphere& sphere, const Transform& transform);
+
+	// The planes have to point inwards, the way ExtractFrustumFromMatrix() builds them. Bounds crossing a plane
+	// count as visible, so a few bounds outside near the corners of the frustum do as well
+	COREAPI bool IsVisible(const Frustum& frustum, const BoundingBox& box);
+	COREAPI bool IsVisible(const Frustum& frustum, const BoundingSphere& sphere);
+
+	// Tests 8 bounds at a time with AVX2 and 4 otherwise. Writes the indices of the visible ones to
+	// outVisibleIndices in ascending order and returns how many there are, the array needs room for count indices
+	COREAPI SIZE_T CullBoxes(const Frustum& frustum, const BoundingBox* boxes, SIZE_T count, uint32* outVisibleIndices);
+	COREAPI SIZE_T CullSpheres(const Frustum& frustum, const BoundingSphere* spheres, SIZE_T count, uint32* outVisibleIndices);
+}
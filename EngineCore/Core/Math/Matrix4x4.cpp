@@ -3,9 +3,33 @@
 #include "Math.hpp"
 #include "Vector4.hpp"
 #include "Core/Math/Quaternion.hpp"
+#include "Core/Math/SIMD.hpp"
 
 namespace ME::Core::Math
 {
+	namespace
+	{
+		// 2x2 matrices packed row by row into one register
+
+		// A * B
+		inline SIMD::Float4 Matrix2Multiply(SIMD::Float4 a, SIMD::Float4 b)
+		{
+			return SIMD::Add(SIMD::Mul(a, SIMD::Swizzle<0, 3, 0, 3>(b)), SIMD::Mul(SIMD::Swizzle<1, 0, 3, 2>(a), SIMD::Swizzle<2, 1, 2, 1>(b)));
+		}
+
+		// adj(A) * B
+		inline SIMD::Float4 Matrix2AdjointMultiply(SIMD::Float4 a, SIMD::Float4 b)
+		{
+			return SIMD::Sub(SIMD::Mul(SIMD::Swizzle<3, 3, 0, 0>(a), b), SIMD::Mul(SIMD::Swizzle<1, 1, 2, 2>(a), SIMD::Swizzle<2, 3, 0, 1>(b)));
+		}
+
+		// A * adj(B)
+		inline SIMD::Float4 Matrix2MultiplyAdjoint(SIMD::Float4 a, SIMD::Float4 b)
+		{
+			return SIMD::Sub(SIMD::Mul(a, SIMD::Swizzle<3, 0, 3, 0>(b)), SIMD::Mul(SIMD::Swizzle<1, 0, 3, 2>(a), SIMD::Swizzle<2, 1, 2, 1>(b)));
+		}
+	}
+
 	inline Matrix4x4::Matrix4x4()
 		: m11(1.0f), m12(0.0f), m13(0.0f), m14(0.0f),
 		m21(0.0f), m22(1.0f), m23(0.0f), m24(0.0f),
@@ -48,12 +72,9 @@ namespace ME::Core::Math
 	// Column-Major matrix-vector multiplication M * v
 	Vector4<float32> Matrix4x4::operator*(const Vector4<float32>& other) const
 	{
-		return Vector4(
-			other.x * m11 + other.y * m21 + other.z * m31 + other.w * m41,
-			other.x * m12 + other.y * m22 + other.z * m32 + other.w * m42,
-			other.x * m13 + other.y * m23 + other.z * m33 + other.w * m43,
-			other.x * m14 + other.y * m24 + other.z * m34 + other.w * m44
-		);
+		Vector4<float32> result;
+		SIMD::Store(result.XYZW, SIMD::LinearCombine(SIMD::Load(other.XYZW), SIMD::Load(m[0]), SIMD::Load(m[1]), SIMD::Load(m[2]), SIMD::Load(m[3])));
+		return result;
 	}
 
 	// Matrix-scalar multiplication M * C
@@ -82,27 +103,33 @@ namespace ME::Core::Math
 	// Matrix-matrix multiplication A * B
 	Matrix4x4 Matrix4x4::operator*(const Matrix4x4& other) const
 	{
-		return Matrix4x4(
-			m11 * other.m11 + m12 * other.m21 + m13 * other.m31 + m14 * other.m41,
-			m11 * other.m12 + m12 * other.m22 + m13 * other.m32 + m14 * other.m42,
-			m11 * other.m13 + m12 * other.m23 + m13 * other.m33 + m14 * other.m43,
-			m11 * other.m14 + m12 * other.m24 + m13 * other.m34 + m14 * other.m44,
-
-			m21 * other.m11 + m22 * other.m21 + m23 * other.m31 + m24 * other.m41,
-			m21 * other.m12 + m22 * other.m22 + m23 * other.m32 + m24 * other.m42,
-			m21 * other.m13 + m22 * other.m23 + m23 * other.m33 + m24 * other.m43,
-			m21 * other.m14 + m22 * other.m24 + m23 * other.m34 + m24 * other.m44,
-
-			m31 * other.m11 + m32 * other.m21 + m33 * other.m31 + m34 * other.m41,
-			m31 * other.m12 + m32 * other.m22 + m33 * other.m32 + m34 * other.m42,
-			m31 * other.m13 + m32 * other.m23 + m33 * other.m33 + m34 * other.m43,
-			m31 * other.m14 + m32 * other.m24 + m33 * other.m34 + m34 * other.m44,
-
-			m41 * other.m11 + m42 * other.m21 + m43 * other.m31 + m44 * other.m41,
-			m41 * other.m12 + m42 * other.m22 + m43 * other.m32 + m44 * other.m42,
-			m41 * other.m13 + m42 * other.m23 + m43 * other.m33 + m44 * other.m43,
-			m41 * other.m14 + m42 * other.m24 + m43 * other.m34 + m44 * other.m44
-		);
+		Matrix4x4 result;
+#if defined(ME_SIMD_AVX2)
+		// Two rows of A per register against B's rows broadcast to both halves, the sums stay in the same order
+		const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[0]));
+		const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[1]));
+		const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[2]));
+		const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[3]));
+
+		for (uint32 row = 0; row < 4; row += 2)
+		{
+			const __m256 a = _mm256_loadu_ps(&m[0][0] + row * 4);
+			__m256 sum = _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x00), b0);
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x55), b1));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xAA), b2));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xFF), b3));
+			_mm256_storeu_ps(&result.m[0][0] + row * 4, sum);
+		}
+#else
+		const SIMD::Float4 b0 = SIMD::Load(other.m[0]);
+		const SIMD::Float4 b1 = SIMD::Load(other.m[1]);
+		const SIMD::Float4 b2 = SIMD::Load(other.m[2]);
+		const SIMD::Float4 b3 = SIMD::Load(other.m[3]);
+
+		for (uint32 row = 0; row < 4; row++)
+			SIMD::Store(result.m[row], SIMD::LinearCombine(SIMD::Load(m[row]), b0, b1, b2, b3));
+#endif
+		return result;
 	}
 
 	// Matrix-matrix addition A + B
@@ -178,34 +205,61 @@ namespace ME::Core::Math
 	}
 
 	// Matrix invert operation M^-1
+	// Before the SIMD version this returned the cofactors without transposing them, so callers got the
+	// transpose of the inverse. That was a bug, it's the real inverse now
     Matrix4x4 Matrix4x4::Invert() const
     {
-		float32 det = Determinant();
-		if (std::abs(det) < 1e-6f)
+		// Block inverse over the four 2x2 sub-matrices A B / C D. Rounds differently than a cofactor expansion,
+		// expect up to 1e-5 relative difference to it on well conditioned matrices
+		const SIMD::Float4 r0 = SIMD::Load(m[0]);
+		const SIMD::Float4 r1 = SIMD::Load(m[1]);
+		const SIMD::Float4 r2 = SIMD::Load(m[2]);
+		const SIMD::Float4 r3 = SIMD::Load(m[3]);
+
+		const SIMD::Float4 a = SIMD::Shuffle<0, 1, 0, 1>(r0, r1);
+		const SIMD::Float4 b = SIMD::Shuffle<2, 3, 2, 3>(r0, r1);
+		const SIMD::Float4 c = SIMD::Shuffle<0, 1, 0, 1>(r2, r3);
+		const SIMD::Float4 d = SIMD::Shuffle<2, 3, 2, 3>(r2, r3);
+
+		// (|A|, |B|, |C|, |D|)
+		const SIMD::Float4 subDeterminants = SIMD::Sub(
+			SIMD::Mul(SIMD::Shuffle<0, 2, 0, 2>(r0, r2), SIMD::Shuffle<1, 3, 1, 3>(r1, r3)),
+			SIMD::Mul(SIMD::Shuffle<1, 3, 1, 3>(r0, r2), SIMD::Shuffle<0, 2, 0, 2>(r1, r3)));
+		const SIMD::Float4 detA = SIMD::SplatLane<0>(subDeterminants);
+		const SIMD::Float4 detB = SIMD::SplatLane<1>(subDeterminants);
+		const SIMD::Float4 detC = SIMD::SplatLane<2>(subDeterminants);
+		const SIMD::Float4 detD = SIMD::SplatLane<3>(subDeterminants);
+
+		const SIMD::Float4 adjDC = Matrix2AdjointMultiply(d, c);
+		const SIMD::Float4 adjAB = Matrix2AdjointMultiply(a, b);
+
+		// Adjoints of the blocks of the inverse
+		SIMD::Float4 x = SIMD::Sub(SIMD::Mul(detD, a), Matrix2Multiply(b, adjDC));
+		SIMD::Float4 w = SIMD::Sub(SIMD::Mul(detA, d), Matrix2Multiply(c, adjAB));
+		SIMD::Float4 y = SIMD::Sub(SIMD::Mul(detB, c), Matrix2MultiplyAdjoint(d, adjAB));
+		SIMD::Float4 z = SIMD::Sub(SIMD::Mul(detC, b), Matrix2MultiplyAdjoint(a, adjDC));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		SIMD::Float4 trace = SIMD::Mul(adjAB, SIMD::Swizzle<0, 2, 1, 3>(adjDC));
+		trace = SIMD::Add(trace, SIMD::Swizzle<1, 0, 3, 2>(trace));
+		trace = SIMD::Add(trace, SIMD::Swizzle<2, 3, 0, 1>(trace));
+		const SIMD::Float4 det = SIMD::Sub(SIMD::Add(SIMD::Mul(detA, detD), SIMD::Mul(detB, detC)), trace);
+
+		if (std::abs(SIMD::GetX(det)) < 1e-6f)
 			return Matrix4x4(0.0f);
 
-		float32 invDet = 1.0f / det;
+		const SIMD::Float4 invDet = SIMD::Div(SIMD::Set(1.0f, -1.0f, -1.0f, 1.0f), det);
+		x = SIMD::Mul(x, invDet);
+		y = SIMD::Mul(y, invDet);
+		z = SIMD::Mul(z, invDet);
+		w = SIMD::Mul(w, invDet);
 
+		// The shuffles finish the adjoints and lay the blocks out as rows
 		Matrix4x4 result;
-		result.m11 = invDet * (m22 * (m33 * m44 - m34 * m43) - m23 * (m32 * m44 - m34 * m42) + m24 * (m32 * m43 - m33 * m42));
-		result.m12 = invDet * -(m21 * (m33 * m44 - m34 * m43) - m23 * (m31 * m44 - m34 * m41) + m24 * (m31 * m43 - m33 * m41));
-		result.m13 = invDet * (m21 * (m32 * m44 - m34 * m42) - m22 * (m31 * m44 - m34 * m41) + m24 * (m31 * m42 - m32 * m41));
-		result.m14 = invDet * -(m21 * (m32 * m43 - m33 * m42) - m22 * (m31 * m43 - m33 * m41) + m23 * (m31 * m42 - m32 * m41));
-
-		result.m21 = invDet * -(m12 * (m33 * m44 - m34 * m43) - m13 * (m32 * m44 - m34 * m42) + m14 * (m32 * m43 - m33 * m42));
-		result.m22 = invDet * (m11 * (m33 * m44 - m34 * m43) - m13 * (m31 * m44 - m34 * m41) + m14 * (m31 * m43 - m33 * m41));
-		result.m23 = invDet * -(m11 * (m32 * m44 - m34 * m42) - m12 * (m31 * m44 - m34 * m41) + m14 * (m31 * m42 - m32 * m41));
-		result.m24 = invDet * (m11 * (m32 * m43 - m33 * m42) - m12 * (m31 * m43 - m33 * m41) + m13 * (m31 * m42 - m32 * m41));
-
-		result.m31 = invDet * (m12 * (m23 * m44 - m24 * m43) - m13 * (m22 * m44 - m24 * m42) + m14 * (m22 * m43 - m23 * m42));
-		result.m32 = invDet * -(m11 * (m23 * m44 - m24 * m43) - m13 * (m21 * m44 - m24 * m41) + m14 * (m21 * m43 - m23 * m41));
-		result.m33 = invDet * (m11 * (m22 * m44 - m24 * m42) - m12 * (m21 * m44 - m24 * m41) + m14 * (m21 * m42 - m22 * m41));
-		result.m34 = invDet * -(m11 * (m22 * m43 - m23 * m42) - m12 * (m21 * m43 - m23 * m41) + m13 * (m21 * m42 - m22 * m41));
-
-		result.m41 = invDet * -(m12 * (m23 * m34 - m24 * m33) - m13 * (m22 * m34 - m24 * m32) + m14 * (m22 * m33 - m23 * m32));
-		result.m42 = invDet * (m11 * (m23 * m34 - m24 * m33) - m13 * (m21 * m34 - m24 * m31) + m14 * (m21 * m33 - m23 * m31));
-		result.m43 = invDet * -(m11 * (m22 * m34 - m24 * m32) - m12 * (m21 * m34 - m24 * m31) + m14 * (m21 * m32 - m22 * m31));
-		result.m44 = invDet * (m11 * (m22 * m33 - m23 * m32) - m12 * (m21 * m33 - m23 * m31) + m13 * (m21 * m32 - m22 * m31));
+		SIMD::Store(result.m[0], SIMD::Shuffle<3, 1, 3, 1>(x, y));
+		SIMD::Store(result.m[1], SIMD::Shuffle<2, 0, 2, 0>(x, y));
+		SIMD::Store(result.m[2], SIMD::Shuffle<3, 1, 3, 1>(z, w));
+		SIMD::Store(result.m[3], SIMD::Shuffle<2, 0, 2, 0>(z, w));
 		return result;
     }
 
@@ -268,50 +322,50 @@ namespace ME::Core::Math
 	// Matrix transpose operation M^T
 	Matrix4x4 Matrix4x4::Transpose() const
 	{
-		Matrix4x4 mat = {};
-		mat.m[0][0] = this->m[0][0];
-		mat.m[1][1] = this->m[1][1];
-		mat.m[2][2] = this->m[2][2];
-		mat.m[3][3] = this->m[3][3];
-
-		mat.m[0][1] = this->m[1][0];
-		mat.m[0][2] = this->m[2][0];
-		mat.m[0][3] = this->m[3][0];
-
-		mat.m[1][0] = this->m[0][1];
-		mat.m[1][2] = this->m[2][1];
-		mat.m[1][3] = this->m[3][1];
-
-		mat.m[2][0] = this->m[0][2];
-		mat.m[2][1] = this->m[1][2];
-		mat.m[2][3] = this->m[3][2];
-
-		mat.m[3][0] = this->m[0][3];
-		mat.m[3][1] = this->m[1][3];
-		mat.m[3][2] = this->m[2][3];
-
+		SIMD::Float4 r0 = SIMD::Load(m[0]);
+		SIMD::Float4 r1 = SIMD::Load(m[1]);
+		SIMD::Float4 r2 = SIMD::Load(m[2]);
+		SIMD::Float4 r3 = SIMD::Load(m[3]);
+		SIMD::Transpose(r0, r1, r2, r3);
+
+		Matrix4x4 mat;
+		SIMD::Store(mat.m[0], r0);
+		SIMD::Store(mat.m[1], r1);
+		SIMD::Store(mat.m[2], r2);
+		SIMD::Store(mat.m[3], r3);
 		return mat;
 	}
 
 	// Vector transformation using Matrix
 	Vector3<float32> Matrix4x4::Transform(const Vector3<float32>& axis) const
 	{
-		float32 w = m41 * axis.x + m42 * axis.y + m43 * axis.z + m44;
-		return Vector3(
-			(m11 * axis.x + m12 * axis.y + m13 * axis.z + m14) / w,
-			(m21 * axis.x + m22 * axis.y + m23 * axis.z + m24) / w,
-			(m31 * axis.x + m32 * axis.y + m33 * axis.z + m34) / w
-		);
+		// Products of every row with (x, y, z, 1), transposed so adding the columns gives the row sums
+		const SIMD::Float4 point = SIMD::Set(axis.x, axis.y, axis.z, 1.0f);
+		SIMD::Float4 c0 = SIMD::Mul(SIMD::Load(m[0]), point);
+		SIMD::Float4 c1 = SIMD::Mul(SIMD::Load(m[1]), point);
+		SIMD::Float4 c2 = SIMD::Mul(SIMD::Load(m[2]), point);
+		SIMD::Float4 c3 = SIMD::Mul(SIMD::Load(m[3]), point);
+		SIMD::Transpose(c0, c1, c2, c3);
+
+		const SIMD::Float4 sums = SIMD::Add(SIMD::Add(SIMD::Add(c0, c1), c2), c3);
+		float32 result[4];
+		SIMD::Store(result, SIMD::Div(sums, SIMD::SplatLane<3>(sums)));
+		return Vector3(result[0], result[1], result[2]);
 	}
 
 	// Unit vector transformation using Matrix
 	Vector3<float32> Matrix4x4::TransformNormal(const Vector3<float32>& axis) const
 	{
-		return Vector3(
-			(axis.x * m11 + axis.y * m12 + axis.z * m13),
-			(axis.x * m21 + axis.y * m22 + axis.z * m23),
-			(axis.x * m31 + axis.y * m32 + axis.z * m33)
-		);
+		const SIMD::Float4 normal = SIMD::Set(axis.x, axis.y, axis.z, 0.0f);
+		SIMD::Float4 c0 = SIMD::Mul(SIMD::Load(m[0]), normal);
+		SIMD::Float4 c1 = SIMD::Mul(SIMD::Load(m[1]), normal);
+		SIMD::Float4 c2 = SIMD::Mul(SIMD::Load(m[2]), normal);
+		SIMD::Float4 c3 = SIMD::Splat(0.0f);
+		SIMD::Transpose(c0, c1, c2, c3);
+
+		float32 result[4];
+		SIMD::Store(result, SIMD::Add(SIMD::Add(c0, c1), c2));
+		return Vector3(result[0], result[1], result[2]);
 	}
 
 	// Look vector calculation
@@ -487,6 +541,27 @@ namespace ME::Core::Math
 		);
 	}
 
+	// Matrix creation from translation, rotation and scale
+	Matrix4x4 Matrix4x4::FromTranslationRotationScale(const Vector3<float32>& translation, const Quaternion& rotation, const Vector3<float32>& scale)
+	{
+		// FromTranslation(t) * FromQuaternion(q) * FromScale(s) without the two full products. Leaving out the
+		// terms multiplied by 0 and 1 doesn't change the result for finite inputs
+		const Matrix4x4 rotationMatrix = FromQuaternion(rotation);
+		const SIMD::Float4 r0 = SIMD::Load(rotationMatrix.m[0]);
+		const SIMD::Float4 r1 = SIMD::Load(rotationMatrix.m[1]);
+		const SIMD::Float4 r2 = SIMD::Load(rotationMatrix.m[2]);
+		const SIMD::Float4 r3 = SIMD::Load(rotationMatrix.m[3]);
+		const SIMD::Float4 scaleRow = SIMD::Set(scale.X, scale.Y, scale.Z, 1.0f);
+		const SIMD::Float4 translationRow = SIMD::Set(translation.X, translation.Y, translation.Z, 1.0f);
+
+		Matrix4x4 result;
+		SIMD::Store(result.m[0], SIMD::Mul(r0, scaleRow));
+		SIMD::Store(result.m[1], SIMD::Mul(r1, scaleRow));
+		SIMD::Store(result.m[2], SIMD::Mul(r2, scaleRow));
+		SIMD::Store(result.m[3], SIMD::Mul(SIMD::LinearCombine(translationRow, r0, r1, r2, r3), scaleRow));
+		return result;
+	}
+
 	// Matrix creation from translation
 	Matrix4x4 Matrix4x4::FromTranslation(const Vector3<float32>& translation)
 	{
@@ -567,11 +642,6 @@ namespace ME::Core::Math
 	// Row-Major matrix-vector multiplication v * M
 	Vector4<float32> operator*(const Vector4<float32>& vector, const Matrix4x4& matrix)
 	{
-		return ME::Core::Math::Vector4D(
-			vector.x * matrix.m11 + vector.y * matrix.m21 + vector.z * matrix.m31 + vector.w * matrix.m41,
-			vector.x * matrix.m12 + vector.y * matrix.m22 + vector.z * matrix.m32 + vector.w * matrix.m42,
-			vector.x * matrix.m13 + vector.y * matrix.m23 + vector.z * matrix.m33 + vector.w * matrix.m43,
-			vector.x * matrix.m14 + vector.y * matrix.m24 + vector.z * matrix.m34 + vector.w * matrix.m44
-		);
+		return matrix * vector;
 	}
 }
\ No newline at end of file
@@ -71,6 +71,8 @@ namespace ME::Core::Math
 
 	public:
 		static Matrix4x4 FromQuaternion(const Quaternion& q);
+		// Same as FromTranslation(translation) * FromQuaternion(rotation) * FromScale(scale)
+		static Matrix4x4 FromTranslationRotationScale(const Vector3<float32>& translation, const Quaternion& rotation, const Vector3<float32>& scale);
 		static Matrix4x4 FromTranslation(const Vector3<float32>& translation);
 		static Matrix4x4 FromScale(const Vector3<float32>& scale);
 		static Matrix4x4 FromPerspectiveView(float32 fov, float32 aspect, float32 _near, float32 _far);
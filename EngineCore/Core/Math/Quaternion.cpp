@@ -2,6 +2,7 @@
 
 #include "Math.hpp"
 #include "Matrix4x4.hpp"
+#include "SIMD.hpp"
 
 namespace ME::Core::Math
 {
@@ -13,13 +14,19 @@ namespace ME::Core::Math
 
 		dot = std::clamp(dot, -1.0f, 1.0f);
 
-		float32 angle = acos(dot);
+		// Float versions of the trig functions, the double ones cost more than the rest of the slerp together
+		float32 angle = std::acos(dot);
 
 		if (std::abs(angle) < 1e-6f)
 			return *this;
 
-		float32 sinAngle = sin(angle);
-		return *this * (sin((1.0f - alpha) * angle) / sinAngle) + q2 * (sin(alpha * angle) / sinAngle);
+		float32 sinAngle = std::sin(angle);
+		const SIMD::Float4 from = SIMD::Mul(SIMD::Load(&w), SIMD::Splat(std::sin((1.0f - alpha) * angle) / sinAngle));
+		const SIMD::Float4 to = SIMD::Mul(SIMD::Load(&q2.w), SIMD::Splat(std::sin(alpha * angle) / sinAngle));
+
+		Quaternion result;
+		SIMD::Store(&result.w, SIMD::Add(from, to));
+		return result;
 	}
 
 	inline Quaternion Quaternion::FromEulerAnglesXYZ(const Vector3<float32>& angles)
@@ -206,10 +213,17 @@ namespace ME::Core::Math
 
     Vector3<float32> Quaternion::RotateVector(const Vector3<float32>& vec) const
 	{
-		Vector3<float32> u(x, y, z);
-		float32 uvD = u.Dot(vec);
-		Vector3<float32> uvC = u.Cross(vec);
-		return 2.f * (uvD * u + w * uvC) + (w * w - u.LengthSquared()) * vec;
+		// 2 * (dot(u, v) * u + w * cross(u, v)) + (w * w - dot(u, u)) * v with u = (x, y, z)
+		const SIMD::Float4 u = SIMD::Swizzle<1, 2, 3, 0>(SIMD::Load(&w));
+		const SIMD::Float4 v = SIMD::Set(vec.x, vec.y, vec.z, 0.0f);
+		const SIMD::Float4 scalar = SIMD::Splat(w);
+
+		const SIMD::Float4 along = SIMD::Add(SIMD::Mul(SIMD::Dot3(u, v), u), SIMD::Mul(scalar, SIMD::Cross3(u, v)));
+		const SIMD::Float4 scaled = SIMD::Mul(SIMD::Sub(SIMD::Mul(scalar, scalar), SIMD::Dot3(u, u)), v);
+
+		float32 result[4];
+		SIMD::Store(result, SIMD::Add(SIMD::Mul(SIMD::Splat(2.0f), along), scaled));
+		return Vector3<float32>(result[0], result[1], result[2]);
 	}
 
 	Quaternion Quaternion::Inverse() const
@@ -364,12 +378,16 @@ namespace ME::Core::Math
 
 	Quaternion Quaternion::operator*(const Quaternion& other) const
 	{
-		return Quaternion(
-			w * other.w - x * other.x - y * other.y - z * other.z,
-			w * other.x + x * other.w + y * other.z - z * other.y,
-			w * other.y - x * other.z + y * other.w + z * other.x,
-			w * other.z + x * other.y - y * other.x + z * other.w
-		);
+		// Each column of the Hamilton product, the sign flips make the subtractions exact additions
+		const SIMD::Float4 q = SIMD::Load(&other.w);
+		SIMD::Float4 result = SIMD::Mul(SIMD::Splat(w), q);
+		result = SIMD::Add(result, SIMD::Mul(SIMD::Mul(SIMD::Splat(x), SIMD::Swizzle<1, 0, 3, 2>(q)), SIMD::Set(-1.0f, 1.0f, -1.0f, 1.0f)));
+		result = SIMD::Add(result, SIMD::Mul(SIMD::Mul(SIMD::Splat(y), SIMD::Swizzle<2, 3, 0, 1>(q)), SIMD::Set(-1.0f, 1.0f, 1.0f, -1.0f)));
+		result = SIMD::Add(result, SIMD::Mul(SIMD::Mul(SIMD::Splat(z), SIMD::Swizzle<3, 2, 1, 0>(q)), SIMD::Set(-1.0f, -1.0f, 1.0f, 1.0f)));
+
+		Quaternion product;
+		SIMD::Store(&product.w, result);
+		return product;
 	}
 
 	Quaternion& Quaternion::operator=(const Quaternion& other)
@@ -0,0 +1,186 @@
+#pragma once
+#include "Core.hpp"
+
+// The backend is picked at compile time. Every x64 target has SSE2, which is all the 4-wide kernels need.
+// AVX2 builds also get the 8-wide paths and AVX-512 builds the 16-wide ones, ARM64 uses NEON and anything else
+// runs the same kernels on plain floats
+#if defined(__AVX512F__)
+	#define ME_SIMD_SSE
+	#define ME_SIMD_AVX2
+	#define ME_SIMD_AVX512
+	#include <immintrin.h>
+#elif defined(__AVX2__)
+	#define ME_SIMD_SSE
+	#define ME_SIMD_AVX2
+	#include <immintrin.h>
+#elif defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+	#define ME_SIMD_SSE
+	#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+	#define ME_SIMD_NEON
+	#include <arm_neon.h>
+#else
+	#define ME_SIMD_SCALAR
+	#include <bit>
+#endif
+
+// Kernels written against these wrappers keep the operation order of the scalar code they replace, so they
+// give bit-identical results as long as the compiler doesn't contract multiplies and adds into FMAs
+namespace ME::Core::Math::SIMD
+{
+#if defined(ME_SIMD_SSE)
+	using Float4 = __m128;
+
+	inline Float4 Load(const float32* data) { return _mm_loadu_ps(data); }
+	inline void Store(float32* data, Float4 value) { _mm_storeu_ps(data, value); }
+	inline Float4 Set(float32 x, float32 y, float32 z, float32 w) { return _mm_setr_ps(x, y, z, w); }
+	inline Float4 Splat(float32 value) { return _mm_set1_ps(value); }
+	inline float32 GetX(Float4 value) { return _mm_cvtss_f32(value); }
+
+	inline Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+	inline Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+	inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+
+	// Comparisons give all bits set in the lanes where they hold, MoveMask packs one bit per lane, x first
+	inline Float4 CompareLess(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+	inline Float4 Or(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+	inline uint32 MoveMask(Float4 mask) { return static_cast<uint32>(_mm_movemask_ps(mask)); }
+
+	// (a[X], a[Y], b[Z], b[W])
+	template <uint32 X, uint32 Y, uint32 Z, uint32 W>
+	inline Float4 Shuffle(Float4 a, Float4 b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X)); }
+
+	inline void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) { _MM_TRANSPOSE4_PS(r0, r1, r2, r3); }
+#elif defined(ME_SIMD_NEON)
+	using Float4 = float32x4_t;
+
+	inline Float4 Load(const float32* data) { return vld1q_f32(data); }
+	inline void Store(float32* data, Float4 value) { vst1q_f32(data, value); }
+	inline Float4 Set(float32 x, float32 y, float32 z, float32 w)
+	{
+		const float32 values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+	}
+	inline Float4 Splat(float32 value) { return vdupq_n_f32(value); }
+	inline float32 GetX(Float4 value) { return vgetq_lane_f32(value, 0); }
+
+	inline Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+	inline Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+	inline Float4 Min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+
+	inline Float4 CompareLess(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+	inline Float4 Or(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+	inline uint32 MoveMask(Float4 mask)
+	{
+		const int32 laneShifts[4] = { 0, 1, 2, 3 };
+		return vaddvq_u32(vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask), 31), vld1q_s32(laneShifts)));
+	}
+
+	template <uint32 X, uint32 Y, uint32 Z, uint32 W>
+	inline Float4 Shuffle(Float4 a, Float4 b)
+	{
+#if defined(__clang__)
+		return __builtin_shufflevector(a, b, X, Y, Z + 4, W + 4);
+#else
+		Float4 result = vdupq_n_f32(vgetq_lane_f32(a, X));
+		result = vsetq_lane_f32(vgetq_lane_f32(a, Y), result, 1);
+		result = vsetq_lane_f32(vgetq_lane_f32(b, Z), result, 2);
+		return vsetq_lane_f32(vgetq_lane_f32(b, W), result, 3);
+#endif
+	}
+
+	inline void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+	{
+		const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+		const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+		r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+		r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+		r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+#else
+	struct Float4
+	{
+		float32 Lanes[4];
+	};
+
+	inline Float4 Load(const float32* data) { return { { data[0], data[1], data[2], data[3] } }; }
+	inline void Store(float32* data, Float4 value) { for (uint32 i = 0; i < 4; i++) data[i] = value.Lanes[i]; }
+	inline Float4 Set(float32 x, float32 y, float32 z, float32 w) { return { { x, y, z, w } }; }
+	inline Float4 Splat(float32 value) { return { { value, value, value, value } }; }
+	inline float32 GetX(Float4 value) { return value.Lanes[0]; }
+
+#define ME_SIMD_SCALAR_OP(name, expression)								\
+	inline Float4 name(Float4 a, Float4 b)								\
+	{																	\
+		Float4 result;													\
+		for (uint32 i = 0; i < 4; i++)									\
+			result.Lanes[i] = expression;								\
+		return result;													\
+	}
+
+	ME_SIMD_SCALAR_OP(Add, a.Lanes[i] + b.Lanes[i])
+	ME_SIMD_SCALAR_OP(Sub, a.Lanes[i] - b.Lanes[i])
+	ME_SIMD_SCALAR_OP(Mul, a.Lanes[i] * b.Lanes[i])
+	ME_SIMD_SCALAR_OP(Div, a.Lanes[i] / b.Lanes[i])
+	ME_SIMD_SCALAR_OP(Min, a.Lanes[i] < b.Lanes[i] ? a.Lanes[i] : b.Lanes[i])
+	ME_SIMD_SCALAR_OP(Max, a.Lanes[i] > b.Lanes[i] ? a.Lanes[i] : b.Lanes[i])
+	ME_SIMD_SCALAR_OP(CompareLess, std::bit_cast<float32>(a.Lanes[i] < b.Lanes[i] ? ~0u : 0u))
+	ME_SIMD_SCALAR_OP(Or, std::bit_cast<float32>(std::bit_cast<uint32>(a.Lanes[i]) | std::bit_cast<uint32>(b.Lanes[i])))
+#undef ME_SIMD_SCALAR_OP
+
+	inline uint32 MoveMask(Float4 mask)
+	{
+		uint32 result = 0;
+		for (uint32 i = 0; i < 4; i++)
+			result |= (std::bit_cast<uint32>(mask.Lanes[i]) >> 31) << i;
+		return result;
+	}
+
+	template <uint32 X, uint32 Y, uint32 Z, uint32 W>
+	inline Float4 Shuffle(Float4 a, Float4 b) { return { { a.Lanes[X], a.Lanes[Y], b.Lanes[Z], b.Lanes[W] } }; }
+
+	inline void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+	{
+		const Float4 c0 = { { r0.Lanes[0], r1.Lanes[0], r2.Lanes[0], r3.Lanes[0] } };
+		const Float4 c1 = { { r0.Lanes[1], r1.Lanes[1], r2.Lanes[1], r3.Lanes[1] } };
+		const Float4 c2 = { { r0.Lanes[2], r1.Lanes[2], r2.Lanes[2], r3.Lanes[2] } };
+		const Float4 c3 = { { r0.Lanes[3], r1.Lanes[3], r2.Lanes[3], r3.Lanes[3] } };
+		r0 = c0; r1 = c1; r2 = c2; r3 = c3;
+	}
+#endif
+
+	template <uint32 X, uint32 Y, uint32 Z, uint32 W>
+	inline Float4 Swizzle(Float4 value) { return Shuffle<X, Y, Z, W>(value, value); }
+
+	template <uint32 Lane>
+	inline Float4 SplatLane(Float4 value) { return Shuffle<Lane, Lane, Lane, Lane>(value, value); }
+
+	// ((a.x * b.x + a.y * b.y) + a.z * b.z) in every lane, same order as Vector3::Dot
+	inline Float4 Dot3(Float4 a, Float4 b)
+	{
+		const Float4 products = Mul(a, b);
+		return Add(Add(SplatLane<0>(products), SplatLane<1>(products)), SplatLane<2>(products));
+	}
+
+	// Same terms as Vector3::Cross, w ends up 0
+	inline Float4 Cross3(Float4 a, Float4 b)
+	{
+		return Sub(Mul(Swizzle<1, 2, 0, 3>(a), Swizzle<2, 0, 1, 3>(b)), Mul(Swizzle<2, 0, 1, 3>(a), Swizzle<1, 2, 0, 3>(b)));
+	}
+
+	// x * r0 + y * r1 + z * r2 + w * r3, summed left to right like the scalar row-vector product
+	inline Float4 LinearCombine(Float4 value, Float4 r0, Float4 r1, Float4 r2, Float4 r3)
+	{
+		Float4 result = Mul(SplatLane<0>(value), r0);
+		result = Add(result, Mul(SplatLane<1>(value), r1));
+		result = Add(result, Mul(SplatLane<2>(value), r2));
+		return Add(result, Mul(SplatLane<3>(value), r3));
+	}
+}
@@ -1,7 +1,14 @@
 #include "Transform.hpp"
+#include "TransformBatch.hpp"
 
 namespace ME::Core::Math
 {
+    namespace
+    {
+        // Dirty transforms gathered per ComposeTransforms() call, the structure-of-arrays copy lives on the stack
+        constexpr SIZE_T UPDATE_BATCH_SIZE = 128;
+    }
+
     Transform::Transform()
         : m_Position(Vector3D::ZeroVector),
         m_Rotation(Quaternion::Identity),
@@ -10,4 +17,49 @@ namespace ME::Core::Math
     {
     }
 
-}
\ No newline at end of file
+    void Transform::UpdateMatrices(Transform* const* transforms, SIZE_T count)
+    {
+        float32 values[10][UPDATE_BATCH_SIZE];
+        Transform* batch[UPDATE_BATCH_SIZE];
+        // Every matrix gets overwritten, so skip constructing them
+        alignas(Matrix4x4) uint8 matrixStorage[UPDATE_BATCH_SIZE * sizeof(Matrix4x4)];
+        Matrix4x4* matrices = reinterpret_cast<Matrix4x4*>(matrixStorage);
+
+        const TransformArrays arrays = {
+            values[0], values[1], values[2],
+            values[3], values[4], values[5], values[6],
+            values[7], values[8], values[9]
+        };
+
+        SIZE_T index = 0;
+        while (index < count)
+        {
+            SIZE_T batchSize = 0;
+            for (; index < count && batchSize < UPDATE_BATCH_SIZE; index++)
+            {
+                Transform* transform = transforms[index];
+                if (!transform->m_Dirty)
+                    continue;
+
+                values[0][batchSize] = transform->m_Position.X;
+                values[1][batchSize] = transform->m_Position.Y;
+                values[2][batchSize] = transform->m_Position.Z;
+                values[3][batchSize] = transform->m_Rotation.w;
+                values[4][batchSize] = transform->m_Rotation.x;
+                values[5][batchSize] = transform->m_Rotation.y;
+                values[6][batchSize] = transform->m_Rotation.z;
+                values[7][batchSize] = transform->m_Scale.X;
+                values[8][batchSize] = transform->m_Scale.Y;
+                values[9][batchSize] = transform->m_Scale.Z;
+                batch[batchSize++] = transform;
+            }
+
+            ComposeTransforms(arrays, batchSize, matrices, MatrixLayout::RowMajor);
+            for (SIZE_T i = 0; i < batchSize; i++)
+            {
+                batch[i]->m_CachedMatrix = matrices[i];
+                batch[i]->m_Dirty = false;
+            }
+        }
+    }
+}
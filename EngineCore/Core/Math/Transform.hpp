@@ -34,6 +34,8 @@ namespace ME::Core::Math
             return m_CachedMatrix;
         }
 
+        bool IsDirty() const { return m_Dirty; }
+
         Vector3D LookVector() const { return Matrix().LookVector(); }
         Vector3D UpVector()   const { return Matrix().UpVector(); }
         Vector3D RightVector()const { return Matrix().RightVector(); }
@@ -107,6 +109,9 @@ namespace ME::Core::Math
             return t;
         }
 
+        // Recalculates the matrices of all dirty transforms in one batch, clean ones are left alone
+        static void UpdateMatrices(Transform* const* transforms, SIZE_T count);
+
         Transform Inverse() const
         {
             Transform inv;
@@ -120,10 +125,7 @@ namespace ME::Core::Math
     private:
         void RecalculateMatrix() const
         {
-            m_CachedMatrix =
-                Matrix4x4::FromTranslation(m_Position) *
-                Matrix4x4::FromQuaternion(m_Rotation) *
-            Matrix4x4::FromScale(m_Scale);
+            m_CachedMatrix = Matrix4x4::FromTranslationRotationScale(m_Position, m_Rotation, m_Scale);
 
             m_Dirty = false;
         }
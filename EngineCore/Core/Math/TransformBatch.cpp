@@ -0,0 +1,260 @@
+#include "TransformBatch.hpp"
+#include "SIMD.hpp"
+
+namespace ME::Core::Math
+{
+	namespace
+	{
+		template<MatrixLayout Layout>
+		constexpr uint32 ElementIndex(uint32 row, uint32 column)
+		{
+			return Layout == MatrixLayout::RowMajor ? row * 4 + column : column * 4 + row;
+		}
+
+		// Each lane type computes one transform per lane. Store() gets the 16 elements of all lane matrices,
+		// element by element, and writes them out matrix by matrix. Everything is spelled out instead of looped
+		// so the compiler keeps the registers in registers
+		struct Lanes4
+		{
+			using Vector = SIMD::Float4;
+			static constexpr SIZE_T Width = 4;
+
+			static Vector Load(const float32* data) { return SIMD::Load(data); }
+			static Vector Splat(float32 value) { return SIMD::Splat(value); }
+			static Vector Add(Vector a, Vector b) { return SIMD::Add(a, b); }
+			static Vector Sub(Vector a, Vector b) { return SIMD::Sub(a, b); }
+			static Vector Mul(Vector a, Vector b) { return SIMD::Mul(a, b); }
+
+			static void StoreRow(Vector r0, Vector r1, Vector r2, Vector r3, Matrix4x4* matrices, uint32 row)
+			{
+				SIMD::Transpose(r0, r1, r2, r3);
+				SIMD::Store(matrices[0].m[row], r0);
+				SIMD::Store(matrices[1].m[row], r1);
+				SIMD::Store(matrices[2].m[row], r2);
+				SIMD::Store(matrices[3].m[row], r3);
+			}
+
+			static void Store(const Vector (&elements)[16], Matrix4x4* matrices)
+			{
+				StoreRow(elements[0], elements[1], elements[2], elements[3], matrices, 0);
+				StoreRow(elements[4], elements[5], elements[6], elements[7], matrices, 1);
+				StoreRow(elements[8], elements[9], elements[10], elements[11], matrices, 2);
+				StoreRow(elements[12], elements[13], elements[14], elements[15], matrices, 3);
+			}
+		};
+
+#if defined(ME_SIMD_AVX2)
+		struct Lanes8
+		{
+			using Vector = __m256;
+			static constexpr SIZE_T Width = 8;
+
+			static Vector Load(const float32* data) { return _mm256_loadu_ps(data); }
+			static Vector Splat(float32 value) { return _mm256_set1_ps(value); }
+			static Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+			static Vector Sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+			static Vector Mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+
+			// 4x4 transposes of four elements in each 128 bit half, lane L of the result holds them for matrix L and L + 4
+			static void TransposeHalves(__m256 e0, __m256 e1, __m256 e2, __m256 e3, __m256& u0, __m256& u1, __m256& u2, __m256& u3)
+			{
+				const __m256 t0 = _mm256_unpacklo_ps(e0, e1);
+				const __m256 t1 = _mm256_unpackhi_ps(e0, e1);
+				const __m256 t2 = _mm256_unpacklo_ps(e2, e3);
+				const __m256 t3 = _mm256_unpackhi_ps(e2, e3);
+				u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+				u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+				u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+				u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+			}
+
+			// Eight elements of matrices 0 to 7, starting at element 'first'
+			static void StoreHalf(const Vector (&elements)[16], uint32 first, Matrix4x4* matrices)
+			{
+				__m256 a0, a1, a2, a3, b0, b1, b2, b3;
+				TransposeHalves(elements[first], elements[first + 1], elements[first + 2], elements[first + 3], a0, a1, a2, a3);
+				TransposeHalves(elements[first + 4], elements[first + 5], elements[first + 6], elements[first + 7], b0, b1, b2, b3);
+
+				float32* destination = &matrices[0].m[0][0] + first;
+				_mm256_storeu_ps(destination, _mm256_permute2f128_ps(a0, b0, 0x20));
+				_mm256_storeu_ps(destination + 16, _mm256_permute2f128_ps(a1, b1, 0x20));
+				_mm256_storeu_ps(destination + 32, _mm256_permute2f128_ps(a2, b2, 0x20));
+				_mm256_storeu_ps(destination + 48, _mm256_permute2f128_ps(a3, b3, 0x20));
+				_mm256_storeu_ps(destination + 64, _mm256_permute2f128_ps(a0, b0, 0x31));
+				_mm256_storeu_ps(destination + 80, _mm256_permute2f128_ps(a1, b1, 0x31));
+				_mm256_storeu_ps(destination + 96, _mm256_permute2f128_ps(a2, b2, 0x31));
+				_mm256_storeu_ps(destination + 112, _mm256_permute2f128_ps(a3, b3, 0x31));
+			}
+
+			static void Store(const Vector (&elements)[16], Matrix4x4* matrices)
+			{
+				StoreHalf(elements, 0, matrices);
+				StoreHalf(elements, 8, matrices);
+			}
+		};
+#endif
+
+#if defined(ME_SIMD_AVX512)
+		struct Lanes16
+		{
+			using Vector = __m512;
+			static constexpr SIZE_T Width = 16;
+
+			static Vector Load(const float32* data) { return _mm512_loadu_ps(data); }
+			static Vector Splat(float32 value) { return _mm512_set1_ps(value); }
+			static Vector Add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+			static Vector Sub(Vector a, Vector b) { return _mm512_sub_ps(a, b); }
+			static Vector Mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+
+			static __m512 UnpackLow64(__m512 a, __m512 b) { return _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(a), _mm512_castps_pd(b))); }
+			static __m512 UnpackHigh64(__m512 a, __m512 b) { return _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(a), _mm512_castps_pd(b))); }
+
+			// 128 bit lane L of u'k' ends up holding the four elements for matrix 4 * L + k
+			static void TransposeLanes(__m512 e0, __m512 e1, __m512 e2, __m512 e3, __m512& u0, __m512& u1, __m512& u2, __m512& u3)
+			{
+				const __m512 t0 = _mm512_unpacklo_ps(e0, e1);
+				const __m512 t1 = _mm512_unpackhi_ps(e0, e1);
+				const __m512 t2 = _mm512_unpacklo_ps(e2, e3);
+				const __m512 t3 = _mm512_unpackhi_ps(e2, e3);
+				u0 = UnpackLow64(t0, t2);
+				u1 = UnpackHigh64(t0, t2);
+				u2 = UnpackLow64(t1, t3);
+				u3 = UnpackHigh64(t1, t3);
+			}
+
+			// Gathers the lanes of q0 to q3 (elements 0-3, 4-7, 8-11 and 12-15) into the matrices k, k + 4, k + 8 and k + 12
+			static void StoreMatrices(__m512 q0, __m512 q1, __m512 q2, __m512 q3, Matrix4x4* matrices, uint32 k)
+			{
+				const __m512 even01 = _mm512_shuffle_f32x4(q0, q1, 0x88);
+				const __m512 odd01 = _mm512_shuffle_f32x4(q0, q1, 0xDD);
+				const __m512 even23 = _mm512_shuffle_f32x4(q2, q3, 0x88);
+				const __m512 odd23 = _mm512_shuffle_f32x4(q2, q3, 0xDD);
+				_mm512_storeu_ps(&matrices[k].m[0][0], _mm512_shuffle_f32x4(even01, even23, 0x88));
+				_mm512_storeu_ps(&matrices[k + 4].m[0][0], _mm512_shuffle_f32x4(odd01, odd23, 0x88));
+				_mm512_storeu_ps(&matrices[k + 8].m[0][0], _mm512_shuffle_f32x4(even01, even23, 0xDD));
+				_mm512_storeu_ps(&matrices[k + 12].m[0][0], _mm512_shuffle_f32x4(odd01, odd23, 0xDD));
+			}
+
+			// A whole matrix fits into one register, so this is one 16x16 transpose
+			static void Store(const Vector (&elements)[16], Matrix4x4* matrices)
+			{
+				__m512 a0, a1, a2, a3, b0, b1, b2, b3, c0, c1, c2, c3, d0, d1, d2, d3;
+				TransposeLanes(elements[0], elements[1], elements[2], elements[3], a0, a1, a2, a3);
+				TransposeLanes(elements[4], elements[5], elements[6], elements[7], b0, b1, b2, b3);
+				TransposeLanes(elements[8], elements[9], elements[10], elements[11], c0, c1, c2, c3);
+				TransposeLanes(elements[12], elements[13], elements[14], elements[15], d0, d1, d2, d3);
+
+				StoreMatrices(a0, b0, c0, d0, matrices, 0);
+				StoreMatrices(a1, b1, c1, d1, matrices, 1);
+				StoreMatrices(a2, b2, c2, d2, matrices, 2);
+				StoreMatrices(a3, b3, c3, d3, matrices, 3);
+			}
+		};
+#endif
+
+		// Column of the row-major matrix from the rotation column, its scale and the translation
+		template<typename Lanes, MatrixLayout Layout>
+		void ComposeColumn(typename Lanes::Vector (&elements)[16], uint32 column, typename Lanes::Vector r0, typename Lanes::Vector r1, typename Lanes::Vector r2,
+			typename Lanes::Vector scale, typename Lanes::Vector translationX, typename Lanes::Vector translationY, typename Lanes::Vector translationZ)
+		{
+			elements[ElementIndex<Layout>(0, column)] = Lanes::Mul(r0, scale);
+			elements[ElementIndex<Layout>(1, column)] = Lanes::Mul(r1, scale);
+			elements[ElementIndex<Layout>(2, column)] = Lanes::Mul(r2, scale);
+
+			// The translation goes through rotation and scale as well, T * R * S in the row-vector convention
+			typename Lanes::Vector translated = Lanes::Mul(translationX, r0);
+			translated = Lanes::Add(translated, Lanes::Mul(translationY, r1));
+			translated = Lanes::Add(translated, Lanes::Mul(translationZ, r2));
+			elements[ElementIndex<Layout>(3, column)] = Lanes::Mul(translated, scale);
+		}
+
+		// Same terms and order as FromQuaternion() and FromTranslationRotationScale(), so each lane gives the same
+		// matrix the single transform path does
+		template<typename Lanes, MatrixLayout Layout>
+		void ComposeLanes(const TransformArrays& transforms, SIZE_T first, Matrix4x4* matrices)
+		{
+			using Vector = typename Lanes::Vector;
+
+			const Vector w = Lanes::Load(transforms.RotationW + first);
+			const Vector x = Lanes::Load(transforms.RotationX + first);
+			const Vector y = Lanes::Load(transforms.RotationY + first);
+			const Vector z = Lanes::Load(transforms.RotationZ + first);
+			const Vector one = Lanes::Splat(1.0f);
+			const Vector two = Lanes::Splat(2.0f);
+
+			const Vector xx = Lanes::Mul(x, x);
+			const Vector yy = Lanes::Mul(y, y);
+			const Vector zz = Lanes::Mul(z, z);
+			const Vector xy = Lanes::Mul(x, y);
+			const Vector xz = Lanes::Mul(x, z);
+			const Vector yz = Lanes::Mul(y, z);
+			const Vector wx = Lanes::Mul(w, x);
+			const Vector wy = Lanes::Mul(w, y);
+			const Vector wz = Lanes::Mul(w, z);
+
+			const Vector r00 = Lanes::Sub(one, Lanes::Mul(two, Lanes::Add(yy, zz)));
+			const Vector r01 = Lanes::Mul(two, Lanes::Sub(xy, wz));
+			const Vector r02 = Lanes::Mul(two, Lanes::Add(xz, wy));
+			const Vector r10 = Lanes::Mul(two, Lanes::Add(xy, wz));
+			const Vector r11 = Lanes::Sub(one, Lanes::Mul(two, Lanes::Add(xx, zz)));
+			const Vector r12 = Lanes::Mul(two, Lanes::Sub(yz, wx));
+			const Vector r20 = Lanes::Mul(two, Lanes::Sub(xz, wy));
+			const Vector r21 = Lanes::Mul(two, Lanes::Add(yz, wx));
+			const Vector r22 = Lanes::Sub(one, Lanes::Mul(two, Lanes::Add(xx, yy)));
+
+			const Vector translationX = Lanes::Load(transforms.PositionX + first);
+			const Vector translationY = Lanes::Load(transforms.PositionY + first);
+			const Vector translationZ = Lanes::Load(transforms.PositionZ + first);
+			const Vector zero = Lanes::Splat(0.0f);
+
+			Vector elements[16];
+			ComposeColumn<Lanes, Layout>(elements, 0, r00, r10, r20, Lanes::Load(transforms.ScaleX + first), translationX, translationY, translationZ);
+			ComposeColumn<Lanes, Layout>(elements, 1, r01, r11, r21, Lanes::Load(transforms.ScaleY + first), translationX, translationY, translationZ);
+			ComposeColumn<Lanes, Layout>(elements, 2, r02, r12, r22, Lanes::Load(transforms.ScaleZ + first), translationX, translationY, translationZ);
+			elements[ElementIndex<Layout>(0, 3)] = zero;
+			elements[ElementIndex<Layout>(1, 3)] = zero;
+			elements[ElementIndex<Layout>(2, 3)] = zero;
+			elements[ElementIndex<Layout>(3, 3)] = one;
+
+			Lanes::Store(elements, matrices + first);
+		}
+
+		template<typename Lanes, MatrixLayout Layout>
+		SIZE_T ComposeFullLanes(const TransformArrays& transforms, SIZE_T first, SIZE_T count, Matrix4x4* matrices)
+		{
+			for (; first + Lanes::Width <= count; first += Lanes::Width)
+				ComposeLanes<Lanes, Layout>(transforms, first, matrices);
+			return first;
+		}
+
+		template<MatrixLayout Layout>
+		void ComposeRange(const TransformArrays& transforms, SIZE_T count, Matrix4x4* matrices)
+		{
+			SIZE_T index = 0;
+#if defined(ME_SIMD_AVX512)
+			index = ComposeFullLanes<Lanes16, Layout>(transforms, index, count, matrices);
+#endif
+#if defined(ME_SIMD_AVX2)
+			index = ComposeFullLanes<Lanes8, Layout>(transforms, index, count, matrices);
+#endif
+			index = ComposeFullLanes<Lanes4, Layout>(transforms, index, count, matrices);
+
+			for (; index < count; index++)
+			{
+				const Matrix4x4 matrix = Matrix4x4::FromTranslationRotationScale(
+					Vector3D(transforms.PositionX[index], transforms.PositionY[index], transforms.PositionZ[index]),
+					Quaternion(transforms.RotationW[index], transforms.RotationX[index], transforms.RotationY[index], transforms.RotationZ[index]),
+					Vector3D(transforms.ScaleX[index], transforms.ScaleY[index], transforms.ScaleZ[index]));
+				matrices[index] = Layout == MatrixLayout::RowMajor ? matrix : matrix.Transpose();
+			}
+		}
+	}
+
+	void ComposeTransforms(const TransformArrays& transforms, SIZE_T count, Matrix4x4* outMatrices, MatrixLayout layout)
+	{
+		if (layout == MatrixLayout::RowMajor)
+			ComposeRange<MatrixLayout::RowMajor>(transforms, count, outMatrices);
+		else
+			ComposeRange<MatrixLayout::ColumnMajor>(transforms, count, outMatrices);
+	}
+}
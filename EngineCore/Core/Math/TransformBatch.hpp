@@ -0,0 +1,34 @@
+#pragma once
+#include "Core/Math/Math.hpp"
+
+namespace ME::Core::Math
+{
+	// Structure-of-arrays input for ComposeTransforms(), every array holds one value per transform
+	struct TransformArrays
+	{
+		const float32* PositionX;
+		const float32* PositionY;
+		const float32* PositionZ;
+
+		const float32* RotationW;
+		const float32* RotationX;
+		const float32* RotationY;
+		const float32* RotationZ;
+
+		const float32* ScaleX;
+		const float32* ScaleY;
+		const float32* ScaleZ;
+	};
+
+	enum class MatrixLayout : uint8
+	{
+		// Same as Matrix4x4::FromTranslationRotationScale()
+		RowMajor,
+		// Its transpose, the way the shaders read instance transforms
+		ColumnMajor,
+	};
+
+	// Builds count TRS matrices in one pass, 16, 8 or 4 transforms at a time depending on the SIMD backend.
+	// Rotations are expected to be normalized, like Transform keeps them
+	COREAPI void ComposeTransforms(const TransformArrays& transforms, SIZE_T count, Matrix4x4* outMatrices, MatrixLayout layout = MatrixLayout::ColumnMajor);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Types.hpp"
+#include "Core/Utility/MemWatch/MemWatch.hpp"
 
 namespace ME::Core::Memory
 {
@@ -19,11 +20,13 @@ namespace ME::Core::Memory
 		{
 			constexpr size_t alignment = alignof(T);
 			void* ptr = ::operator new(n * sizeof(T), std::align_val_t{ alignment });
+			ME_MEMWATCH_ALLOCATION(Utility::MemTag::Containers, n * sizeof(T));
 			return static_cast<T*>(ptr);
 		}
 
 		void Deallocate(T* ptr, SIZE_T n)
 		{
+			ME_MEMWATCH_FREE(Utility::MemTag::Containers, n * sizeof(T));
 			::operator delete(ptr, n * sizeof(T), std::align_val_t{ alignof(T) });
 		}
 
@@ -0,0 +1,100 @@
+#pragma once
+#include "Core/Types.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Allocators/FrameArena.hpp"
+
+namespace ME::Core::Memory
+{
+	// Allocator which takes its memory from a frame arena, the per-frame one unless told otherwise.
+	// Containers using it must be gone before the arena is reset, their destructors still run
+	template <typename T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		ArenaAllocator() noexcept
+			: m_Arena(&FrameArena::Get())
+		{
+		}
+
+		explicit ArenaAllocator(FrameArena& arena) noexcept
+			: m_Arena(&arena)
+		{
+		}
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+			: m_Arena(other.GetArena())
+		{
+		}
+
+		value_type* Allocate(SIZE_T n)
+		{
+			return static_cast<T*>(m_Arena->Allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void Deallocate(T* ptr, SIZE_T n)
+		{
+			m_Arena->Deallocate(ptr, n * sizeof(T));
+		}
+
+		template <typename U>
+		struct Rebind
+		{
+			using Other = ArenaAllocator<U>;
+		};
+
+		template <class Val, class... varg>
+		void Construct(Val* ptr, varg&&... args)
+		{
+			new (static_cast<void*>(ptr)) Val(std::forward<varg>(args)...);
+		}
+
+		template <class Val>
+		void Destroy(Val* ptr)
+		{
+			ptr->~Val();
+		}
+
+		ME_NODISCARD inline FrameArena* GetArena() const noexcept { return m_Arena; }
+
+		bool operator==(const ArenaAllocator& other) const noexcept { return m_Arena == other.m_Arena; }
+		bool operator!=(const ArenaAllocator& other) const noexcept { return m_Arena != other.m_Arena; }
+
+	private:
+		FrameArena* m_Arena;
+	};
+
+	// Binds to the half of the double buffered arena which is current when the allocator is created,
+	// so a container made during a frame keeps its memory through the next one
+	template <typename T>
+	class DoubleBufferedArenaAllocator : public ArenaAllocator<T>
+	{
+	public:
+		DoubleBufferedArenaAllocator() noexcept
+			: ArenaAllocator<T>(FrameArena::GetDoubleBuffered())
+		{
+		}
+
+		template <typename U>
+		DoubleBufferedArenaAllocator(const DoubleBufferedArenaAllocator<U>& other) noexcept
+			: ArenaAllocator<T>(*other.GetArena())
+		{
+		}
+
+		template <typename U>
+		struct Rebind
+		{
+			using Other = DoubleBufferedArenaAllocator<U>;
+		};
+	};
+}
+
+namespace ME::Core
+{
+	// Scratch array for the current frame
+	template <typename T>
+	using FrameArray = Array<T, Memory::ArenaAllocator<T>>;
+}
@@ -1,14 +1,19 @@
 #include "BuddyAllocator.hpp"
 #include "Core/Algorithm.hpp"
 
+#include <bit>
+
 namespace ME::Core::Memory
 {
     BuddyAllocator::BuddyAllocator()
-        : m_MaxLevel(0), m_MinBlockSize(0), m_TotalSize(0)
+        : m_NonEmptyLevels(0), m_FreeBlockCount(0), m_Allocations(sizeof(OAllocation_S), ME_KB(4)),
+          m_MaxLevel(0), m_MinBlockShift(0), m_MinBlockSize(0), m_TotalSize(0),
+          m_RequestedSize(0), m_ReservedSize(0), m_AllocationCount(0)
     {
     }
 
     BuddyAllocator::BuddyAllocator(const BuddyAllocatorSpecification& specification)
+        : BuddyAllocator()
     {
         Init(specification);
     }
@@ -31,138 +36,116 @@ namespace ME::Core::Memory
         return level;
     }
 
-    BuddyAllocatorErrors BuddyAllocator::Init(const BuddyAllocatorSpecification& specification)
+    OffsetAllocatorErrors BuddyAllocator::Init(const BuddyAllocatorSpecification& specification)
     {
         if (!ValidateSpecification(specification))
         {
             ME_CORE_ASSERT(false, ME_LOGGER_TEXT("Buddy allocator can't be initialized with given specification!"));
-            return BuddyAllocatorErrors::IncorrectSpecification;
+            return OffsetAllocatorErrors::IncorrectSpecification;
         }
 
         m_TotalSize = specification.TotalSize;
         m_MinBlockSize = specification.MinBlockSize;
+        m_MinBlockShift = static_cast<uint8>(std::countr_zero(m_MinBlockSize));
         m_MaxLevel = CalculateMaxLevel(m_TotalSize, m_MinBlockSize);
-        m_FreeLists = Array<Array<SIZE_T>>(m_MaxLevel + 1);
-        for (uint8 i = 0; i <= m_MaxLevel; ++i) m_FreeLists[i].Clear();
-        m_FreeLists[m_MaxLevel].EmplaceBack(0);
-
-        m_Allocated.Clear();
-        m_Allocations.Clear();
 
-        return BuddyAllocatorErrors::Success;
+        Clear();
+        return OffsetAllocatorErrors::Success;
     }
 
     void BuddyAllocator::DumpFreeLists() const
     {
-        for (uint8 i = 0; i <= m_MaxLevel; ++i)
-            ME_INFO("Level {0}: {1} blocks\n", i, m_FreeLists[i].Size());
+        for (uint8 i = 0; i <= m_MaxLevel && i < m_FreeHeads.Size(); ++i)
+        {
+            SIZE_T count = 0;
+            for (uint32 block = m_FreeHeads[i]; block != InvalidBlock; block = m_NextFree[block])
+                count++;
+            ME_INFO("Level {0}: {1} blocks\n", i, count);
+        }
     }
 
-    BuddyAllocatorErrors BuddyAllocator::Allocate(OAllocation& allocation, SIZE_T size)
+    OffsetAllocatorErrors BuddyAllocator::Allocate(OAllocation& allocation, SIZE_T size)
     {
         if (m_TotalSize == 0 || m_MinBlockSize == 0)
         {
             ME_CORE_ASSERT(false, ME_LOGGER_TEXT("Buddy allocator isn't initialized!"));
-            return BuddyAllocatorErrors::IncorrectSpecification;
+            return OffsetAllocatorErrors::IncorrectSpecification;
         }
 
-        if (size == 0) return BuddyAllocatorErrors::TooSmallRequest;
-        if (size > m_TotalSize) return BuddyAllocatorErrors::TooBigRequest;
+        if (size == 0) return OffsetAllocatorErrors::TooSmallRequest;
+        if (size > m_TotalSize) return OffsetAllocatorErrors::TooBigRequest;
 
         allocation = nullptr;
 
-        uint8 level = GetLevel(size);
+        const uint8 level = GetLevel(size);
 
-        for (uint8 i = level; i <= m_MaxLevel; ++i)
-        {
-            if (m_FreeLists[i].Empty())
-                continue;
-
-            SIZE_T offset = m_FreeLists[i].Back();
-            m_FreeLists[i].PopBack();
-
-            uint8 cur = i;
-            while (cur > level)
-            {
-                cur--;
-                SIZE_T buddyOffset = offset + GetBlockSize(cur);
-                m_FreeLists[cur].EmplaceBack(buddyOffset);
-            }
+        // Smallest level at or above the requested one which has a free block
+        const uint64 candidates = m_NonEmptyLevels & (~uint64(0) << level);
+        if (candidates == 0)
+            return OffsetAllocatorErrors::OutOfMemory;
 
-            m_Allocated.Insert(offset, level);
+        uint8 cur = static_cast<uint8>(std::countr_zero(candidates));
+        const uint32 block = m_FreeHeads[cur];
+        RemoveFree(cur, block);
 
-            auto allocPtr = new OAllocation_S{ offset, size };
-            m_Allocations.EmplaceBack(allocPtr);
-            allocation = allocPtr;
-            return BuddyAllocatorErrors::Success;
+        // Split down, the upper halves stay free
+        while (cur > level)
+        {
+            cur--;
+            PushFree(cur, block + (uint32(1) << cur));
         }
 
-        return BuddyAllocatorErrors::OutOfMemory;
+        m_AllocatedLevels[block] = static_cast<uint8>(level + 1);
+        m_RequestedSize += size;
+        m_ReservedSize += m_MinBlockSize << level;
+        m_AllocationCount++;
+
+        allocation = new (m_Allocations.Allocate()) OAllocation_S{ static_cast<SIZE_T>(block) << m_MinBlockShift, size };
+        return OffsetAllocatorErrors::Success;
     }
 
-    BuddyAllocatorErrors BuddyAllocator::Free(OAllocation& allocation)
+    OffsetAllocatorErrors BuddyAllocator::Free(OAllocation& allocation)
     {
         if (m_TotalSize == 0 || m_MinBlockSize == 0)
         {
             ME_CORE_ASSERT(false, ME_LOGGER_TEXT("Buddy allocator isn't initialized!"));
-            return BuddyAllocatorErrors::IncorrectSpecification;
+            return OffsetAllocatorErrors::IncorrectSpecification;
         }
 
-        if (!allocation) return BuddyAllocatorErrors::InvalidArgument;
-        if (allocation->Size > m_TotalSize) return BuddyAllocatorErrors::OutOfRange;
-        if (allocation->Offset + allocation->Size > m_TotalSize) return BuddyAllocatorErrors::OutOfRange;
-
-        auto it = m_Allocated.Find(allocation->Offset);
-        if (it == m_Allocated.end()) return BuddyAllocatorErrors::OutOfRange;
-
-        SIZE_T level = it->Value2;
-        m_Allocated.Erase(it);
+        if (!allocation) return OffsetAllocatorErrors::InvalidArgument;
+        if (allocation->Size > m_TotalSize) return OffsetAllocatorErrors::OutOfRange;
+        if (allocation->Offset + allocation->Size > m_TotalSize) return OffsetAllocatorErrors::OutOfRange;
+        if ((allocation->Offset & (m_MinBlockSize - 1)) != 0) return OffsetAllocatorErrors::OutOfRange;
 
-        SIZE_T curOffset = allocation->Offset;
-        while (level < m_MaxLevel)
-        {
-            SIZE_T buddyOffset = GetBuddyOffset(curOffset, static_cast<uint8>(level));
-            auto& list = m_FreeLists[level];
-            auto buddy = ME::Core::Algorithm::Find(list.begin(), list.end(), buddyOffset);
-            if (buddy == list.end())
-                break;
+        const uint32 block = static_cast<uint32>(allocation->Offset >> m_MinBlockShift);
+        if (m_AllocatedLevels[block] == 0) return OffsetAllocatorErrors::OutOfRange;
 
-            list.Erase(buddy);
-            curOffset = ME::Core::Algorithm::Min(curOffset, buddyOffset);
-            level++;
-        }
+        const uint8 level = static_cast<uint8>(m_AllocatedLevels[block] - 1);
+        m_AllocatedLevels[block] = 0;
+        ReleaseBlock(level, block);
 
-        m_FreeLists[level].EmplaceBack(curOffset);
-
-        for (SIZE_T i = 0; i < m_Allocations.Size(); ++i)
-        {
-            if (m_Allocations[i]->Offset == allocation->Offset)
-            {
-                delete m_Allocations[i];
-                m_Allocations.EraseAt(i);
-                break;
-            }
-        }
+        m_RequestedSize -= allocation->Size;
+        m_ReservedSize -= m_MinBlockSize << level;
+        m_AllocationCount--;
 
+        m_Allocations.Deallocate(allocation);
         allocation = nullptr;
-        return BuddyAllocatorErrors::Success;
+        return OffsetAllocatorErrors::Success;
     }
 
     void BuddyAllocator::Clear()
     {
-        for (auto& alloc : m_Allocations)
-            delete alloc;
+        // Handles given out so far die with the allocations
         m_Allocations.Clear();
+        m_RequestedSize = 0;
+        m_ReservedSize = 0;
+        m_AllocationCount = 0;
 
-        for (auto& list : m_FreeLists)
-            list.Clear();
-
-        if (m_MaxLevel > 0)
-            m_FreeLists[m_MaxLevel].EmplaceBack(0);
-        else if (m_FreeLists.Size() > 0)
-            m_FreeLists[0].EmplaceBack(0);
+        if (m_TotalSize == 0 || m_MinBlockSize == 0)
+            return;
 
-        m_Allocated.Clear();
+        BuildTables(m_TotalSize >> m_MinBlockShift);
+        PushFree(m_MaxLevel, 0);
     }
 
     bool BuddyAllocator::Resize(SIZE_T size)
@@ -176,48 +159,196 @@ namespace ME::Core::Memory
             return false;
         }
 
-        SIZE_T oldTotalSize = m_TotalSize;
-        uint8 oldMaxLevel = m_MaxLevel;
+        if (m_TotalSize == 0 || m_MinBlockSize == 0)
+        {
+            ME_CORE_ERROR("BuddyAllocator::Resize: Allocator isn't initialized");
+            return false;
+        }
+
+        if (!ValidateSpecification({ m_MinBlockSize, size }))
+        {
+            ME_CORE_ERROR("BuddyAllocator::Resize: Size is too big");
+            return false;
+        }
+
+        // Gather the free blocks, the table layout changes with the level count
+        ME::Core::Array<uint32> freeBlocks;
+        ME::Core::Array<uint8> freeLevels;
+        for (uint8 level = 0; level <= m_MaxLevel; ++level)
+        {
+            for (uint32 block = m_FreeHeads[level]; block != InvalidBlock; block = m_NextFree[block])
+            {
+                freeBlocks.PushBack(block);
+                freeLevels.PushBack(level);
+            }
+        }
+
+        ME::Core::Array<uint8> allocatedLevels = std::move(m_AllocatedLevels);
+        const uint8 oldMaxLevel = m_MaxLevel;
 
         m_TotalSize = size;
         m_MaxLevel = CalculateMaxLevel(m_TotalSize, m_MinBlockSize);
+        BuildTables(m_TotalSize >> m_MinBlockShift);
+
+        for (SIZE_T i = 0; i < allocatedLevels.Size(); ++i)
+            m_AllocatedLevels[i] = allocatedLevels[i];
+        for (SIZE_T i = 0; i < freeBlocks.Size(); ++i)
+            PushFree(freeLevels[i], freeBlocks[i]);
+
+        // The new range splits into one block per old level count, each merges with what's left of it if free
+        for (uint8 level = oldMaxLevel; level < m_MaxLevel; ++level)
+            ReleaseBlock(level, uint32(1) << level);
+
+        return true;
+    }
 
-        if (m_FreeLists.Size() < m_MaxLevel + 1)
-            if (!m_FreeLists.Reserve(m_MaxLevel + 1))
+    bool BuddyAllocator::Relocate(OAllocation& allocation)
+    {
+        if (!allocation || m_MinBlockSize == 0) return false;
+        if (allocation->Offset >= m_TotalSize || (allocation->Offset & (m_MinBlockSize - 1)) != 0) return false;
+
+        const uint32 block = static_cast<uint32>(allocation->Offset >> m_MinBlockShift);
+        if (m_AllocatedLevels[block] == 0) return false;
+        const uint8 level = static_cast<uint8>(m_AllocatedLevels[block] - 1);
+
+        // Lowest free block big enough, the free lists aren't sorted so every list at or above the level is walked
+        uint32 target = block;
+        uint8 targetLevel = level;
+        for (uint8 cur = level; cur <= m_MaxLevel; ++cur)
+        {
+            for (uint32 candidate = m_FreeHeads[cur]; candidate != InvalidBlock; candidate = m_NextFree[candidate])
             {
-                m_TotalSize = oldTotalSize;
-                m_MaxLevel = oldMaxLevel;
-                ME_CORE_ERROR("BuddyAllocator::Resize: Failed to resize free lists");
-                return false;
+                if (candidate < target)
+                {
+                    target = candidate;
+                    targetLevel = cur;
+                }
             }
-        m_FreeLists.Resize(m_MaxLevel + 1);
+        }
+
+        if (target == block)
+            return false;
+
+        // Keep the lowest part of the target, the upper halves stay free
+        RemoveFree(targetLevel, target);
+        while (targetLevel > level)
+        {
+            targetLevel--;
+            PushFree(targetLevel, target + (uint32(1) << targetLevel));
+        }
+
+        m_AllocatedLevels[target] = static_cast<uint8>(level + 1);
+        m_AllocatedLevels[block] = 0;
+        ReleaseBlock(level, block);
 
+        allocation->Offset = static_cast<SIZE_T>(target) << m_MinBlockShift;
         return true;
     }
+
+    OffsetAllocatorStatistics BuddyAllocator::GetStatistics() const
+    {
+        OffsetAllocatorStatistics statistics = {};
+        statistics.TotalSize = m_TotalSize;
+        statistics.RequestedSize = m_RequestedSize;
+        statistics.ReservedSize = m_ReservedSize;
+        statistics.LargestFreeBlock = m_NonEmptyLevels == 0 ? 0 : m_MinBlockSize << (std::bit_width(m_NonEmptyLevels) - 1);
+        statistics.AllocationCount = m_AllocationCount;
+        statistics.FreeBlockCount = m_FreeBlockCount;
+        return statistics;
+    }
+
     uint8 BuddyAllocator::GetLevel(SIZE_T size) const
     {
         ME_CORE_ASSERT(m_MinBlockSize > 0, ME_LOGGER_TEXT("Buddy allocator isn't initialized!"));
-        SIZE_T block = m_MinBlockSize;
-        uint8 level = 0;
-        while (block < size)
-        {
-            block <<= 1;
-            ++level;
-        }
-        return level;
+        const SIZE_T blocks = (size + m_MinBlockSize - 1) >> m_MinBlockShift;
+        return blocks <= 1 ? 0 : static_cast<uint8>(std::bit_width(blocks - 1));
     }
 
-    inline SIZE_T BuddyAllocator::GetBlockSize(uint8 level) const
+    inline bool BuddyAllocator::IsFree(uint8 level, uint32 block) const
     {
-        ME_CORE_ASSERT(m_MinBlockSize > 0, ME_LOGGER_TEXT("Buddy allocator isn't initialized!"));
-        return m_MinBlockSize << level;
+        const SIZE_T bit = m_LevelBitOffsets[level] + (block >> level);
+        return (m_FreeBits[bit >> 6] >> (bit & 63)) & 1;
     }
 
-    SIZE_T BuddyAllocator::GetBuddyOffset(SIZE_T offset, uint8 level)
+    void BuddyAllocator::PushFree(uint8 level, uint32 block)
     {
-        SIZE_T size = GetBlockSize(level);
-        ME_CORE_ASSERT((offset % size) == 0, ME_LOGGER_TEXT("Offset misaligned for buddy computation!"));
-        return offset ^ size;
+        ME_CORE_ASSERT((block & ((uint32(1) << level) - 1)) == 0, ME_LOGGER_TEXT("Offset misaligned for buddy computation!"));
+
+        const SIZE_T bit = m_LevelBitOffsets[level] + (block >> level);
+        m_FreeBits[bit >> 6] |= uint64(1) << (bit & 63);
+
+        const uint32 head = m_FreeHeads[level];
+        m_NextFree[block] = head;
+        m_PrevFree[block] = InvalidBlock;
+        if (head != InvalidBlock)
+            m_PrevFree[head] = block;
+        m_FreeHeads[level] = block;
+
+        m_NonEmptyLevels |= uint64(1) << level;
+        m_FreeBlockCount++;
+    }
+
+    void BuddyAllocator::RemoveFree(uint8 level, uint32 block)
+    {
+        const SIZE_T bit = m_LevelBitOffsets[level] + (block >> level);
+        m_FreeBits[bit >> 6] &= ~(uint64(1) << (bit & 63));
+
+        const uint32 next = m_NextFree[block];
+        const uint32 prev = m_PrevFree[block];
+        if (prev != InvalidBlock)
+            m_NextFree[prev] = next;
+        else
+            m_FreeHeads[level] = next;
+        if (next != InvalidBlock)
+            m_PrevFree[next] = prev;
+
+        if (m_FreeHeads[level] == InvalidBlock)
+            m_NonEmptyLevels &= ~(uint64(1) << level);
+        m_FreeBlockCount--;
+    }
+
+    void BuddyAllocator::ReleaseBlock(uint8 level, uint32 block)
+    {
+        while (level < m_MaxLevel)
+        {
+            const uint32 buddy = block ^ (uint32(1) << level);
+            if (!IsFree(level, buddy))
+                break;
+
+            RemoveFree(level, buddy);
+            block = ME::Core::Algorithm::Min(block, buddy);
+            level++;
+        }
+
+        PushFree(level, block);
+    }
+
+    void BuddyAllocator::BuildTables(SIZE_T blockCount)
+    {
+        SIZE_T bits = 0;
+        m_LevelBitOffsets.Resize(m_MaxLevel + 1);
+        for (uint8 level = 0; level <= m_MaxLevel; ++level)
+        {
+            m_LevelBitOffsets[level] = bits;
+            bits += blockCount >> level;
+        }
+
+        m_FreeBits.Resize((bits + 63) / 64);
+        for (uint64& word : m_FreeBits)
+            word = 0;
+
+        m_FreeHeads.Resize(m_MaxLevel + 1);
+        for (uint32& head : m_FreeHeads)
+            head = InvalidBlock;
+
+        m_NextFree.Resize(blockCount);
+        m_PrevFree.Resize(blockCount);
+        m_AllocatedLevels.Resize(blockCount);
+        for (uint8& level : m_AllocatedLevels)
+            level = 0;
+
+        m_NonEmptyLevels = 0;
+        m_FreeBlockCount = 0;
     }
 
     bool BuddyAllocator::ValidateSpecification(const BuddyAllocatorSpecification& specification)
@@ -225,6 +356,8 @@ namespace ME::Core::Memory
         if (specification.TotalSize <= specification.MinBlockSize) return false;
         if (!IS_POWER_OF_2(specification.MinBlockSize)) return false;
         if (!IS_POWER_OF_2(specification.TotalSize)) return false;
+        // Block indices are 32 bit and every level needs a bit in the non-empty mask
+        if (specification.TotalSize / specification.MinBlockSize > SIZE_T(~uint32(0))) return false;
         return true;
     }
 }
@@ -2,76 +2,87 @@
 
 #include "Core.hpp"
 #include "Core/Containers/Array.hpp"
-#include "Core/Containers/UnorderedMap.hpp"
+#include "Core/Memory/Allocators/OffsetAllocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
 
 namespace ME::Core::Memory
 {
-    // Allocation without address, only offset
-    struct OAllocation_S
-    {
-        SIZE_T Offset;
-        SIZE_T Size;
-    };
-
-    typedef OAllocation_S* OAllocation;
-
-    enum class BuddyAllocatorErrors : uint8
-    {
-        Success,
-        // Specification errors
-        IncorrectSpecification,
-        // Allocation errors
-        OutOfMemory, TooBigRequest, TooSmallRequest,
-        // Free errors
-        OutOfRange, InvalidArgument
-    };
-
     struct BuddyAllocatorSpecification
     {
         SIZE_T MinBlockSize;
         SIZE_T TotalSize; // must be number powered by 2 (ex: 2, 4, 8, 16, 32, 64, 128 etc.) in bytes
     };
 
-    class COREAPI BuddyAllocator
+    // Blocks are tracked in units of the min block size. Every level has a bitmap of its free blocks and a
+    // doubly linked free list threaded through per min block link arrays, plus one bit per level telling if
+    // its list is empty. Allocate, free and buddy merging are O(levels) and don't touch the heap,
+    // allocation handles come from a pool which only grows in 4 KB slabs
+    class COREAPI BuddyAllocator : public IOffsetAllocator
     {
     public:
         BuddyAllocator();
         BuddyAllocator(const BuddyAllocatorSpecification& specification);
         BuddyAllocator(const BuddyAllocator&) noexcept = delete;
         BuddyAllocator(BuddyAllocator&&) noexcept = delete;
-        ~BuddyAllocator();
+        ~BuddyAllocator() override;
         uint8 CalculateMaxLevel(SIZE_T totalSize, SIZE_T minBlockSize) const;
 
     public:
-        BuddyAllocatorErrors Init(const BuddyAllocatorSpecification& specification);
+        OffsetAllocatorErrors Init(const BuddyAllocatorSpecification& specification);
         void DumpFreeLists() const;
 
-        SIZE_T GetSize() const { return m_TotalSize; }
+        SIZE_T GetSize() const override { return m_TotalSize; }
         SIZE_T GetMinBlockSize() const { return m_MinBlockSize; }
+        OffsetAllocatorStatistics GetStatistics() const override;
 
     public:
-        BuddyAllocatorErrors Allocate(OAllocation& allocation, SIZE_T size);
-        BuddyAllocatorErrors Free(OAllocation& allocation);
-        void Clear();
-        bool Resize(SIZE_T size);
+        OffsetAllocatorErrors Allocate(OAllocation& allocation, SIZE_T size) override;
+        OffsetAllocatorErrors Free(OAllocation& allocation) override;
+        void Clear() override;
+        bool Resize(SIZE_T size) override;
+        bool Relocate(OAllocation& allocation) override;
 
     private:
         // Helper functions
         uint8 GetLevel(SIZE_T size) const;
-        inline SIZE_T GetBlockSize(uint8 level) const;
-        SIZE_T GetBuddyOffset(SIZE_T offset, uint8 level);
+
+        // Blocks are addressed by the index of their first min block
+        inline bool IsFree(uint8 level, uint32 block) const;
+        void PushFree(uint8 level, uint32 block);
+        void RemoveFree(uint8 level, uint32 block);
+        // Frees a block and merges it with its buddies as far up as they are free
+        void ReleaseBlock(uint8 level, uint32 block);
+
+        void BuildTables(SIZE_T blockCount);
 
         static bool ValidateSpecification(const BuddyAllocatorSpecification& specification);
 
     private:
-        ME::Core::Array<ME::Core::Array<SIZE_T>> m_FreeLists;
-        ME::Core::Array<OAllocation> m_Allocations;
-        ME::Core::UnorderedMap<SIZE_T, uint8> m_Allocated;
+        static constexpr uint32 InvalidBlock = ~uint32(0);
+
+    private:
+        // Free bits of all levels back to back, level i starts at m_LevelBitOffsets[i]
+        ME::Core::Array<uint64> m_FreeBits;
+        ME::Core::Array<SIZE_T> m_LevelBitOffsets;
+        ME::Core::Array<uint32> m_FreeHeads;
+        ME::Core::Array<uint32> m_NextFree;
+        ME::Core::Array<uint32> m_PrevFree;
+        // Level + 1 of the allocation starting at each min block, 0 where none starts
+        ME::Core::Array<uint8> m_AllocatedLevels;
+        uint64 m_NonEmptyLevels;
+        SIZE_T m_FreeBlockCount;
+
+        FixedSizePool m_Allocations;
 
     private:
         uint8 m_MaxLevel;
+        uint8 m_MinBlockShift;
         SIZE_T m_MinBlockSize;
         SIZE_T m_TotalSize;
+
+        SIZE_T m_RequestedSize;
+        SIZE_T m_ReservedSize;
+        SIZE_T m_AllocationCount;
     };
 
 }
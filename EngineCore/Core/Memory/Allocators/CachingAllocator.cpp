@@ -0,0 +1,172 @@
+#include "CachingAllocator.hpp"
+#include "Core/Algorithm.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Utility/MemWatch/MemWatch.hpp"
+
+#include <bit>
+
+namespace ME::Core::Memory
+{
+	namespace
+	{
+		static_assert(IS_POWER_OF_2(POOL_ALLOCATOR_MAX_BLOCK_SIZE) && IS_POWER_OF_2(CACHING_ALLOCATOR_MAX_SIZE),
+			"Size class limits have to be powers of two.");
+		static_assert(CACHING_ALLOCATOR_MAX_SIZE > POOL_ALLOCATOR_MAX_BLOCK_SIZE, "Caching allocator has to cover more than the pools.");
+
+		// Classes above the pools, four per power of two: (4 + k) / 4 * 2^n for k = 1..4
+		constexpr SIZE_T ClassesPerPowerOf2 = 4;
+		constexpr SIZE_T FirstClassBits = std::bit_width(POOL_ALLOCATOR_MAX_BLOCK_SIZE);
+		constexpr SIZE_T LargeClassCount = (std::bit_width(CACHING_ALLOCATOR_MAX_SIZE - 1) - FirstClassBits + 1) * ClassesPerPowerOf2;
+
+		inline SIZE_T GetLargeClass(SIZE_T size)
+		{
+			const SIZE_T bits = std::bit_width(size - 1);
+			return (bits - FirstClassBits) * ClassesPerPowerOf2 + ((size - 1) >> (bits - 3)) - ClassesPerPowerOf2;
+		}
+
+		constexpr SIZE_T GetLargeClassSize(SIZE_T sizeClass)
+		{
+			return (ClassesPerPowerOf2 + 1 + sizeClass % ClassesPerPowerOf2) << (sizeClass / ClassesPerPowerOf2 + FirstClassBits - 3);
+		}
+
+		constexpr SIZE_T GetCacheLimit(SIZE_T sizeClass)
+		{
+			const SIZE_T limit = CACHING_ALLOCATOR_THREAD_CACHE_BYTES / GetLargeClassSize(sizeClass);
+			return limit > 2 ? limit : 2;
+		}
+
+		static_assert(GetLargeClassSize(LargeClassCount - 1) == CACHING_ALLOCATOR_MAX_SIZE, "Last size class has to be the maximum size.");
+
+		struct LargePools
+		{
+			alignas(FixedSizePool) uint8 Storage[LargeClassCount][sizeof(FixedSizePool)];
+
+			LargePools()
+			{
+				// At least a few blocks per slab, otherwise the biggest classes would take a slab per batch
+				for (SIZE_T i = 0; i < LargeClassCount; i++)
+					new (Storage[i]) FixedSizePool(GetLargeClassSize(i), Algorithm::Max<SIZE_T>(POOL_ALLOCATOR_SLAB_SIZE, GetLargeClassSize(i) * 8));
+			}
+
+			inline FixedSizePool& operator[](SIZE_T sizeClass)
+			{
+				return *reinterpret_cast<FixedSizePool*>(Storage[sizeClass]);
+			}
+		};
+
+		LargePools& GetLargePools()
+		{
+			// Never destroyed, same as the shared pools
+			static LargePools* pools = new LargePools();
+			return *pools;
+		}
+
+		// Same as the pool allocator's thread cache, frees after the cache is gone skip it
+		thread_local bool t_LargeThreadCacheTornDown = false;
+
+		struct LargeThreadCache
+		{
+			struct Bin
+			{
+				PoolFreeBlock* Head = nullptr;
+				SIZE_T Count = 0;
+			};
+
+			Bin Bins[LargeClassCount];
+
+			~LargeThreadCache()
+			{
+				for (SIZE_T i = 0; i < LargeClassCount; i++)
+				{
+					if (Bins[i].Count == 0)
+						continue;
+
+					PoolFreeBlock* tail = Bins[i].Head;
+					while (tail->Next != nullptr)
+						tail = tail->Next;
+					GetLargePools()[i].DeallocateBatch(Bins[i].Head, tail, Bins[i].Count);
+					Bins[i] = {};
+				}
+				t_LargeThreadCacheTornDown = true;
+			}
+		};
+
+		thread_local LargeThreadCache t_LargeThreadCache;
+	}
+
+	void* SizeClassCache::Allocate(SIZE_T size)
+	{
+		if (size <= POOL_ALLOCATOR_MAX_BLOCK_SIZE)
+			return FixedSizePool::AllocateShared(size);
+
+		ME_CORE_ASSERT(size <= CACHING_ALLOCATOR_MAX_SIZE, "Size is too big for a size class");
+		const SIZE_T sizeClass = GetLargeClass(size);
+		if (t_LargeThreadCacheTornDown)
+			return GetLargePools()[sizeClass].Allocate();
+
+		LargeThreadCache::Bin& bin = t_LargeThreadCache.Bins[sizeClass];
+		if (bin.Head == nullptr)
+			bin.Count = GetLargePools()[sizeClass].AllocateBatch(bin.Head, GetCacheLimit(sizeClass) / 2);
+
+		PoolFreeBlock* block = bin.Head;
+		bin.Head = block->Next;
+		bin.Count--;
+		ME_MEMWATCH_ALLOCATION(Utility::MemTag::Pools, GetLargeClassSize(sizeClass));
+		return block;
+	}
+
+	void SizeClassCache::Deallocate(void* ptr, SIZE_T size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		if (size <= POOL_ALLOCATOR_MAX_BLOCK_SIZE)
+		{
+			FixedSizePool::DeallocateShared(ptr, size);
+			return;
+		}
+
+		const SIZE_T sizeClass = GetLargeClass(size);
+		if (t_LargeThreadCacheTornDown)
+		{
+			GetLargePools()[sizeClass].Deallocate(ptr);
+			return;
+		}
+
+		ME_MEMWATCH_FREE(Utility::MemTag::Pools, GetLargeClassSize(sizeClass));
+
+		LargeThreadCache::Bin& bin = t_LargeThreadCache.Bins[sizeClass];
+		PoolFreeBlock* block = static_cast<PoolFreeBlock*>(ptr);
+		block->Next = bin.Head;
+		bin.Head = block;
+		bin.Count++;
+
+		const SIZE_T limit = GetCacheLimit(sizeClass);
+		if (bin.Count <= limit)
+			return;
+
+		// Keep half, the rest goes back so other threads can use it
+		const SIZE_T keep = limit / 2;
+		PoolFreeBlock* last = bin.Head;
+		for (SIZE_T i = 1; i < keep; i++)
+			last = last->Next;
+
+		PoolFreeBlock* head = last->Next;
+		PoolFreeBlock* tail = head;
+		while (tail->Next != nullptr)
+			tail = tail->Next;
+
+		GetLargePools()[sizeClass].DeallocateBatch(head, tail, bin.Count - keep);
+		last->Next = nullptr;
+		bin.Count = keep;
+	}
+
+	SIZE_T SizeClassCache::GetClassSize(SIZE_T size)
+	{
+		if (size <= POOL_ALLOCATOR_MAX_BLOCK_SIZE)
+			return FixedSizePool::GetShared(size).GetBlockSize();
+		if (size <= CACHING_ALLOCATOR_MAX_SIZE)
+			return GetLargeClassSize(GetLargeClass(size));
+		return size;
+	}
+}
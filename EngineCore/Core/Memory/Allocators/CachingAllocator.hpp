@@ -0,0 +1,101 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
+
+#include <new>
+
+// Largest allocation served from a size class, bigger ones go to the heap
+constexpr SIZE_T CACHING_ALLOCATOR_MAX_SIZE = ME_KB(32);
+// Bytes each thread keeps per size class before handing half of them back to the shared pool
+constexpr SIZE_T CACHING_ALLOCATOR_THREAD_CACHE_BYTES = ME_KB(64);
+
+namespace ME::Core::Memory
+{
+	// Size class front-end for any allocation up to CACHING_ALLOCATOR_MAX_SIZE. Sizes up to
+	// POOL_ALLOCATOR_MAX_BLOCK_SIZE use the shared pools and their thread cache, above that there are
+	// four classes per power of two, each a FixedSizePool with its own thread cache in front.
+	// Threads only touch a shared pool to move a batch of blocks, freeing on another thread is fine
+	class COREAPI SizeClassCache
+	{
+	public:
+		SizeClassCache() = delete;
+
+	public:
+		// Every block is aligned to POOL_ALLOCATOR_GRANULARITY
+		static void* Allocate(SIZE_T size);
+		// size must be what was passed to Allocate
+		static void Deallocate(void* ptr, SIZE_T size);
+
+		// Bytes really reserved for an allocation of the given size
+		ME_NODISCARD static SIZE_T GetClassSize(SIZE_T size);
+	};
+
+	// Opt-in replacement for Allocator. Containers which allocate and free a lot, especially from
+	// worker threads, take it as their allocator parameter and stay off the global heap
+	template <typename T>
+	class CachingAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		CachingAllocator() = default;
+
+		template <typename U>
+		CachingAllocator(const CachingAllocator<U>&) noexcept {}
+
+		value_type* Allocate(SIZE_T n)
+		{
+			if constexpr (IsCached())
+			{
+				if (n <= CACHING_ALLOCATOR_MAX_SIZE / sizeof(T))
+					return static_cast<T*>(SizeClassCache::Allocate(n * sizeof(T)));
+			}
+			void* ptr = ::operator new(n * sizeof(T), std::align_val_t{ alignof(T) });
+			return static_cast<T*>(ptr);
+		}
+
+		void Deallocate(T* ptr, SIZE_T n)
+		{
+			if constexpr (IsCached())
+			{
+				if (n <= CACHING_ALLOCATOR_MAX_SIZE / sizeof(T))
+				{
+					SizeClassCache::Deallocate(ptr, n * sizeof(T));
+					return;
+				}
+			}
+			::operator delete(ptr, n * sizeof(T), std::align_val_t{ alignof(T) });
+		}
+
+		template <typename U>
+		struct Rebind
+		{
+			using Other = CachingAllocator<U>;
+		};
+
+		template <class Val, class... varg>
+		void Construct(Val* ptr, varg&&... args)
+		{
+			new (static_cast<void*>(ptr)) Val(std::forward<varg>(args)...);
+		}
+
+		template <class Val>
+		void Destroy(Val* ptr)
+		{
+			ptr->~Val();
+		}
+
+		bool operator==(const CachingAllocator&) const noexcept { return true; }
+		bool operator!=(const CachingAllocator&) const noexcept { return false; }
+
+	private:
+		static constexpr bool IsCached()
+		{
+			if constexpr (std::is_void_v<T>)
+				return false;
+			else
+				return alignof(T) <= POOL_ALLOCATOR_GRANULARITY;
+		}
+	};
+}
@@ -0,0 +1,151 @@
+#include "FrameArena.hpp"
+#include "Core/Algorithm.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Utility/MemWatch/MemWatch.hpp"
+
+#include <new>
+
+namespace ME::Core::Memory
+{
+	namespace
+	{
+		struct DoubleBufferedArenas
+		{
+			FrameArena Arenas[2];
+			uint32 Current = 0;
+		};
+
+		DoubleBufferedArenas& GetDoubleBufferedArenas()
+		{
+			static DoubleBufferedArenas arenas;
+			return arenas;
+		}
+	}
+
+	FrameArena::FrameArena(SIZE_T blockSize)
+		: m_BlockBegin(nullptr), m_Top(nullptr), m_End(nullptr), m_BlockSize(blockSize), m_FilledSize(0), m_PeakUsedSize(0), m_RequestedSize(0)
+	{
+		ME_CORE_ASSERT(blockSize > 0, "Frame arena block size must be > 0");
+	}
+
+	FrameArena::~FrameArena()
+	{
+		ME_MEMWATCH_RELEASE(Utility::MemTag::FrameArena, m_RequestedSize);
+		FreeBlocks();
+	}
+
+	void* FrameArena::Allocate(SIZE_T size, SIZE_T alignment)
+	{
+		ME_CORE_ASSERT((alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		SIZE_T address = (reinterpret_cast<SIZE_T>(m_Top) + alignment - 1) & ~(alignment - 1);
+		if (m_Top == nullptr || address + size > reinterpret_cast<SIZE_T>(m_End))
+		{
+			AddBlock(size + alignment);
+			address = (reinterpret_cast<SIZE_T>(m_Top) + alignment - 1) & ~(alignment - 1);
+		}
+
+		m_Top = reinterpret_cast<uint8*>(address + size);
+		m_RequestedSize += size;
+		ME_MEMWATCH_ALLOCATION(Utility::MemTag::FrameArena, size);
+		return reinterpret_cast<void*>(address);
+	}
+
+	void FrameArena::Deallocate(void* ptr, SIZE_T size)
+	{
+		// Only the last allocation can be taken back, anything else waits for the reset
+		uint8* data = static_cast<uint8*>(ptr);
+		if (data != nullptr && data >= m_BlockBegin && data + size == m_Top)
+		{
+			m_Top = data;
+			m_RequestedSize -= size;
+			ME_MEMWATCH_FREE(Utility::MemTag::FrameArena, size);
+		}
+	}
+
+	void FrameArena::Reset()
+	{
+		m_PeakUsedSize = Algorithm::Max(m_PeakUsedSize, GetUsedSize());
+
+		if (m_Blocks.Size() > 1)
+		{
+			// The last frame didn't fit in one block, make one which holds all of it
+			const SIZE_T capacity = GetCapacity();
+			FreeBlocks();
+			AddBlock(capacity);
+		}
+
+		m_FilledSize = 0;
+		m_Top = m_BlockBegin;
+
+		ME_MEMWATCH_RELEASE(Utility::MemTag::FrameArena, m_RequestedSize);
+		m_RequestedSize = 0;
+	}
+
+	SIZE_T FrameArena::GetUsedSize() const
+	{
+		return m_FilledSize + static_cast<SIZE_T>(m_Top - m_BlockBegin);
+	}
+
+	SIZE_T FrameArena::GetPeakUsedSize() const
+	{
+		return Algorithm::Max(m_PeakUsedSize, GetUsedSize());
+	}
+
+	SIZE_T FrameArena::GetCapacity() const
+	{
+		SIZE_T capacity = 0;
+		for (const Block& block : m_Blocks)
+			capacity += block.Size;
+		return capacity;
+	}
+
+	FrameArena& FrameArena::Get()
+	{
+		static FrameArena arena;
+		return arena;
+	}
+
+	FrameArena& FrameArena::GetDoubleBuffered()
+	{
+		DoubleBufferedArenas& arenas = GetDoubleBufferedArenas();
+		return arenas.Arenas[arenas.Current];
+	}
+
+	void FrameArena::NextFrame()
+	{
+		Get().Reset();
+
+		// The other half held the frame before last, nothing in it is in use anymore
+		DoubleBufferedArenas& arenas = GetDoubleBufferedArenas();
+		arenas.Current ^= 1;
+		arenas.Arenas[arenas.Current].Reset();
+	}
+
+	void FrameArena::AddBlock(SIZE_T minSize)
+	{
+		SIZE_T size = Algorithm::Max(m_BlockSize, minSize);
+		if (!m_Blocks.Empty())
+			size = Algorithm::Max(size, m_Blocks.Back().Size * 2);
+
+		uint8* data = static_cast<uint8*>(::operator new(size, std::align_val_t{ CacheLineSize }));
+		m_Blocks.PushBack({ data, size });
+
+		m_FilledSize += static_cast<SIZE_T>(m_Top - m_BlockBegin);
+		m_BlockBegin = data;
+		m_Top = data;
+		m_End = data + size;
+	}
+
+	void FrameArena::FreeBlocks()
+	{
+		for (const Block& block : m_Blocks)
+			::operator delete(block.Data, block.Size, std::align_val_t{ CacheLineSize });
+		m_Blocks.Clear();
+
+		m_BlockBegin = nullptr;
+		m_Top = nullptr;
+		m_End = nullptr;
+		m_FilledSize = 0;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+
+// Size of the first block of a frame arena, more blocks are chained on when a frame needs more
+constexpr SIZE_T FRAME_ARENA_BLOCK_SIZE = ME_MB(1);
+
+namespace ME::Core::Memory
+{
+	// Linear allocator for data which only lives until the end of a frame. Allocating is a pointer bump,
+	// Deallocate only gives memory back if it was the last allocation and Reset drops everything at once.
+	// If a frame overflows the current block a new one is chained on, Reset then merges all blocks into one
+	// big enough for that frame, so after a few frames the arena stops touching the heap entirely.
+	// Not thread safe, the global arenas belong to the main thread
+	class COREAPI FrameArena
+	{
+	public:
+		explicit FrameArena(SIZE_T blockSize = FRAME_ARENA_BLOCK_SIZE);
+		FrameArena(const FrameArena&) = delete;
+		FrameArena(FrameArena&&) = delete;
+		~FrameArena();
+
+		FrameArena& operator=(const FrameArena&) = delete;
+		FrameArena& operator=(FrameArena&&) = delete;
+
+	public:
+		void* Allocate(SIZE_T size, SIZE_T alignment);
+		void Deallocate(void* ptr, SIZE_T size);
+
+		// Everything allocated so far becomes invalid
+		void Reset();
+
+	public:
+		// Bytes handed out since the last reset, including alignment padding
+		ME_NODISCARD SIZE_T GetUsedSize() const;
+		ME_NODISCARD SIZE_T GetPeakUsedSize() const;
+		ME_NODISCARD SIZE_T GetCapacity() const;
+
+		ME_NODISCARD inline SIZE_T GetBlockCount() const { return m_Blocks.Size(); }
+
+	public:
+		// Arena reset at the start of every frame
+		static FrameArena& Get();
+		// Allocations made during a frame stay valid through the following frame as well
+		static FrameArena& GetDoubleBuffered();
+
+		// Called by the application once per frame, before anything allocates from the arenas
+		static void NextFrame();
+
+	private:
+		struct Block
+		{
+			uint8* Data;
+			SIZE_T Size;
+		};
+
+	private:
+		void AddBlock(SIZE_T minSize);
+		void FreeBlocks();
+
+	private:
+		Array<Block> m_Blocks;
+
+		uint8* m_BlockBegin;
+		uint8* m_Top;
+		uint8* m_End;
+
+		SIZE_T m_BlockSize;
+		// Bytes used in the blocks before the current one
+		SIZE_T m_FilledSize;
+		SIZE_T m_PeakUsedSize;
+		// Bytes asked for since the last reset without padding, what MemWatch is told the reset releases
+		SIZE_T m_RequestedSize;
+	};
+}
@@ -0,0 +1,61 @@
+#include "LargeBlockAllocator.hpp"
+#include "Core/Utility/MemWatch/MemWatch.hpp"
+
+#include <atomic>
+
+namespace ME::Core::Memory
+{
+	namespace
+	{
+		std::atomic<SIZE_T> s_BlockCount = 0;
+		std::atomic<SIZE_T> s_CommittedBytes = 0;
+		std::atomic<SIZE_T> s_PeakCommittedBytes = 0;
+
+		inline SIZE_T GetBlockSize(SIZE_T size)
+		{
+			return VirtualMemory::RoundToPages(size);
+		}
+	}
+
+	void* LargeBlockHeap::Allocate(SIZE_T size)
+	{
+		const SIZE_T blockSize = GetBlockSize(size);
+		const bool huge = blockSize >= VIRTUAL_MEMORY_HUGE_PAGE_SIZE;
+
+		void* block = VirtualMemory::Allocate(blockSize, huge ? VIRTUAL_MEMORY_HUGE_PAGE_SIZE : 0);
+		if (block == nullptr)
+			throw std::bad_alloc();
+		if (huge)
+			VirtualMemory::AdviseHugePages(block, blockSize);
+
+		s_BlockCount.fetch_add(1, std::memory_order_relaxed);
+		const SIZE_T committed = s_CommittedBytes.fetch_add(blockSize, std::memory_order_relaxed) + blockSize;
+		SIZE_T peak = s_PeakCommittedBytes.load(std::memory_order_relaxed);
+		while (committed > peak && !s_PeakCommittedBytes.compare_exchange_weak(peak, committed, std::memory_order_relaxed));
+
+		ME_MEMWATCH_ALLOCATION(Utility::MemTag::LargeBlocks, blockSize);
+		return block;
+	}
+
+	void LargeBlockHeap::Deallocate(void* ptr, SIZE_T size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		const SIZE_T blockSize = GetBlockSize(size);
+		ME_MEMWATCH_FREE(Utility::MemTag::LargeBlocks, blockSize);
+
+		VirtualMemory::Release(ptr, blockSize);
+		s_BlockCount.fetch_sub(1, std::memory_order_relaxed);
+		s_CommittedBytes.fetch_sub(blockSize, std::memory_order_relaxed);
+	}
+
+	LargeBlockStatistics LargeBlockHeap::GetStatistics()
+	{
+		LargeBlockStatistics statistics;
+		statistics.BlockCount = s_BlockCount.load(std::memory_order_relaxed);
+		statistics.CommittedBytes = s_CommittedBytes.load(std::memory_order_relaxed);
+		statistics.PeakCommittedBytes = s_PeakCommittedBytes.load(std::memory_order_relaxed);
+		return statistics;
+	}
+}
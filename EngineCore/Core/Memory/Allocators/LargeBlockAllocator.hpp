@@ -0,0 +1,101 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Memory/VirtualMemory.hpp"
+
+#include <new>
+
+// Allocations from this size on get their own pages instead of a spot in the heap
+constexpr SIZE_T LARGE_BLOCK_ALLOCATOR_THRESHOLD = ME_KB(256);
+
+namespace ME::Core::Memory
+{
+	struct LargeBlockStatistics
+	{
+		SIZE_T BlockCount;
+		// Rounded up to whole pages
+		SIZE_T CommittedBytes;
+		SIZE_T PeakCommittedBytes;
+	};
+
+	// Every block is its own committed page range straight from VirtualMemory. Freeing gives the pages back to
+	// the OS at once, so big long lived buffers never leave holes in the heap. Blocks of at least a huge page
+	// are aligned to one and marked for transparent huge pages, which cuts their TLB misses on Linux
+	class COREAPI LargeBlockHeap
+	{
+	public:
+		LargeBlockHeap() = delete;
+
+	public:
+		// Throws std::bad_alloc when out of address space or memory, like operator new
+		static void* Allocate(SIZE_T size);
+		// size must be what was passed to Allocate
+		static void Deallocate(void* ptr, SIZE_T size);
+
+		ME_NODISCARD static LargeBlockStatistics GetStatistics();
+	};
+
+	// Allocator for big, long lived buffers: decoded images, audio and CPU copies of meshes. Anything under
+	// LARGE_BLOCK_ALLOCATOR_THRESHOLD goes to the heap as usual, so small arrays of the same type cost nothing extra.
+	// Growing an array past the threshold maps new pages every time, reserve up front where the size is known
+	template <typename T>
+	class LargeBlockAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		LargeBlockAllocator() = default;
+
+		template <typename U>
+		LargeBlockAllocator(const LargeBlockAllocator<U>&) noexcept {}
+
+		value_type* Allocate(SIZE_T n)
+		{
+			if (IsLarge(n))
+				return static_cast<T*>(LargeBlockHeap::Allocate(n * sizeof(T)));
+
+			void* ptr = ::operator new(n * sizeof(T), std::align_val_t{ alignof(T) });
+			return static_cast<T*>(ptr);
+		}
+
+		void Deallocate(T* ptr, SIZE_T n)
+		{
+			if (IsLarge(n))
+			{
+				LargeBlockHeap::Deallocate(ptr, n * sizeof(T));
+				return;
+			}
+			::operator delete(ptr, n * sizeof(T), std::align_val_t{ alignof(T) });
+		}
+
+		template <typename U>
+		struct Rebind
+		{
+			using Other = LargeBlockAllocator<U>;
+		};
+
+		template <class Val, class... varg>
+		void Construct(Val* ptr, varg&&... args)
+		{
+			new (static_cast<void*>(ptr)) Val(std::forward<varg>(args)...);
+		}
+
+		template <class Val>
+		void Destroy(Val* ptr)
+		{
+			ptr->~Val();
+		}
+
+		bool operator==(const LargeBlockAllocator&) const noexcept { return true; }
+		bool operator!=(const LargeBlockAllocator&) const noexcept { return false; }
+
+	private:
+		static inline bool IsLarge(SIZE_T n)
+		{
+			if constexpr (std::is_void_v<T>)
+				return false;
+			else
+				return n >= (LARGE_BLOCK_ALLOCATOR_THRESHOLD + sizeof(T) - 1) / sizeof(T);
+		}
+	};
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace ME::Core::Memory
+{
+    // Allocation without address, only offset
+    struct OAllocation_S
+    {
+        SIZE_T Offset;
+        SIZE_T Size;
+        // Belongs to the allocator which made the allocation
+        uint32 Metadata = 0;
+    };
+
+    typedef OAllocation_S* OAllocation;
+
+    enum class OffsetAllocatorErrors : uint8
+    {
+        Success,
+        // Specification errors
+        IncorrectSpecification,
+        // Allocation errors
+        OutOfMemory, TooBigRequest, TooSmallRequest,
+        // Free errors
+        OutOfRange, InvalidArgument
+    };
+
+    enum class OffsetAllocatorType : uint8
+    {
+        // Power of two blocks, cheap but up to half of every block is lost to rounding
+        Buddy,
+        // Two-Level Segregated Fit, blocks are exactly as big as asked for (rounded to the alignment)
+        TLSF
+    };
+
+    struct OffsetAllocatorStatistics
+    {
+        SIZE_T TotalSize = 0;
+        // Bytes the callers asked for
+        SIZE_T RequestedSize = 0;
+        // Bytes taken out of the free space, requested size plus rounding
+        SIZE_T ReservedSize = 0;
+        SIZE_T LargestFreeBlock = 0;
+        SIZE_T AllocationCount = 0;
+        SIZE_T FreeBlockCount = 0;
+
+        SIZE_T GetFreeSize() const { return TotalSize - ReservedSize; }
+
+        // Share of the reserved bytes that hold requested data
+        float32 GetUtilization() const
+        {
+            return ReservedSize == 0 ? 1.0f : static_cast<float32>(RequestedSize) / static_cast<float32>(ReservedSize);
+        }
+
+        // Share of the free space which can't be handed out in one piece
+        float32 GetFragmentation() const
+        {
+            const SIZE_T freeSize = GetFreeSize();
+            return freeSize == 0 ? 0.0f : 1.0f - static_cast<float32>(LargestFreeBlock) / static_cast<float32>(freeSize);
+        }
+    };
+
+    // Sub-allocates ranges of a buffer the allocator never touches (GPU memory), results are offsets only
+    class COREAPI IOffsetAllocator
+    {
+    public:
+        virtual ~IOffsetAllocator() = default;
+
+    public:
+        virtual OffsetAllocatorErrors Allocate(OAllocation& allocation, SIZE_T size) = 0;
+        virtual OffsetAllocatorErrors Free(OAllocation& allocation) = 0;
+        virtual void Clear() = 0;
+        // Only grows, the added range becomes free space
+        virtual bool Resize(SIZE_T size) = 0;
+        // Moves the allocation into the lowest free range which fits it when that's below its current offset. The handle
+        // stays valid and only its offset changes, the new range may overlap the old one. Moving the data is up to the
+        // caller, returns false if the allocation stays where it is
+        virtual bool Relocate(OAllocation& allocation) = 0;
+
+        virtual SIZE_T GetSize() const = 0;
+        virtual OffsetAllocatorStatistics GetStatistics() const = 0;
+    };
+}
@@ -0,0 +1,260 @@
+#include "PoolAllocator.hpp"
+#include "Core/Algorithm.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Utility/MemWatch/MemWatch.hpp"
+
+namespace ME::Core::Memory
+{
+	namespace
+	{
+		constexpr SIZE_T SizeClassCount = POOL_ALLOCATOR_MAX_BLOCK_SIZE / POOL_ALLOCATOR_GRANULARITY;
+
+		inline SIZE_T GetSizeClass(SIZE_T size)
+		{
+			return (Algorithm::Max<SIZE_T>(size, 1) + POOL_ALLOCATOR_GRANULARITY - 1) / POOL_ALLOCATOR_GRANULARITY - 1;
+		}
+
+		struct SharedPools
+		{
+			alignas(FixedSizePool) uint8 Storage[SizeClassCount][sizeof(FixedSizePool)];
+
+			SharedPools()
+			{
+				for (SIZE_T i = 0; i < SizeClassCount; i++)
+					new (Storage[i]) FixedSizePool((i + 1) * POOL_ALLOCATOR_GRANULARITY);
+			}
+
+			inline FixedSizePool& operator[](SIZE_T sizeClass)
+			{
+				return *reinterpret_cast<FixedSizePool*>(Storage[sizeClass]);
+			}
+		};
+
+		SharedPools& GetSharedPools()
+		{
+			// Never destroyed, containers living in other modules' statics may still free nodes during shutdown
+			static SharedPools* pools = new SharedPools();
+			return *pools;
+		}
+
+		// Set once the thread's cache is gone. Thread locals die before statics on the main thread, so frees from
+		// static destructors after that go straight to the shared pools
+		thread_local bool t_ThreadCacheTornDown = false;
+
+		struct ThreadCache
+		{
+			struct Bin
+			{
+				PoolFreeBlock* Head = nullptr;
+				SIZE_T Count = 0;
+			};
+
+			Bin Bins[SizeClassCount];
+
+			~ThreadCache()
+			{
+				for (SIZE_T i = 0; i < SizeClassCount; i++)
+				{
+					if (Bins[i].Count == 0)
+						continue;
+
+					PoolFreeBlock* tail = Bins[i].Head;
+					while (tail->Next != nullptr)
+						tail = tail->Next;
+					GetSharedPools()[i].DeallocateBatch(Bins[i].Head, tail, Bins[i].Count);
+					Bins[i] = {};
+				}
+				t_ThreadCacheTornDown = true;
+			}
+		};
+
+		thread_local ThreadCache t_ThreadCache;
+	}
+
+	FixedSizePool::FixedSizePool(SIZE_T blockSize, SIZE_T slabSize)
+		: m_FreeList(nullptr),
+		  m_BlockSize((Algorithm::Max<SIZE_T>(blockSize, sizeof(PoolFreeBlock)) + POOL_ALLOCATOR_GRANULARITY - 1) & ~(POOL_ALLOCATOR_GRANULARITY - 1)),
+		  m_BlocksPerSlab(Algorithm::Max<SIZE_T>(slabSize / m_BlockSize, 1)), m_BlocksInUse(0)
+	{
+	}
+
+	FixedSizePool::~FixedSizePool()
+	{
+		ME_CORE_ASSERT(m_BlocksInUse == 0, "Pool destroyed while blocks are still in use");
+		for (void* slab : m_Slabs)
+			::operator delete(slab, m_BlocksPerSlab * m_BlockSize, std::align_val_t{ CacheLineSize });
+	}
+
+	void* FixedSizePool::Allocate()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		PoolFreeBlock* block = m_FreeList != nullptr ? m_FreeList : AddSlab();
+		m_FreeList = block->Next;
+		m_BlocksInUse++;
+		ME_MEMWATCH_ALLOCATION(Utility::MemTag::Pools, m_BlockSize);
+		return block;
+	}
+
+	void FixedSizePool::Deallocate(void* block)
+	{
+		if (block == nullptr)
+			return;
+
+		ME_MEMWATCH_FREE(Utility::MemTag::Pools, m_BlockSize);
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		PoolFreeBlock* freeBlock = static_cast<PoolFreeBlock*>(block);
+		freeBlock->Next = m_FreeList;
+		m_FreeList = freeBlock;
+		m_BlocksInUse--;
+	}
+
+	SIZE_T FixedSizePool::AllocateBatch(PoolFreeBlock*& head, SIZE_T count)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		if (m_FreeList == nullptr)
+			m_FreeList = AddSlab();
+
+		// Cut the first 'count' blocks off the free list
+		head = m_FreeList;
+		PoolFreeBlock* tail = head;
+		SIZE_T taken = 1;
+		while (taken < count && tail->Next != nullptr)
+		{
+			tail = tail->Next;
+			taken++;
+		}
+
+		m_FreeList = tail->Next;
+		tail->Next = nullptr;
+		m_BlocksInUse += taken;
+		return taken;
+	}
+
+	void FixedSizePool::DeallocateBatch(PoolFreeBlock* head, PoolFreeBlock* tail, SIZE_T count)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		tail->Next = m_FreeList;
+		m_FreeList = head;
+		m_BlocksInUse -= count;
+	}
+
+	void FixedSizePool::Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		m_FreeList = nullptr;
+		for (void* slab : m_Slabs)
+		{
+			LinkSlab(static_cast<uint8*>(slab), m_FreeList);
+			m_FreeList = static_cast<PoolFreeBlock*>(slab);
+		}
+		m_BlocksInUse = 0;
+	}
+
+	SIZE_T FixedSizePool::GetSlabCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Slabs.Size();
+	}
+
+	SIZE_T FixedSizePool::GetBlocksInUse() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_BlocksInUse;
+	}
+
+	FixedSizePool& FixedSizePool::GetShared(SIZE_T size)
+	{
+		ME_CORE_ASSERT(size <= POOL_ALLOCATOR_MAX_BLOCK_SIZE, "Size is too big for a shared pool");
+		return GetSharedPools()[GetSizeClass(size)];
+	}
+
+	void* FixedSizePool::AllocateShared(SIZE_T size)
+	{
+		const SIZE_T sizeClass = GetSizeClass(size);
+		if constexpr (POOL_ALLOCATOR_THREAD_CACHE_SIZE == 0)
+			return GetSharedPools()[sizeClass].Allocate();
+		else
+		{
+			if (t_ThreadCacheTornDown)
+				return GetSharedPools()[sizeClass].Allocate();
+
+			ThreadCache::Bin& bin = t_ThreadCache.Bins[sizeClass];
+			if (bin.Head == nullptr)
+				bin.Count = GetSharedPools()[sizeClass].AllocateBatch(bin.Head, Algorithm::Max<SIZE_T>(POOL_ALLOCATOR_THREAD_CACHE_SIZE / 2, 1));
+
+			PoolFreeBlock* block = bin.Head;
+			bin.Head = block->Next;
+			bin.Count--;
+			// Cache refills aren't counted, only what's handed out
+			ME_MEMWATCH_ALLOCATION(Utility::MemTag::Pools, GetSharedPools()[sizeClass].GetBlockSize());
+			return block;
+		}
+	}
+
+	void FixedSizePool::DeallocateShared(void* block, SIZE_T size)
+	{
+		if (block == nullptr)
+			return;
+
+		const SIZE_T sizeClass = GetSizeClass(size);
+		if constexpr (POOL_ALLOCATOR_THREAD_CACHE_SIZE == 0)
+			GetSharedPools()[sizeClass].Deallocate(block);
+		else
+		{
+			if (t_ThreadCacheTornDown)
+			{
+				GetSharedPools()[sizeClass].Deallocate(block);
+				return;
+			}
+
+			ME_MEMWATCH_FREE(Utility::MemTag::Pools, GetSharedPools()[sizeClass].GetBlockSize());
+			ThreadCache::Bin& bin = t_ThreadCache.Bins[sizeClass];
+			PoolFreeBlock* freeBlock = static_cast<PoolFreeBlock*>(block);
+			freeBlock->Next = bin.Head;
+			bin.Head = freeBlock;
+			bin.Count++;
+
+			if (bin.Count <= POOL_ALLOCATOR_THREAD_CACHE_SIZE)
+				return;
+
+			// Keep half, the rest goes back so other threads can use it
+			const SIZE_T keep = POOL_ALLOCATOR_THREAD_CACHE_SIZE / 2;
+			PoolFreeBlock* last = bin.Head;
+			for (SIZE_T i = 1; i < keep; i++)
+				last = last->Next;
+
+			PoolFreeBlock* head = keep > 0 ? last->Next : bin.Head;
+			PoolFreeBlock* tail = head;
+			while (tail->Next != nullptr)
+				tail = tail->Next;
+
+			GetSharedPools()[sizeClass].DeallocateBatch(head, tail, bin.Count - keep);
+			if (keep > 0)
+				last->Next = nullptr;
+			else
+				bin.Head = nullptr;
+			bin.Count = keep;
+		}
+	}
+
+	PoolFreeBlock* FixedSizePool::AddSlab()
+	{
+		uint8* slab = static_cast<uint8*>(::operator new(m_BlocksPerSlab * m_BlockSize, std::align_val_t{ CacheLineSize }));
+		m_Slabs.PushBack(slab);
+		LinkSlab(slab, m_FreeList);
+		return reinterpret_cast<PoolFreeBlock*>(slab);
+	}
+
+	void FixedSizePool::LinkSlab(uint8* slab, PoolFreeBlock* next)
+	{
+		// Link the blocks in address order so consecutive allocations are consecutive in memory
+		for (SIZE_T i = 0; i + 1 < m_BlocksPerSlab; i++)
+			reinterpret_cast<PoolFreeBlock*>(slab + i * m_BlockSize)->Next = reinterpret_cast<PoolFreeBlock*>(slab + (i + 1) * m_BlockSize);
+		reinterpret_cast<PoolFreeBlock*>(slab + (m_BlocksPerSlab - 1) * m_BlockSize)->Next = next;
+	}
+}
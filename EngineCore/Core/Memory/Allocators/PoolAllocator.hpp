@@ -0,0 +1,145 @@
+#pragma once
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+
+#include <mutex>
+#include <new>
+
+// Pool block sizes are multiples of this, it's also the alignment every block gets
+constexpr SIZE_T POOL_ALLOCATOR_GRANULARITY = 16;
+// Bigger single objects go straight to the heap
+constexpr SIZE_T POOL_ALLOCATOR_MAX_BLOCK_SIZE = 512;
+constexpr SIZE_T POOL_ALLOCATOR_SLAB_SIZE = ME_KB(64);
+// Free blocks each thread keeps per block size before handing half of them back, 0 turns the thread cache off
+constexpr SIZE_T POOL_ALLOCATOR_THREAD_CACHE_SIZE = 64;
+
+namespace ME::Core::Memory
+{
+	struct PoolFreeBlock
+	{
+		PoolFreeBlock* Next;
+	};
+
+	// Hands out blocks of a single size carved from slabs. Free blocks are linked through their own first bytes,
+	// so there is no bookkeeping per block and blocks of one slab sit next to each other in memory.
+	// Slabs are only released when the pool is destroyed
+	class COREAPI FixedSizePool
+	{
+	public:
+		explicit FixedSizePool(SIZE_T blockSize, SIZE_T slabSize = POOL_ALLOCATOR_SLAB_SIZE);
+		FixedSizePool(const FixedSizePool&) = delete;
+		FixedSizePool(FixedSizePool&&) = delete;
+		~FixedSizePool();
+
+		FixedSizePool& operator=(const FixedSizePool&) = delete;
+		FixedSizePool& operator=(FixedSizePool&&) = delete;
+
+	public:
+		void* Allocate();
+		void Deallocate(void* block);
+
+		// Takes up to 'count' blocks as a linked list under a single lock, returns how many it took
+		SIZE_T AllocateBatch(PoolFreeBlock*& head, SIZE_T count);
+		// Gives back a list of 'count' blocks running from head to tail
+		void DeallocateBatch(PoolFreeBlock* head, PoolFreeBlock* tail, SIZE_T count);
+
+		// Every block is free again, whatever was handed out before must not be used anymore
+		void Clear();
+
+	public:
+		ME_NODISCARD inline SIZE_T GetBlockSize() const { return m_BlockSize; }
+		ME_NODISCARD SIZE_T GetSlabCount() const;
+		// Blocks sitting in thread caches count as in use
+		ME_NODISCARD SIZE_T GetBlocksInUse() const;
+
+	public:
+		// Process wide pool serving blocks of the given size, rounded up to the granularity
+		static FixedSizePool& GetShared(SIZE_T size);
+
+		// Go through the calling thread's cache in front of the shared pools
+		static void* AllocateShared(SIZE_T size);
+		static void DeallocateShared(void* block, SIZE_T size);
+
+	private:
+		PoolFreeBlock* AddSlab();
+		void LinkSlab(uint8* slab, PoolFreeBlock* next);
+
+	private:
+		mutable std::mutex m_Mutex;
+		PoolFreeBlock* m_FreeList;
+		Array<void*> m_Slabs;
+
+		const SIZE_T m_BlockSize;
+		const SIZE_T m_BlocksPerSlab;
+		SIZE_T m_BlocksInUse;
+	};
+
+	// Node allocator for the node based containers. Single objects small enough for a pool come from the
+	// shared pool of their size, everything else (arrays, big or overaligned types) from the heap
+	template <typename T>
+	class PoolAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		PoolAllocator() = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+		value_type* Allocate(SIZE_T n)
+		{
+			if constexpr (IsPooled())
+			{
+				if (n == 1)
+					return static_cast<T*>(FixedSizePool::AllocateShared(sizeof(T)));
+			}
+			void* ptr = ::operator new(n * sizeof(T), std::align_val_t{ alignof(T) });
+			return static_cast<T*>(ptr);
+		}
+
+		void Deallocate(T* ptr, SIZE_T n)
+		{
+			if constexpr (IsPooled())
+			{
+				if (n == 1)
+				{
+					FixedSizePool::DeallocateShared(ptr, sizeof(T));
+					return;
+				}
+			}
+			::operator delete(ptr, n * sizeof(T), std::align_val_t{ alignof(T) });
+		}
+
+		template <typename U>
+		struct Rebind
+		{
+			using Other = PoolAllocator<U>;
+		};
+
+		template <class Val, class... varg>
+		void Construct(Val* ptr, varg&&... args)
+		{
+			new (static_cast<void*>(ptr)) Val(std::forward<varg>(args)...);
+		}
+
+		template <class Val>
+		void Destroy(Val* ptr)
+		{
+			ptr->~Val();
+		}
+
+		bool operator==(const PoolAllocator&) const noexcept { return true; }
+		bool operator!=(const PoolAllocator&) const noexcept { return false; }
+
+	private:
+		static constexpr bool IsPooled()
+		{
+			if constexpr (std::is_void_v<T>)
+				return false;
+			else
+				return sizeof(T) <= POOL_ALLOCATOR_MAX_BLOCK_SIZE && alignof(T) <= POOL_ALLOCATOR_GRANULARITY;
+		}
+	};
+}
@@ -0,0 +1,417 @@
+#include "TLSFAllocator.hpp"
+
+#include <bit>
+
+namespace ME::Core::Memory
+{
+    TLSFAllocator::TLSFAllocator()
+        : m_FirstLevelBitmap(0), m_SecondLevelBitmaps{}, m_FreeHeads{}, m_Allocations(sizeof(OAllocation_S), ME_KB(4)),
+          m_TotalSize(0), m_Alignment(0), m_TotalUnits(0),
+          m_RequestedSize(0), m_ReservedSize(0), m_AllocationCount(0), m_FreeBlockCount(0)
+    {
+    }
+
+    TLSFAllocator::TLSFAllocator(const TLSFAllocatorSpecification& specification)
+        : TLSFAllocator()
+    {
+        Init(specification);
+    }
+
+    TLSFAllocator::~TLSFAllocator()
+    {
+        Clear();
+    }
+
+    OffsetAllocatorErrors TLSFAllocator::Init(const TLSFAllocatorSpecification& specification)
+    {
+        if (!ValidateSpecification(specification))
+        {
+            ME_CORE_ASSERT(false, ME_LOGGER_TEXT("TLSF allocator can't be initialized with given specification!"));
+            return OffsetAllocatorErrors::IncorrectSpecification;
+        }
+
+        m_TotalSize = specification.TotalSize;
+        m_Alignment = specification.Alignment;
+        m_TotalUnits = static_cast<uint32>(m_TotalSize / m_Alignment);
+
+        Clear();
+        return OffsetAllocatorErrors::Success;
+    }
+
+    OffsetAllocatorErrors TLSFAllocator::Allocate(OAllocation& allocation, SIZE_T size)
+    {
+        if (m_TotalUnits == 0)
+        {
+            ME_CORE_ASSERT(false, ME_LOGGER_TEXT("TLSF allocator isn't initialized!"));
+            return OffsetAllocatorErrors::IncorrectSpecification;
+        }
+
+        if (size == 0) return OffsetAllocatorErrors::TooSmallRequest;
+        if (size > m_TotalUnits * m_Alignment) return OffsetAllocatorErrors::TooBigRequest;
+
+        allocation = nullptr;
+
+        const uint32 units = static_cast<uint32>((size + m_Alignment - 1) / m_Alignment);
+        const uint32 index = FindFree(units);
+        if (index == InvalidNode)
+            return OffsetAllocatorErrors::OutOfMemory;
+
+        TakeFree(index, units);
+
+        m_RequestedSize += size;
+        m_ReservedSize += static_cast<SIZE_T>(units) * m_Alignment;
+        m_AllocationCount++;
+
+        allocation = new (m_Allocations.Allocate()) OAllocation_S{ static_cast<SIZE_T>(m_Nodes[index].Offset) * m_Alignment, size, index };
+        return OffsetAllocatorErrors::Success;
+    }
+
+    OffsetAllocatorErrors TLSFAllocator::Free(OAllocation& allocation)
+    {
+        if (m_TotalUnits == 0)
+        {
+            ME_CORE_ASSERT(false, ME_LOGGER_TEXT("TLSF allocator isn't initialized!"));
+            return OffsetAllocatorErrors::IncorrectSpecification;
+        }
+
+        if (!allocation) return OffsetAllocatorErrors::InvalidArgument;
+
+        const uint32 index = allocation->Metadata;
+        if (index >= m_Nodes.Size()) return OffsetAllocatorErrors::OutOfRange;
+        if (m_Nodes[index].State != NodeState::Allocated) return OffsetAllocatorErrors::OutOfRange;
+        if (static_cast<SIZE_T>(m_Nodes[index].Offset) * m_Alignment != allocation->Offset) return OffsetAllocatorErrors::OutOfRange;
+
+        m_RequestedSize -= allocation->Size;
+        m_ReservedSize -= static_cast<SIZE_T>(m_Nodes[index].Size) * m_Alignment;
+        m_AllocationCount--;
+
+        ReleaseAllocated(index);
+
+        m_Allocations.Deallocate(allocation);
+        allocation = nullptr;
+        return OffsetAllocatorErrors::Success;
+    }
+
+    void TLSFAllocator::Clear()
+    {
+        // Handles given out so far die with the allocations
+        m_Allocations.Clear();
+        m_Nodes.Clear();
+        m_UnusedNodes.Clear();
+
+        m_FirstLevelBitmap = 0;
+        for (uint32& bitmap : m_SecondLevelBitmaps)
+            bitmap = 0;
+        for (uint32& head : m_FreeHeads)
+            head = InvalidNode;
+
+        m_RequestedSize = 0;
+        m_ReservedSize = 0;
+        m_AllocationCount = 0;
+        m_FreeBlockCount = 0;
+
+        if (m_TotalUnits == 0)
+            return;
+
+        const uint32 index = CreateNode();
+        Node& node = m_Nodes[index];
+        node.Offset = 0;
+        node.Size = m_TotalUnits;
+        node.PreviousPhysical = InvalidNode;
+        node.NextPhysical = InvalidNode;
+        InsertFree(index);
+    }
+
+    bool TLSFAllocator::Resize(SIZE_T size)
+    {
+        if (size <= m_TotalSize)
+            return true;
+
+        if (m_TotalUnits == 0)
+        {
+            ME_CORE_ERROR("TLSFAllocator::Resize: Allocator isn't initialized");
+            return false;
+        }
+
+        if (!ValidateSpecification({ size, m_Alignment }))
+        {
+            ME_CORE_ERROR("TLSFAllocator::Resize: Size is too big");
+            return false;
+        }
+
+        const uint32 units = static_cast<uint32>(size / m_Alignment);
+        const uint32 addedUnits = units - m_TotalUnits;
+        m_TotalSize = size;
+        if (addedUnits == 0)
+            return true;
+
+        uint32 last = InvalidNode;
+        for (uint32 i = 0; i < m_Nodes.Size(); ++i)
+        {
+            if (m_Nodes[i].State != NodeState::Unused && m_Nodes[i].NextPhysical == InvalidNode)
+            {
+                last = i;
+                break;
+            }
+        }
+
+        // Grow the free tail block or put a new one after the last allocation
+        if (m_Nodes[last].State == NodeState::Free)
+        {
+            RemoveFree(last);
+            m_Nodes[last].Size += addedUnits;
+            InsertFree(last);
+        }
+        else
+        {
+            const uint32 index = CreateNode();
+            Node& node = m_Nodes[index];
+            node.Offset = m_TotalUnits;
+            node.Size = addedUnits;
+            node.PreviousPhysical = last;
+            node.NextPhysical = InvalidNode;
+            m_Nodes[last].NextPhysical = index;
+            InsertFree(index);
+        }
+
+        m_TotalUnits = units;
+        return true;
+    }
+
+    bool TLSFAllocator::Relocate(OAllocation& allocation)
+    {
+        if (!allocation) return false;
+
+        const uint32 index = allocation->Metadata;
+        if (index >= m_Nodes.Size() || m_Nodes[index].State != NodeState::Allocated) return false;
+        if (static_cast<SIZE_T>(m_Nodes[index].Offset) * m_Alignment != allocation->Offset) return false;
+
+        // The first physical block never changes its node. Walk up to the allocation looking for the lowest free block
+        // which fits it, the one right in front of it always does once the allocation merges into it
+        const uint32 units = m_Nodes[index].Size;
+        uint32 target = InvalidNode;
+        for (uint32 i = 0; i != index; i = m_Nodes[i].NextPhysical)
+        {
+            if (m_Nodes[i].State == NodeState::Free && (m_Nodes[i].Size >= units || m_Nodes[i].NextPhysical == index))
+            {
+                target = i;
+                break;
+            }
+        }
+
+        if (target == InvalidNode)
+            return false;
+
+        // Merging only ever keeps the lower node, so the target survives the release
+        ReleaseAllocated(index);
+        TakeFree(target, units);
+
+        allocation->Offset = static_cast<SIZE_T>(m_Nodes[target].Offset) * m_Alignment;
+        allocation->Metadata = target;
+        return true;
+    }
+
+    OffsetAllocatorStatistics TLSFAllocator::GetStatistics() const
+    {
+        OffsetAllocatorStatistics statistics = {};
+        statistics.TotalSize = static_cast<SIZE_T>(m_TotalUnits) * m_Alignment;
+        statistics.RequestedSize = m_RequestedSize;
+        statistics.ReservedSize = m_ReservedSize;
+        statistics.AllocationCount = m_AllocationCount;
+        statistics.FreeBlockCount = m_FreeBlockCount;
+
+        // The largest block is in the highest non-empty list, which is only sorted by range
+        if (m_FirstLevelBitmap != 0)
+        {
+            const uint32 firstLevel = static_cast<uint32>(std::bit_width(m_FirstLevelBitmap) - 1);
+            const uint32 secondLevel = static_cast<uint32>(std::bit_width(m_SecondLevelBitmaps[firstLevel]) - 1);
+            uint32 largest = 0;
+            for (uint32 i = m_FreeHeads[firstLevel * SecondLevelCount + secondLevel]; i != InvalidNode; i = m_Nodes[i].NextFree)
+                largest = m_Nodes[i].Size > largest ? m_Nodes[i].Size : largest;
+            statistics.LargestFreeBlock = static_cast<SIZE_T>(largest) * m_Alignment;
+        }
+
+        return statistics;
+    }
+
+    void TLSFAllocator::Mapping(uint32 size, uint32& firstLevel, uint32& secondLevel)
+    {
+        // Sizes below the second level count map linearly into the first list
+        if (size < SecondLevelCount)
+        {
+            firstLevel = 0;
+            secondLevel = size;
+            return;
+        }
+
+        const uint32 log2 = static_cast<uint32>(std::bit_width(size) - 1);
+        firstLevel = log2 - TLSF_SECOND_LEVEL_SHIFT + 1;
+        secondLevel = (size >> (log2 - TLSF_SECOND_LEVEL_SHIFT)) & (SecondLevelCount - 1);
+    }
+
+    uint32 TLSFAllocator::FindFree(uint32 units) const
+    {
+        // Round the size up to the next list so any block found there fits
+        uint64 search = units;
+        if (units >= SecondLevelCount)
+            search += (uint64(1) << (std::bit_width(units) - 1 - TLSF_SECOND_LEVEL_SHIFT)) - 1;
+
+        uint32 firstLevel, secondLevel;
+        if (search <= ~uint32(0))
+        {
+            Mapping(static_cast<uint32>(search), firstLevel, secondLevel);
+
+            uint32 secondLevelMap = m_SecondLevelBitmaps[firstLevel] & (~uint32(0) << secondLevel);
+            if (secondLevelMap == 0)
+            {
+                const uint32 firstLevelMap = firstLevel + 1 < FirstLevelCount ? m_FirstLevelBitmap & (~uint32(0) << (firstLevel + 1)) : 0;
+                if (firstLevelMap != 0)
+                {
+                    firstLevel = static_cast<uint32>(std::countr_zero(firstLevelMap));
+                    secondLevelMap = m_SecondLevelBitmaps[firstLevel];
+                }
+            }
+
+            if (secondLevelMap != 0)
+            {
+                secondLevel = static_cast<uint32>(std::countr_zero(secondLevelMap));
+                return m_FreeHeads[firstLevel * SecondLevelCount + secondLevel];
+            }
+        }
+
+        // Rounding up skips the list the size itself falls into, blocks there may still be big enough
+        Mapping(units, firstLevel, secondLevel);
+        for (uint32 i = m_FreeHeads[firstLevel * SecondLevelCount + secondLevel]; i != InvalidNode; i = m_Nodes[i].NextFree)
+            if (m_Nodes[i].Size >= units)
+                return i;
+
+        return InvalidNode;
+    }
+
+    void TLSFAllocator::InsertFree(uint32 index)
+    {
+        Node& node = m_Nodes[index];
+        uint32 firstLevel, secondLevel;
+        Mapping(node.Size, firstLevel, secondLevel);
+
+        uint32& head = m_FreeHeads[firstLevel * SecondLevelCount + secondLevel];
+        node.State = NodeState::Free;
+        node.PreviousFree = InvalidNode;
+        node.NextFree = head;
+        if (head != InvalidNode)
+            m_Nodes[head].PreviousFree = index;
+        head = index;
+
+        m_FirstLevelBitmap |= uint32(1) << firstLevel;
+        m_SecondLevelBitmaps[firstLevel] |= uint32(1) << secondLevel;
+        m_FreeBlockCount++;
+    }
+
+    void TLSFAllocator::RemoveFree(uint32 index)
+    {
+        Node& node = m_Nodes[index];
+        uint32 firstLevel, secondLevel;
+        Mapping(node.Size, firstLevel, secondLevel);
+
+        uint32& head = m_FreeHeads[firstLevel * SecondLevelCount + secondLevel];
+        if (node.PreviousFree != InvalidNode)
+            m_Nodes[node.PreviousFree].NextFree = node.NextFree;
+        else
+            head = node.NextFree;
+        if (node.NextFree != InvalidNode)
+            m_Nodes[node.NextFree].PreviousFree = node.PreviousFree;
+
+        if (head == InvalidNode)
+        {
+            m_SecondLevelBitmaps[firstLevel] &= ~(uint32(1) << secondLevel);
+            if (m_SecondLevelBitmaps[firstLevel] == 0)
+                m_FirstLevelBitmap &= ~(uint32(1) << firstLevel);
+        }
+
+        node.State = NodeState::Unused;
+        m_FreeBlockCount--;
+    }
+
+    void TLSFAllocator::TakeFree(uint32 index, uint32 units)
+    {
+        RemoveFree(index);
+
+        // Give the tail back as a new free block
+        if (m_Nodes[index].Size > units)
+        {
+            const uint32 rest = CreateNode();
+            Node& node = m_Nodes[index];
+            Node& restNode = m_Nodes[rest];
+            restNode.Offset = node.Offset + units;
+            restNode.Size = node.Size - units;
+            restNode.PreviousPhysical = index;
+            restNode.NextPhysical = node.NextPhysical;
+            if (node.NextPhysical != InvalidNode)
+                m_Nodes[node.NextPhysical].PreviousPhysical = rest;
+            node.NextPhysical = rest;
+            node.Size = units;
+            InsertFree(rest);
+        }
+
+        m_Nodes[index].State = NodeState::Allocated;
+    }
+
+    void TLSFAllocator::ReleaseAllocated(uint32 index)
+    {
+        // Merge with the free neighbours
+        const uint32 previous = m_Nodes[index].PreviousPhysical;
+        if (previous != InvalidNode && m_Nodes[previous].State == NodeState::Free)
+        {
+            RemoveFree(previous);
+            Node& previousNode = m_Nodes[previous];
+            previousNode.Size += m_Nodes[index].Size;
+            previousNode.NextPhysical = m_Nodes[index].NextPhysical;
+            if (previousNode.NextPhysical != InvalidNode)
+                m_Nodes[previousNode.NextPhysical].PreviousPhysical = previous;
+            ReleaseNode(index);
+            index = previous;
+        }
+
+        const uint32 next = m_Nodes[index].NextPhysical;
+        if (next != InvalidNode && m_Nodes[next].State == NodeState::Free)
+        {
+            RemoveFree(next);
+            Node& node = m_Nodes[index];
+            node.Size += m_Nodes[next].Size;
+            node.NextPhysical = m_Nodes[next].NextPhysical;
+            if (node.NextPhysical != InvalidNode)
+                m_Nodes[node.NextPhysical].PreviousPhysical = index;
+            ReleaseNode(next);
+        }
+
+        InsertFree(index);
+    }
+
+    uint32 TLSFAllocator::CreateNode()
+    {
+        if (!m_UnusedNodes.Empty())
+        {
+            const uint32 index = m_UnusedNodes.Back();
+            m_UnusedNodes.PopBack();
+            return index;
+        }
+
+        m_Nodes.PushBack({ 0, 0, InvalidNode, InvalidNode, InvalidNode, InvalidNode, NodeState::Unused });
+        return static_cast<uint32>(m_Nodes.Size() - 1);
+    }
+
+    void TLSFAllocator::ReleaseNode(uint32 index)
+    {
+        m_Nodes[index].State = NodeState::Unused;
+        m_UnusedNodes.PushBack(index);
+    }
+
+    bool TLSFAllocator::ValidateSpecification(const TLSFAllocatorSpecification& specification)
+    {
+        if (specification.Alignment == 0) return false;
+        if (specification.TotalSize < specification.Alignment) return false;
+        // Offsets and sizes are stored as 32 bit unit counts
+        if (specification.TotalSize / specification.Alignment > SIZE_T(~uint32(0))) return false;
+        return true;
+    }
+}
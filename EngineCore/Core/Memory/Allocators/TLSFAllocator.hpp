@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Allocators/OffsetAllocator.hpp"
+#include "Core/Memory/Allocators/PoolAllocator.hpp"
+
+// Every power of two size range is split into 2^shift free lists
+constexpr uint32 TLSF_SECOND_LEVEL_SHIFT = 4;
+
+namespace ME::Core::Memory
+{
+    struct TLSFAllocatorSpecification
+    {
+        SIZE_T TotalSize;
+        // Offsets and sizes are multiples of this, it doesn't have to be a power of two (ex: size of a vertex)
+        SIZE_T Alignment = 1;
+    };
+
+    // Two-Level Segregated Fit over a range it never touches. Free blocks sit in lists bucketed by the
+    // power of two of their size and then linearly inside it, two bitmaps find the first non-empty list
+    // which surely fits a request. Blocks are split to the exact size and merged with free neighbours
+    // on free, so allocate and free are O(1) and waste at most one alignment per allocation
+    class COREAPI TLSFAllocator : public IOffsetAllocator
+    {
+    public:
+        TLSFAllocator();
+        TLSFAllocator(const TLSFAllocatorSpecification& specification);
+        TLSFAllocator(const TLSFAllocator&) noexcept = delete;
+        TLSFAllocator(TLSFAllocator&&) noexcept = delete;
+        ~TLSFAllocator() override;
+
+    public:
+        OffsetAllocatorErrors Init(const TLSFAllocatorSpecification& specification);
+
+        SIZE_T GetSize() const override { return m_TotalSize; }
+        SIZE_T GetAlignment() const { return m_Alignment; }
+        OffsetAllocatorStatistics GetStatistics() const override;
+
+    public:
+        OffsetAllocatorErrors Allocate(OAllocation& allocation, SIZE_T size) override;
+        OffsetAllocatorErrors Free(OAllocation& allocation) override;
+        void Clear() override;
+        bool Resize(SIZE_T size) override;
+        bool Relocate(OAllocation& allocation) override;
+
+    private:
+        static constexpr uint32 SecondLevelCount = 1u << TLSF_SECOND_LEVEL_SHIFT;
+        static constexpr uint32 FirstLevelCount = 32 - TLSF_SECOND_LEVEL_SHIFT + 1;
+        static constexpr uint32 InvalidNode = ~uint32(0);
+
+        enum class NodeState : uint8
+        {
+            Unused, Free, Allocated
+        };
+
+        // A block of the range, offset and size are in units of the alignment
+        struct Node
+        {
+            uint32 Offset;
+            uint32 Size;
+            uint32 PreviousPhysical;
+            uint32 NextPhysical;
+            uint32 PreviousFree;
+            uint32 NextFree;
+            NodeState State;
+        };
+
+    private:
+        // Bin a free block of this size belongs to
+        static void Mapping(uint32 size, uint32& firstLevel, uint32& secondLevel);
+        uint32 FindFree(uint32 units) const;
+
+        void InsertFree(uint32 node);
+        void RemoveFree(uint32 node);
+        // Takes the front of a free block, the rest stays free
+        void TakeFree(uint32 node, uint32 units);
+        // Frees an allocated block and merges it with its free neighbours
+        void ReleaseAllocated(uint32 node);
+
+        uint32 CreateNode();
+        void ReleaseNode(uint32 node);
+
+        static bool ValidateSpecification(const TLSFAllocatorSpecification& specification);
+
+    private:
+        ME::Core::Array<Node> m_Nodes;
+        ME::Core::Array<uint32> m_UnusedNodes;
+
+        uint32 m_FirstLevelBitmap;
+        uint32 m_SecondLevelBitmaps[FirstLevelCount];
+        uint32 m_FreeHeads[FirstLevelCount * SecondLevelCount];
+
+        FixedSizePool m_Allocations;
+
+    private:
+        SIZE_T m_TotalSize;
+        SIZE_T m_Alignment;
+        uint32 m_TotalUnits;
+
+        SIZE_T m_RequestedSize;
+        SIZE_T m_ReservedSize;
+        SIZE_T m_AllocationCount;
+        SIZE_T m_FreeBlockCount;
+    };
+}
@@ -1,20 +1,101 @@
 #include "Hasher.hpp"
+
+// Pulls the implementation in, so the short key paths inline into the loops below
+#define XXH_INLINE_ALL
 #include <xxhash.h>
 
 namespace ME::Core::Memory
 {
+	static_assert(sizeof(XXH3_state_t) == HASH_STATE_SIZE && alignof(XXH3_state_t) == HASH_STATE_ALIGNMENT, "HASH_STATE_SIZE doesn't match the vendored xxHash!");
+
+	namespace
+	{
+		template <SIZE_T KeySize>
+		inline void HashFixedKeys(const uint8* keys, SIZE_T count, SIZE_T* outHashes, uint64 seed)
+		{
+			for (SIZE_T i = 0; i < count; i++)
+				outHashes[i] = XXH3_64bits_withSeed(keys + i * KeySize, KeySize, seed);
+		}
+
+		inline XXH3_state_t* GetState(uint8* state)
+		{
+			return reinterpret_cast<XXH3_state_t*>(state);
+		}
+
+		inline const XXH3_state_t* GetState(const uint8* state)
+		{
+			return reinterpret_cast<const XXH3_state_t*>(state);
+		}
+	}
+
 	COREAPI SIZE_T Hash64(const void* input, SIZE_T length, uint64 seed)
 	{
-		return XXH64(input, length, seed);
+		return XXH3_64bits_withSeed(input, length, seed);
+	}
+
+	COREAPI Hash128Value Hash128(const void* input, SIZE_T length, uint64 seed)
+	{
+		const XXH128_hash_t hash = XXH3_128bits_withSeed(input, length, seed);
+		return Hash128Value{ hash.low64, hash.high64 };
+	}
+
+	COREAPI void HashMany(const void* keys, SIZE_T count, SIZE_T keySize, SIZE_T* outHashes, uint64 seed)
+	{
+		const uint8* bytes = static_cast<const uint8*>(keys);
+		switch (keySize)
+		{
+			case 4:  HashFixedKeys<4>(bytes, count, outHashes, seed); return;
+			case 8:  HashFixedKeys<8>(bytes, count, outHashes, seed); return;
+			case 12: HashFixedKeys<12>(bytes, count, outHashes, seed); return;
+			case 16: HashFixedKeys<16>(bytes, count, outHashes, seed); return;
+			case 24: HashFixedKeys<24>(bytes, count, outHashes, seed); return;
+			case 32: HashFixedKeys<32>(bytes, count, outHashes, seed); return;
+			default: break;
+		}
+
+		for (SIZE_T i = 0; i < count; i++)
+			outHashes[i] = XXH3_64bits_withSeed(bytes + i * keySize, keySize, seed);
+	}
+
+	HashState::HashState(uint64 seed)
+	{
+		Reset(seed);
+	}
+
+	void HashState::Reset(uint64 seed)
+	{
+		// 64 and 128-bit XXH3 share the state, either digest can be taken
+		XXH3_64bits_reset_withSeed(GetState(m_State), seed);
+	}
+
+	void HashState::Update(const void* data, SIZE_T length)
+	{
+		XXH3_64bits_update(GetState(m_State), data, length);
+	}
+
+	void HashState::Update(const ME::Core::String& str)
+	{
+		Update(str.String(), str.Size() * sizeof(char8));
+	}
+
+	SIZE_T HashState::Finalize() const
+	{
+		return XXH3_64bits_digest(GetState(m_State));
+	}
+
+	Hash128Value HashState::Finalize128() const
+	{
+		const XXH128_hash_t hash = XXH3_128bits_digest(GetState(m_State));
+		return Hash128Value{ hash.low64, hash.high64 };
 	}
 
-    SIZE_T Hasher<class ME::Core::String>::operator()(const String& str, SIZE_T tableSize) const noexcept
+    SIZE_T Hasher<class ME::Core::String>::operator()(const String& str) const noexcept
     {
-        return Hash64(str.String(), str.Size() * sizeof(char8), 0) % tableSize;
+        return Hash64(str.String(), str.Size() * sizeof(char8), 0);
     }
 
-    SIZE_T Hasher<class ME::Core::WideString>::operator()(const ME::Core::WideString& str, SIZE_T tableSize) const noexcept
+    SIZE_T Hasher<class ME::Core::WideString>::operator()(const ME::Core::WideString& str) const noexcept
     {
-        return Hash64(str.String(), str.Size() * sizeof(wchar), 0) % tableSize;
+        return Hash64(str.String(), str.Size() * sizeof(wchar), 0);
     }
 }
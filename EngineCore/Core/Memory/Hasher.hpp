@@ -3,34 +3,97 @@
 #include "Core.hpp"
 #include "Core/Containers/String.hpp"
 
+#include <type_traits>
+
+// Size and alignment of XXH3_state_t, Hasher.cpp checks them against the vendored xxHash
+constexpr SIZE_T HASH_STATE_SIZE = 576;
+constexpr SIZE_T HASH_STATE_ALIGNMENT = 64;
+
 namespace ME::Core::Memory
 {
+	struct Hash128Value
+	{
+		uint64 Low;
+		uint64 High;
+
+		bool operator==(const Hash128Value& other) const noexcept { return Low == other.Low && High == other.High; }
+		bool operator!=(const Hash128Value& other) const noexcept { return !(*this == other); }
+	};
+
+	// XXH3. Much quicker than XXH64 on short keys and vectorized on long inputs
 	COREAPI SIZE_T Hash64(const void* input, SIZE_T length, uint64 seed);
+	// For content hashes that get stored or compared between runs, where 64 bits collide too easily
+	COREAPI Hash128Value Hash128(const void* input, SIZE_T length, uint64 seed);
+
+	// Hashes count keys of keySize bytes each, stored back to back. Common key sizes get a loop of their own,
+	// so the hash is inlined and specialized for the length instead of going through a call per key
+	COREAPI void HashMany(const void* keys, SIZE_T count, SIZE_T keySize, SIZE_T* outHashes, uint64 seed);
 
 	template <typename T>
-	struct Hasher
+	inline void HashMany(const T* keys, SIZE_T count, SIZE_T* outHashes, uint64 seed = 0)
 	{
-		using DataType = T;
+		static_assert(std::is_trivially_copyable_v<T>, "HashMany() hashes the bytes of the keys!");
+		HashMany(keys, count, sizeof(T), outHashes, seed);
+	}
+
+	// Streaming XXH3 for data that comes in pieces, like a file read in chunks or a shader and its defines.
+	// Gives the same result as hashing everything in one go. Finalizing doesn't end the stream
+	class COREAPI HashState
+	{
+	public:
+		HashState(uint64 seed = 0);
 
 	public:
-		ME_NODISCARD inline SIZE_T operator()(const ME::Core::StringView& str, SIZE_T tableSize) const noexcept
+		void Reset(uint64 seed = 0);
+
+		void Update(const void* data, SIZE_T length);
+
+		template <typename T>
+		void Update(const T& value)
 		{
-			return Hash64(str.String(), str.Size() * sizeof(char8), 0) % tableSize;
+			static_assert(std::is_trivially_copyable_v<T>, "Update() hashes the bytes of the value!");
+			Update(&value, sizeof(T));
 		}
 
-		ME_NODISCARD inline SIZE_T operator()(const DataType* data, SIZE_T tableSize) const noexcept
+		void Update(const ME::Core::StringView& str)
 		{
-			return Hash64(data, sizeof(DataType), 0) % tableSize;
+			Update(str.String(), str.Size() * sizeof(char8));
 		}
 
-		ME_NODISCARD inline SIZE_T operator()(DataType data, SIZE_T tableSize) const noexcept
+		void Update(const ME::Core::String& str);
+
+		ME_NODISCARD SIZE_T Finalize() const;
+		ME_NODISCARD Hash128Value Finalize128() const;
+
+	private:
+		alignas(HASH_STATE_ALIGNMENT) uint8 m_State[HASH_STATE_SIZE];
+	};
+
+	// Hashers return the full 64-bit hash. Containers map it to a bucket or slot themselves
+	template <typename T>
+	struct Hasher
+	{
+		using DataType = T;
+
+	public:
+		ME_NODISCARD inline SIZE_T operator()(const DataType& data) const noexcept
 		{
-			return Hash64(&data, sizeof(DataType), 0) % tableSize;
+			return Hash64(&data, sizeof(DataType), 0);
 		}
 
-		ME_NODISCARD inline SIZE_T operator()(const void* data, SIZE_T size, SIZE_T tableSize) const noexcept
+		ME_NODISCARD inline SIZE_T operator()(const void* data, SIZE_T size) const noexcept
+		{
+			return Hash64(data, size, 0);
+		}
+	};
+
+	template<>
+	struct Hasher<ME::Core::StringView>
+	{
+	public:
+		ME_NODISCARD inline SIZE_T operator()(const ME::Core::StringView& str) const noexcept
 		{
-			return Hash64(data, size, 0) % tableSize;
+			return Hash64(str.String(), str.Size() * sizeof(char8), 0);
 		}
 	};
 
@@ -38,13 +101,13 @@ namespace ME::Core::Memory
 	struct COREAPI Hasher<class ME::Core::String>
 	{
 	public:
-        ME_NODISCARD SIZE_T operator()(const ME::Core::String& str, SIZE_T tableSize) const noexcept;
+        ME_NODISCARD SIZE_T operator()(const ME::Core::String& str) const noexcept;
     };
 
 	template<>
 	struct COREAPI Hasher<class ME::Core::WideString>
 	{
 	public:
-        ME_NODISCARD SIZE_T operator()(const ME::Core::WideString& str, SIZE_T tableSize) const noexcept;
+        ME_NODISCARD SIZE_T operator()(const ME::Core::WideString& str) const noexcept;
     };
 }
\ No newline at end of file
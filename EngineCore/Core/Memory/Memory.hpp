@@ -1,9 +1,19 @@
 #pragma once
+#include "Core/Types.hpp"
 
 #include <memory>
+#include <type_traits>
 
 namespace ME::Core::Memory
 {
+	// Assumed size of a cache line. Data written by different threads is kept this far apart to avoid false sharing
+	inline constexpr SIZE_T CacheLineSize = 64;
+
+	// Types which may be moved to another address with memcpy, leaving the source without running its destructor.
+	// Specialize for types that are not trivially copyable but keep no pointers into themselves
+	template<class T>
+	inline constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
 	template<class T>
 	using Reference = std::shared_ptr<T>;
 
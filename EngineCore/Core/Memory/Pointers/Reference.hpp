@@ -1,50 +1,207 @@
 #pragma once
 
-#include "Core/CoreTypes.h"
+#include "Core/Types.hpp"
 
-#include "ReferenceController.h"
+#include "ReferenceController.hpp"
 
-namespace ME::Memory
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ME::Core::Memory
 {
-	template <class T, Pointer::PtrMode Mode = Pointer::PtrMode::SingleThreaded>
-	class Reference
+	// Intrusive shared handle for objects deriving from RefCounted. A copy is one counter increment on the object
+	// itself, non-atomic for single threaded objects, and the handle is just a pointer
+	template <class T>
+	class Ref
 	{
 	public:
 		using DataType = T;
 		using Ptr = DataType*;
 
+	private:
+		static constexpr PtrMode Mode = T::ReferenceMode;
+		using BaseType = RefCounted<Mode>;
+
+		struct AdoptTag {};
+
 	public:
-		Reference() : m_Data(nullptr) {};
-		
-		Reference(T* pointer) : m_Data(pointer), m_Reference(Pointer::CreateReferenceController<T, Mode>(pointer))
+		Ref() noexcept : m_Data(nullptr) {}
+		Ref(std::nullptr_t) noexcept : m_Data(nullptr) {}
+
+		// The count lives in the object, so handing the same pointer to several Refs is fine
+		explicit Ref(Ptr pointer) noexcept : m_Data(pointer)
 		{
+			if (m_Data)
+				Base(m_Data)->AddReference();
 		}
 
+		Ref(const Ref& other) noexcept : Ref(other.m_Data) {}
+		Ref(Ref&& other) noexcept : m_Data(std::exchange(other.m_Data, nullptr)) {}
+
+		template <class OtherT> requires std::is_convertible_v<OtherT*, T*>
+		Ref(const Ref<OtherT>& other) noexcept : Ref(static_cast<Ptr>(other.m_Data)) {}
+
+		template <class OtherT> requires std::is_convertible_v<OtherT*, T*>
+		Ref(Ref<OtherT>&& other) noexcept : m_Data(std::exchange(other.m_Data, nullptr)) {}
+
+		~Ref()
+		{
+			Release();
+		}
+
+	public:
+		Ref& operator=(const Ref& other) noexcept
+		{
+			Ref(other).Swap(*this);
+			return *this;
+		}
+
+		Ref& operator=(Ref&& other) noexcept
+		{
+			Ref(std::move(other)).Swap(*this);
+			return *this;
+		}
+
+		Ref& operator=(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
+		}
+
+		T& operator*() const { return *m_Data; }
+		Ptr operator->() const { return m_Data; }
+		explicit operator bool() const { return m_Data != nullptr; }
+
+		template <class OtherT>
+		bool operator==(const Ref<OtherT>& other) const { return m_Data == other.m_Data; }
+		bool operator==(std::nullptr_t) const { return m_Data == nullptr; }
+
+	public:
+		Ptr Get() const { return m_Data; }
+		int32 GetReferenceCount() const { return m_Data ? Base(m_Data)->GetReferenceCount() : 0; }
+
+		void Reset()
+		{
+			Release();
+			m_Data = nullptr;
+		}
+
+		void Swap(Ref& other) noexcept
+		{
+			std::swap(m_Data, other.m_Data);
+		}
 
 	private:
-		template <class OtherT, Pointer::PtrMode OtherMode> friend class Reference;
-		template <class OtherT, Pointer::PtrMode OtherMode> friend class WeakReference;
+		// Takes over a reference somebody else already added
+		Ref(Ptr pointer, AdoptTag) noexcept : m_Data(pointer) {}
+
+		static BaseType* Base(Ptr pointer) { return static_cast<BaseType*>(pointer); }
+
+		void Release()
+		{
+			if (m_Data && Base(m_Data)->ReleaseReference())
+				delete m_Data;
+		}
 
 	private:
-		Ptr m_Data {nullptr};
-		Pointer::ReferenceHandler<Mode> m_Reference;
+		template <class OtherT> friend class Ref;
+		template <class OtherT> friend class WeakRef;
 
+	private:
+		Ptr m_Data;
 	};
 
-	template <class T, Pointer::PtrMode Mode = Pointer::PtrMode::SingleThreaded>
-	class WeakReference
+	// Doesn't keep the object alive, Lock() gives a Ref while it still is
+	template <class T>
+	class WeakRef
 	{
 	public:
 		using DataType = T;
 		using Ptr = DataType*;
 
 	private:
-		template <class OtherT, Pointer::PtrMode OtherMode> friend class Reference;
-		template <class OtherT, Pointer::PtrMode OtherMode> friend class WeakReference;
+		static constexpr PtrMode Mode = T::ReferenceMode;
+		using BlockType = WeakReferenceBlock<Mode>;
 
-	private:
-		Ptr m_Data{ nullptr };
+	public:
+		WeakRef() noexcept : m_Data(nullptr), m_Block(nullptr) {}
+		WeakRef(std::nullptr_t) noexcept : WeakRef() {}
 
-		Pointer::ReferenceController<Mode> m_Reference;
+		template <class OtherT> requires std::is_convertible_v<OtherT*, T*>
+		WeakRef(const Ref<OtherT>& reference)
+			: m_Data(reference.m_Data),
+			  m_Block(reference.m_Data ? Ref<T>::Base(m_Data)->AcquireWeakBlock() : nullptr)
+		{
+		}
+
+		WeakRef(const WeakRef& other) noexcept : m_Data(other.m_Data), m_Block(other.m_Block)
+		{
+			if (m_Block)
+				m_Block->AddWeakReference();
+		}
+
+		WeakRef(WeakRef&& other) noexcept
+			: m_Data(std::exchange(other.m_Data, nullptr)), m_Block(std::exchange(other.m_Block, nullptr))
+		{
+		}
+
+		~WeakRef()
+		{
+			if (m_Block)
+				m_Block->ReleaseWeakReference();
+		}
+
+	public:
+		WeakRef& operator=(const WeakRef& other)
+		{
+			WeakRef(other).Swap(*this);
+			return *this;
+		}
+
+		WeakRef& operator=(WeakRef&& other) noexcept
+		{
+			WeakRef(std::move(other)).Swap(*this);
+			return *this;
+		}
+
+		template <class OtherT> requires std::is_convertible_v<OtherT*, T*>
+		WeakRef& operator=(const Ref<OtherT>& reference)
+		{
+			WeakRef(reference).Swap(*this);
+			return *this;
+		}
+
+	public:
+		Ref<T> Lock() const
+		{
+			if (!m_Block || !m_Block->TryAddReference())
+				return Ref<T>();
+			return Ref<T>(m_Data, typename Ref<T>::AdoptTag());
+		}
+
+		bool IsExpired() const { return !m_Block || m_Block->IsExpired(); }
+
+		void Reset()
+		{
+			WeakRef().Swap(*this);
+		}
+
+		void Swap(WeakRef& other) noexcept
+		{
+			std::swap(m_Data, other.m_Data);
+			std::swap(m_Block, other.m_Block);
+		}
+
+	private:
+		// Never dereferenced here, only handed out again by Lock() once the object is known to be alive
+		Ptr m_Data;
+		BlockType* m_Block;
 	};
-}
\ No newline at end of file
+
+	template <class T, class... val>
+	Ref<T> MakeRef(val&&... args)
+	{
+		return Ref<T>(new T(std::forward<val>(args)...));
+	}
+}
@@ -1,9 +1,10 @@
 #pragma once
-#include <Core/CoreTypes.h>
+#include "Core/Types.hpp"
+
+#include <atomic>
 #include <type_traits>
-#include <memory>
 
-namespace ME::Memory::Pointer
+namespace ME::Core::Memory
 {
 	enum class PtrMode
 	{
@@ -11,328 +12,219 @@ namespace ME::Memory::Pointer
 		SingleThreaded = 1,
 	};
 
+	template <class T> class Ref;
+	template <class T> class WeakRef;
+
+	// Plain integer in single threaded mode, atomic otherwise
 	template <PtrMode Mode>
-	class BaseReferenceController
+	class ReferenceCounter
 	{
 	private:
-		using ReferenceCountType = std::conditional_t<Mode == PtrMode::ThreadSafe, std::atomic<int32>, int32>;
-
-	public:
-		BaseReferenceController() = default;
+		using CountType = std::conditional_t<Mode == PtrMode::ThreadSafe, std::atomic<int32>, int32>;
 
-		virtual ~BaseReferenceController() {};
-		
 	public:
-		BaseReferenceController(const BaseReferenceController& ) = delete;
-		BaseReferenceController& operator=(const BaseReferenceController&& ) = delete;
+		explicit ReferenceCounter(int32 count = 0) : m_Count(count) {}
 
 	public:
-		virtual void Destroy() = 0;
-
-	public:
-		int32 GetReferenceCount()
+		int32 Get() const
 		{
-			if (Mode == PtrMode::ThreadSafe)
-				return m_ReferenceCount.load(std::memory_order_relaxed);
+			if constexpr (Mode == PtrMode::ThreadSafe)
+				return m_Count.load(std::memory_order_relaxed);
 			else
-				return m_ReferenceCount
+				return m_Count;
 		}
 
-		int32 GetWeakReferenceCount()
+		void Increment()
 		{
-			if (Mode == PtrMode::ThreadSafe)
-				return m_WeakReferenceCount.load(std::memory_order_relaxed);
-			return m_WeakReferenceCount
-		}
-
-		void IncrementReference()
-		{
-			if (Mode == PtrMode::ThreadSafe)
-				m_ReferenceCount.store(1, std::memory_order_relaxed);
+			if constexpr (Mode == PtrMode::ThreadSafe)
+				m_Count.fetch_add(1, std::memory_order_relaxed);
 			else
-				m_ReferenceCount++;
+				m_Count++;
 		}
 
-		void IncrementWeakReference()
+		// True when the count dropped to zero
+		bool Decrement()
 		{
-			if (Mode == PtrMode::ThreadSafe)
-				m_WeakReferenceCount.store(1, std::memory_order_relaxed);
-			else
-				++m_WeakReferenceCount;
-		}
-
-		void DecrementReference()
-		{
-			if (Mode == PtrMode::ThreadSafe)
-			{
-				m_ReferenceCount.fetch_sub(1, std::memory_order_relaxed);
-
-				if (m_ReferenceCount == 0)
-				{
-					Destroy();
-					DecrementWeakReference();
-				}
-			}
+			if constexpr (Mode == PtrMode::ThreadSafe)
+				return m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1;
 			else
-			{
-				m_ReferenceCount--;
-
-				if (m_ReferenceCount == 0)
-				{
-					Destroy();
-					DecrementWeakReference();
-				}
-			}
+				return --m_Count == 0;
 		}
 
-		void DecrementWeakReference()
+		// Increments only if nothing has dropped the count to zero yet
+		bool IncrementIfNotZero()
 		{
-			if (Mode == PtrMode::ThreadSafe)
+			if constexpr (Mode == PtrMode::ThreadSafe)
 			{
-				m_WeakReferenceCount.fetch_sub(1, std::memory_order_relaxed);
-
-				if (m_WeakReferenceCount == 0)
+				int32 count = m_Count.load(std::memory_order_relaxed);
+				while (count != 0)
 				{
-					delete this;
+					if (m_Count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+						return true;
 				}
+				return false;
 			}
 			else
 			{
-				m_WeakReferenceCount--;
-
-				if (m_WeakReferenceCount == 0)
-				{
-					delete this;
-				}
-			}
-		}
-
-		bool ConditionallyAddSharedReference()
-		{
-			if (Mode == PtrMode::ThreadSafe)
-			{
-				bool result = false;
-
-				int32 OriginalCount = m_ReferenceCount.load(std::memory_order_relaxed);
-
-				for (; ; )
-				{
-					if (OriginalCount == 0)
-					{
-						result = false;
-						break;
-					}
-
-					if (m_ReferenceCount.compare_exchange_weak(OriginalCount, OriginalCount + 1, std::memory_order_relaxed))
-					{
-						result = true;
-						break;
-					}
-				}
-
-				if (result)
-					DecrementReference();
-
-				return result;
-			}
-			else
-			{
-				if (m_ReferenceCount == 0)
+				if (m_Count == 0)
 					return false;
-
-				m_ReferenceCount++;
+				m_Count++;
 				return true;
 			}
 		}
 
-	protected:
-		std::atomic<int32> m_ReferenceCount;
-		ReferenceCountType m_WeakReferenceCount;
-
+	private:
+		CountType m_Count;
 	};
 
-	template <class DataType, PtrMode Mode>
-	class ReferenceController : public BaseReferenceController<Mode>
-	{
-	public:
-		explicit ReferenceController(DataType* pointer)	: m_Data(pointer) {}
-		
-		ReferenceController(const ReferenceController&) = delete;
-		ReferenceController& operator&(const ReferenceController&) = delete;
-
-		virtual void Delete() override
-		{
-			delete m_Data;
-		}
+	template <PtrMode Mode> class RefCounted;
 
+	// Created by the first WeakRef of an object and kept alive by the weak references and the object itself.
+	// Tells weak references if the object is still there
+	template <PtrMode Mode>
+	class WeakReferenceBlock
+	{
 	private:
-		DataType* m_Data;
+		using LockType = std::conditional_t<Mode == PtrMode::ThreadSafe, std::atomic<bool>, bool>;
 
-	};
+	public:
+		explicit WeakReferenceBlock(RefCounted<Mode>* object) : m_WeakCount(2), m_Object(object), m_Lock(false) {}
+
+		WeakReferenceBlock(const WeakReferenceBlock&) = delete;
+		WeakReferenceBlock& operator=(const WeakReferenceBlock&) = delete;
 
-	template<PtrMode Mode>
-	class ReferenceHandler
-	{
 	public:
-		ReferenceHandler() : m_Controller(nullptr) {}
-		ReferenceHandler(BaseReferenceController<Mode>* controller) : m_Controller(controller) {}
+		void AddWeakReference() { m_WeakCount.Increment(); }
 
-		ReferenceHandler(const ReferenceHandler& other) : m_Controller(other.m_Controller) 
-		{
-			if (m_Controller)
-				m_Controller->IncrementReference();
-		}
-		ReferenceHandler(ReferenceHandler&& other) : m_Controller(other.m_Controller)
+		void ReleaseWeakReference()
 		{
-			other.m_Controller = nullptr;
+			if (m_WeakCount.Decrement())
+				delete this;
 		}
 
-		ReferenceHandler(WeakReferenceHandler<Mode>&& other)
-			: m_Controller(other.m_Controller)
+		bool IsExpired() const
 		{
-			if (m_Controller)
-			{
-				if (!m_Controller->ConditionallyAddSharedReference())
-					m_Controller = nullptr;
-
-				other.m_Controller.DecrementWeakReference();
-				other.m_Controller = nullptr;
-			}
+			if constexpr (Mode == PtrMode::ThreadSafe)
+				return const_cast<WeakReferenceBlock*>(this)->Locked([this]() { return m_Object == nullptr; });
+			else
+				return m_Object == nullptr;
 		}
 
-		~ReferenceHandler()
+		// Adds a strong reference if the object is still alive
+		bool TryAddReference()
 		{
-			if (m_Controller)
-				m_Controller->DecrementReference();
+			return Locked([this]() { return m_Object != nullptr && m_Object->m_ReferenceCount.IncrementIfNotZero(); });
 		}
 
-	public:
-		ReferenceHandler& operator=(const ReferenceHandler& other)
+		// Called by the object once its last strong reference is gone, before it's destroyed
+		void Expire()
 		{
-			if (m_Controller)
-				m_Controller->IncrementReference();
-
-			return *this;
+			Locked([this]() { m_Object = nullptr; return true; });
+			ReleaseWeakReference();
 		}
 
-		ReferenceHandler& operator=(ReferenceHandler&& other)
+	private:
+		// In thread safe mode the object can't be destroyed while a weak reference tries to revive it
+		template <class Func>
+		bool Locked(Func&& func)
 		{
-			if (other.m_Controller != m_Controller)
+			if constexpr (Mode == PtrMode::ThreadSafe)
 			{
-				if (m_Controller) m_Controller->DecrementReference();
-
-				m_Controller = other.m_Controller;
-				other.m_Controller = nullptr;
+				while (m_Lock.exchange(true, std::memory_order_acquire))
+				{
+					while (m_Lock.load(std::memory_order_relaxed))
+						;
+				}
+				const bool result = func();
+				m_Lock.store(false, std::memory_order_release);
+				return result;
 			}
-
-			return *this;
-		}
-
-		bool IsActive() const
-		{
-			return m_Controller != nullptr;
-		}
-
-		int32 GetReferenceCount() const
-		{
-			return m_Controller != nullptr ? m_Controller->GetReferenceCount() : 0;
+			else
+				return func();
 		}
 
 	private:
-		template<PtrMode Mode> friend class WeakReferenceController;
-
-	private:
-		BaseReferenceController<Mode>* m_Controller;
-
+		ReferenceCounter<Mode> m_WeakCount;
+		RefCounted<Mode>* m_Object;
+		LockType m_Lock;
 	};
 
-	template<PtrMode Mode>
-	class WeakReferenceHandler
+	// Base of objects owned through Ref. The strong count lives in the object itself, the weak reference block is
+	// only allocated once somebody asks for a WeakRef. Objects deleted through a Ref of their base need a virtual
+	// destructor, same as with delete
+	template <PtrMode Mode = PtrMode::SingleThreaded>
+	class RefCounted
 	{
 	public:
-		WeakReferenceHandler() : m_Controller(nullptr) {}
-		WeakReferenceHandler(BaseReferenceController<Mode>* controller) : m_Controller(controller) {}
-		WeakReferenceHandler(const WeakReferenceHandler& other) : m_Controller(other.m_Controller)
-		{
-			if (m_Controller)
-				m_Controller->IncrementReference();
-		}
-
-		WeakReferenceHandler(WeakReferenceHandler&& other) : m_Controller(other.m_Controller)
-		{
-			other.m_Controller = nullptr;
-		}
-
-		WeakReferenceHandler(const ReferenceController& other) : m_Controller(other.m_Controller)
-		{
-			if (m_Controller)
-				m_Controller->IncrementWeakReference();
-		}
+		static constexpr PtrMode ReferenceMode = Mode;
 
-		~WeakReferenceHandler()
-		{
-			if (m_Controller)
-				m_Controller->DecrementWeakReference();
-		}
+	protected:
+		RefCounted() : m_ReferenceCount(0), m_WeakBlock(nullptr) {}
+		// References belong to an object, not to its value
+		RefCounted(const RefCounted&) : RefCounted() {}
+		RefCounted& operator=(const RefCounted&) { return *this; }
+		~RefCounted() = default;
 
 	public:
-		WeakReferenceHandler& operator=(const WeakReferenceHandler& other)
-		{
-			Assign(other.m_Controller);
+		int32 GetReferenceCount() const { return m_ReferenceCount.Get(); }
 
-			return *this;
-		}
+	private:
+		void AddReference() { m_ReferenceCount.Increment(); }
 
-		WeakReferenceHandler& operator=(WeakReferenceHandler&& other)
+		// True when this was the last strong reference and the object has to go
+		bool ReleaseReference()
 		{
-			if (m_Controller)
-				m_Controller->DecrementWeakReference();
-
-			m_Controller = other.m_Controller;
-			other.m_Controller = nullptr;
+			if (!m_ReferenceCount.Decrement())
+				return false;
 
-			return *this;
+			WeakReferenceBlock<Mode>* block = LoadWeakBlock();
+			if (block)
+				block->Expire();
+			return true;
 		}
 
-		WeakReferenceHandler& operator=(const ReferenceController& other)
+		// Only called while a strong reference keeps the object alive
+		WeakReferenceBlock<Mode>* AcquireWeakBlock()
 		{
-			Assign(other.m_Controller)
-			return *this;
-		}
-
-		bool IsActive() const
-		{
-			return m_Controller != nullptr;
-		}
+			WeakReferenceBlock<Mode>* block = LoadWeakBlock();
+			if (block)
+			{
+				block->AddWeakReference();
+				return block;
+			}
 
-	private:
-		void Assign(BaseReferenceController<Mode>* other)
-		{
-			if (other != ReferenceHandler)
+			// One weak reference for the caller and one for the object
+			WeakReferenceBlock<Mode>* created = new WeakReferenceBlock<Mode>(this);
+			if constexpr (Mode == PtrMode::ThreadSafe)
 			{
-				if (other)
-					other->IncrementWeakReference();
+				if (!m_WeakBlock.compare_exchange_strong(block, created, std::memory_order_acq_rel))
+				{
+					delete created;
+					block->AddWeakReference();
+					return block;
+				}
+			}
+			else
+				m_WeakBlock = created;
 
-				if (m_Controller)
-					m_Controller->DecrementWeakReference();
+			return created;
+		}
 
-				m_Controller = other;
-			}
+		WeakReferenceBlock<Mode>* LoadWeakBlock() const
+		{
+			if constexpr (Mode == PtrMode::ThreadSafe)
+				return m_WeakBlock.load(std::memory_order_acquire);
+			else
+				return m_WeakBlock;
 		}
 
 	private:
-		template<PtrMode Mode> friend class ReferenceController;
+		template <class T> friend class Ref;
+		template <class T> friend class WeakRef;
+		friend class WeakReferenceBlock<Mode>;
 
 	private:
-		BaseReferenceController<Mode>* m_Controller;
-
+		ReferenceCounter<Mode> m_ReferenceCount;
+		std::conditional_t<Mode == PtrMode::ThreadSafe, std::atomic<WeakReferenceBlock<Mode>*>, WeakReferenceBlock<Mode>*> m_WeakBlock;
 	};
-
-	template<class T, PtrMode Mode>
-	BaseReferenceController<Mode>* CreateReferenceController(T* pointer)
-	{
-		return new ReferenceController<T, Mode>(pointer);
-	}
-
-
-}
\ No newline at end of file
+}
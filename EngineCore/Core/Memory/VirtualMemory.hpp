@@ -0,0 +1,46 @@
+#pragma once
+#include "Core.hpp"
+
+// Transparent huge page size on x64 Linux, reservations this big get aligned to it
+constexpr SIZE_T VIRTUAL_MEMORY_HUGE_PAGE_SIZE = ME_MB(2);
+
+namespace ME::Core::Memory
+{
+	// Thin layer over the OS page allocator. Address space is reserved first and only costs memory
+	// once it's committed, so a range can be reserved big and committed as it fills up.
+	// All addresses and sizes passed in have to be multiples of the page size
+	class COREAPI VirtualMemory
+	{
+	public:
+		VirtualMemory() = delete;
+
+	public:
+		// Address space without access rights, alignment 0 means the allocation granularity.
+		// Returns nullptr if the address space is exhausted
+		static void* Reserve(SIZE_T size, SIZE_T alignment = 0);
+		static void Release(void* address, SIZE_T size);
+
+		// Makes pages of a reservation readable and writable, they read as zero the first time
+		static bool Commit(void* address, SIZE_T size);
+		// Gives the physical pages back, the range stays reserved
+		static void Decommit(void* address, SIZE_T size);
+
+		// Reserve and commit in one go
+		static void* Allocate(SIZE_T size, SIZE_T alignment = 0);
+
+		// Asks for transparent huge pages on the range, only does something on Linux.
+		// Windows needs the lock pages privilege for large pages, which games can't count on
+		static void AdviseHugePages(void* address, SIZE_T size);
+
+	public:
+		ME_NODISCARD static SIZE_T GetPageSize();
+		// Reservations start at multiples of this, 64 KB on Windows and a page elsewhere
+		ME_NODISCARD static SIZE_T GetAllocationGranularity();
+
+		ME_NODISCARD static inline SIZE_T RoundToPages(SIZE_T size)
+		{
+			const SIZE_T pageSize = GetPageSize();
+			return (size + pageSize - 1) & ~(pageSize - 1);
+		}
+	};
+}
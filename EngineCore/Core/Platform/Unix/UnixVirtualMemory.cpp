@@ -0,0 +1,89 @@
+#include "Core/Memory/VirtualMemory.hpp"
+
+// Every platform file is part of the project, only the Linux build compiles this one
+#if defined(PLATFORM_LINUX)
+#include "Core/Utility/Logging/Logger.hpp"
+
+#include <cerrno>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ME::Core::Memory
+{
+	void* VirtualMemory::Reserve(SIZE_T size, SIZE_T alignment)
+	{
+		ME_CORE_ASSERT(size > 0 && alignment % GetPageSize() == 0, "Reservations are made of whole pages");
+
+		// Over-reserve and cut off both ends, mmap only promises page alignment
+		const SIZE_T padding = alignment > GetPageSize() ? alignment : 0;
+		void* mapping = mmap(nullptr, size + padding, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (mapping == MAP_FAILED)
+			return nullptr;
+		if (padding == 0)
+			return mapping;
+
+		uint8* begin = static_cast<uint8*>(mapping);
+		uint8* aligned = reinterpret_cast<uint8*>((reinterpret_cast<SIZE_T>(begin) + alignment - 1) & ~(alignment - 1));
+		if (aligned != begin)
+			munmap(begin, static_cast<SIZE_T>(aligned - begin));
+		const SIZE_T tail = padding - static_cast<SIZE_T>(aligned - begin);
+		if (tail > 0)
+			munmap(aligned + size, tail);
+		return aligned;
+	}
+
+	void VirtualMemory::Release(void* address, SIZE_T size)
+	{
+		if (address != nullptr && munmap(address, size) != 0)
+			ME_MEM_ERROR("VirtualMemory: Release failed! errno: {0}", errno);
+	}
+
+	bool VirtualMemory::Commit(void* address, SIZE_T size)
+	{
+		if (mprotect(address, size, PROT_READ | PROT_WRITE) != 0)
+		{
+			ME_MEM_ERROR("VirtualMemory: Commit of {0} bytes failed! errno: {1}", size, errno);
+			return false;
+		}
+		return true;
+	}
+
+	void VirtualMemory::Decommit(void* address, SIZE_T size)
+	{
+		// Drops the pages, touching them again would hand out zeroed ones
+		if (madvise(address, size, MADV_DONTNEED) != 0 || mprotect(address, size, PROT_NONE) != 0)
+			ME_MEM_ERROR("VirtualMemory: Decommit failed! errno: {0}", errno);
+	}
+
+	void* VirtualMemory::Allocate(SIZE_T size, SIZE_T alignment)
+	{
+		void* address = Reserve(size, alignment);
+		if (address == nullptr)
+			return nullptr;
+
+		if (!Commit(address, size))
+		{
+			Release(address, size);
+			return nullptr;
+		}
+		return address;
+	}
+
+	void VirtualMemory::AdviseHugePages(void* address, SIZE_T size)
+	{
+		// Only a hint, fails quietly when transparent huge pages are turned off
+		madvise(address, size, MADV_HUGEPAGE);
+	}
+
+	SIZE_T VirtualMemory::GetPageSize()
+	{
+		static const SIZE_T pageSize = static_cast<SIZE_T>(sysconf(_SC_PAGESIZE));
+		return pageSize;
+	}
+
+	SIZE_T VirtualMemory::GetAllocationGranularity()
+	{
+		return GetPageSize();
+	}
+}
+#endif
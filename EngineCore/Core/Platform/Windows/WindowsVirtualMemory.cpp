@@ -0,0 +1,101 @@
+#include "Core/Memory/VirtualMemory.hpp"
+#include "Core/Utility/Logging/Logger.hpp"
+
+namespace ME::Core::Memory
+{
+	namespace
+	{
+		struct PageInfo
+		{
+			SIZE_T PageSize;
+			SIZE_T AllocationGranularity;
+
+			PageInfo()
+			{
+				SYSTEM_INFO info;
+				GetSystemInfo(&info);
+				PageSize = info.dwPageSize;
+				AllocationGranularity = info.dwAllocationGranularity;
+			}
+		};
+
+		const PageInfo& GetPageInfo()
+		{
+			static PageInfo info;
+			return info;
+		}
+
+		void* ReserveAligned(SIZE_T size, SIZE_T alignment, DWORD type, DWORD protection)
+		{
+			if (alignment <= GetPageInfo().AllocationGranularity)
+				return VirtualAlloc(nullptr, size, type, protection);
+
+			// Find a big enough hole, give it back and take the aligned part of it. Another thread may take
+			// the hole in between, then just try again
+			for (uint32 attempt = 0; attempt < 8; attempt++)
+			{
+				void* probe = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+				if (probe == nullptr)
+					return nullptr;
+				VirtualFree(probe, 0, MEM_RELEASE);
+
+				void* aligned = reinterpret_cast<void*>((reinterpret_cast<SIZE_T>(probe) + alignment - 1) & ~(alignment - 1));
+				void* result = VirtualAlloc(aligned, size, type, protection);
+				if (result != nullptr)
+					return result;
+			}
+			return nullptr;
+		}
+	}
+
+	void* VirtualMemory::Reserve(SIZE_T size, SIZE_T alignment)
+	{
+		ME_CORE_ASSERT(size > 0 && alignment % GetPageSize() == 0, "Reservations are made of whole pages");
+		return ReserveAligned(size, alignment, MEM_RESERVE, PAGE_NOACCESS);
+	}
+
+	void VirtualMemory::Release(void* address, SIZE_T size)
+	{
+		(void)size;
+		if (address != nullptr && !VirtualFree(address, 0, MEM_RELEASE))
+			ME_MEM_ERROR("VirtualMemory: Release failed! Win32 error: {0}", static_cast<uint32>(GetLastError()));
+	}
+
+	bool VirtualMemory::Commit(void* address, SIZE_T size)
+	{
+		if (VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+		{
+			ME_MEM_ERROR("VirtualMemory: Commit of {0} bytes failed! Win32 error: {1}", size, static_cast<uint32>(GetLastError()));
+			return false;
+		}
+		return true;
+	}
+
+	void VirtualMemory::Decommit(void* address, SIZE_T size)
+	{
+		if (!VirtualFree(address, size, MEM_DECOMMIT))
+			ME_MEM_ERROR("VirtualMemory: Decommit failed! Win32 error: {0}", static_cast<uint32>(GetLastError()));
+	}
+
+	void* VirtualMemory::Allocate(SIZE_T size, SIZE_T alignment)
+	{
+		ME_CORE_ASSERT(size > 0 && alignment % GetPageSize() == 0, "Reservations are made of whole pages");
+		return ReserveAligned(size, alignment, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	}
+
+	void VirtualMemory::AdviseHugePages(void* address, SIZE_T size)
+	{
+		(void)address;
+		(void)size;
+	}
+
+	SIZE_T VirtualMemory::GetPageSize()
+	{
+		return GetPageInfo().PageSize;
+	}
+
+	SIZE_T VirtualMemory::GetAllocationGranularity()
+	{
+		return GetPageInfo().AllocationGranularity;
+	}
+}
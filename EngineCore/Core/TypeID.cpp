@@ -0,0 +1,95 @@
+#include "TypeID.hpp"
+#include "Core/Containers/Array.hpp"
+
+#include <cstring>
+#include <mutex>
+
+namespace ME::Core
+{
+    namespace
+    {
+        struct TypeEntry
+        {
+            uint64 Hash;
+            TypeName Name;
+        };
+
+        struct TypeCategory
+        {
+            uint64 Hash;
+            // Position is the index
+            Array<TypeEntry> Types;
+        };
+
+        struct RegistryState
+        {
+            std::mutex Mutex;
+            Array<TypeCategory> Categories;
+        };
+
+        // Created on first use, other modules register from their static initializers
+        RegistryState& GetState()
+        {
+            static RegistryState state;
+            return state;
+        }
+
+        inline bool SameName(const TypeName& left, const TypeName& right)
+        {
+            return left.Size == right.Size && std::memcmp(left.Data, right.Data, left.Size) == 0;
+        }
+
+        TypeCategory& FindCategory(RegistryState& state, uint64 category)
+        {
+            for (TypeCategory& entry : state.Categories)
+                if (entry.Hash == category)
+                    return entry;
+
+            state.Categories.PushBack(TypeCategory{ category, {} });
+            return state.Categories[state.Categories.Size() - 1];
+        }
+    }
+
+    uint64 TypeRegistry::Register(uint64 category, uint64 hash, TypeName name)
+    {
+        RegistryState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+
+        Array<TypeEntry>& types = FindCategory(state, category).Types;
+        for (SIZE_T i = 0; i < types.Size(); ++i)
+            if (types[i].Hash == hash && SameName(types[i].Name, name))
+                return i;
+
+        types.PushBack(TypeEntry{ hash, name });
+        return types.Size() - 1;
+    }
+
+    bool TypeRegistry::Validate(uint64 category, uint64 index, uint64 capacity)
+    {
+        RegistryState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+
+        const Array<TypeEntry>& types = FindCategory(state, category).Types;
+        ME_CORE_ASSERT(index < types.Size(), "Validating a type that was never registered!");
+
+        const TypeEntry& type = types[index];
+        for (SIZE_T i = 0; i < types.Size(); ++i)
+            if (i != index && types[i].Hash == type.Hash)
+                ME_CORE_WARN("TypeRegistry: {} and {} have the same type hash {:#x}, anything keyed by the hash alone mixes them up!", type.Name, types[i].Name, type.Hash);
+
+        if (index >= capacity)
+        {
+            ME_CORE_ERROR("TypeRegistry: {} got index {} but only {} fit, register fewer types or raise the limit!", type.Name, index, capacity);
+            ME_CORE_ASSERT(false, "Type index out of capacity!");
+            return false;
+        }
+        return true;
+    }
+
+    uint64 TypeRegistry::GetCount(uint64 category)
+    {
+        RegistryState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        return FindCategory(state, category).Types.Size();
+    }
+}
@@ -1,18 +1,95 @@
 #pragma once
+#include "Core.hpp"
 #include "Core/Memory/CompileTimeHasher.hpp"
-#include <typeinfo>
+#include "Core/Utility/Logging/Logger.hpp"
 
 namespace ME::Core
 {
-    template<typename Retval, uint64 Range>
+    // Compiler generated name of a type, not null terminated. Only stable within one compiler,
+    // MSVC spells out "struct "/"class " where GCC and Clang don't
+    struct TypeName
+    {
+        const char* Data;
+        SIZE_T Size;
+    };
+
+    namespace Helper
+    {
+        constexpr SIZE_T FindInSignature(const char* signature, SIZE_T size, const char* pattern, SIZE_T patternSize)
+        {
+            for (SIZE_T i = 0; i + patternSize <= size; ++i)
+            {
+                SIZE_T matched = 0;
+                while (matched < patternSize && signature[i + matched] == pattern[matched])
+                    ++matched;
+                if (matched == patternSize)
+                    return i;
+            }
+            return size;
+        }
+
+        template<typename T>
+        constexpr TypeName GetTypeName()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            // "struct ME::Core::TypeName __cdecl ME::Core::Helper::GetTypeName<Foo>(void)"
+            constexpr const char* signature = __FUNCSIG__;
+            constexpr SIZE_T size = sizeof(__FUNCSIG__) - 1;
+            constexpr SIZE_T begin = FindInSignature(signature, size, "GetTypeName<", 12) + 12;
+            constexpr SIZE_T end = size - 7; // ">(void)"
+#else
+            // GCC: "... GetTypeName() [with T = Foo]", Clang: "... GetTypeName() [T = Foo]"
+            constexpr const char* signature = __PRETTY_FUNCTION__;
+            constexpr SIZE_T size = sizeof(__PRETTY_FUNCTION__) - 1;
+            constexpr SIZE_T begin = FindInSignature(signature, size, "T = ", 4) + 4;
+            constexpr SIZE_T end = size - 1; // "]"
+#endif
+            static_assert(begin < end && end <= size, "Unknown function signature format!");
+            return TypeName{ signature + begin, end - begin };
+        }
+    }
+
+    template<typename T>
+    inline constexpr TypeName TypeNameOf = Helper::GetTypeName<T>();
+
+    template<typename T>
+    inline constexpr uint64 TypeHash = Memory::HashFNV1(TypeNameOf<T>.Data, TypeNameOf<T>.Size);
+
+    // Hands out dense indices per category in first seen order. Types are looked up by hash and name, so every
+    // module ends up with the same index for a type and two names with the same hash still get their own one
+    class COREAPI TypeRegistry
+    {
+    public:
+        TypeRegistry() = delete;
+
+    public:
+        // Runs during static initialization, so it can't log. Problems are reported by Validate()
+        static uint64 Register(uint64 category, uint64 hash, TypeName name);
+        // Logs hash collisions, returns false when the index doesn't fit into capacity
+        static bool Validate(uint64 category, uint64 index, uint64 capacity);
+        ME_NODISCARD static uint64 GetCount(uint64 category);
+    };
+
+    // Indices are resolved while the module's statics are initialized, reading one is a plain load afterwards.
+    // Don't ask for an ID from another static initializer, its index may not be assigned yet
+    template<typename Category, uint64 Capacity = UINT64_MAX>
     struct TypeIDGenerator
     {
     public:
         template<typename T>
-        inline static Retval ID()
+        inline static const uint64 ID = TypeRegistry::Register(TypeHash<Category>, TypeHash<T>, TypeNameOf<T>);
+
+        template<typename T>
+        inline static bool Validate()
+        {
+            return TypeRegistry::Validate(TypeHash<Category>, ID<T>, Capacity);
+        }
+
+        inline static uint64 Count()
         {
-            const std::type_info& info = typeid(T);
-            return (info.hash_code() ^ (ME::Core::Memory::HashFNV1(info.name()) << 1)) % Range;
+            return TypeRegistry::GetCount(TypeHash<Category>);
         }
     };
-}
\ No newline at end of file
+}
+
+ME_FMT_FORMATTER_UTF8(ME::Core::TypeName, "{}", fmt::string_view(ME_FMT_FORMATTER_VALUE(Data), ME_FMT_FORMATTER_VALUE(Size)));
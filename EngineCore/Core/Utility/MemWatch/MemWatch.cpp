@@ -1,129 +1,552 @@
-/*
-#include "MemWatch.h"
+#include "MemWatch.hpp"
+#include "Core/Algorithm.hpp"
+#include "Core/Containers/Array.hpp"
+#include "Core/Platform/Base/IO.hpp"
+#include "Core/Utility/Logging/Logger.hpp"
 
-static bool MemWatchInitialized = false;
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <new>
 
-namespace Pawn {
+#include <malloc.h>
 
-	MemWatch::MemWatch()
+namespace ME::Core::Utility
+{
+	namespace
 	{
-		MemWatchInitialized = true;
+		constexpr SIZE_T TagCount = static_cast<SIZE_T>(MemTag::Count);
+		// Slots tried for a call site before it's dropped
+		constexpr SIZE_T CallSiteProbeCount = 8;
+
+		static_assert(IS_POWER_OF_2(MEMWATCH_CALL_SITE_CAPACITY), "Call site capacity has to be a power of two.");
+
+		struct TagCounters
+		{
+			std::atomic<uint64> Allocations = 0;
+			std::atomic<uint64> AllocatedBytes = 0;
+			std::atomic<uint64> Frees = 0;
+			std::atomic<uint64> FreedBytes = 0;
+		};
+
+		struct CallSiteCounters
+		{
+			std::atomic<const void*> Address = nullptr;
+			std::atomic<uint64> Allocations = 0;
+			std::atomic<uint64> AllocatedBytes = 0;
+		};
+
+		// Counters of one thread. Only their thread writes them, so a bump is a plain load and store and
+		// readers on other threads just see it a little late. The record of exited threads is shared
+		struct ThreadRecord
+		{
+			TagCounters Tags[TagCount];
+			CallSiteCounters CallSites[MEMWATCH_CALL_SITE_CAPACITY];
+
+			bool Shared = false;
+			ThreadRecord* Previous = nullptr;
+			ThreadRecord* Next = nullptr;
+
+			inline void Add(std::atomic<uint64>& counter, uint64 value)
+			{
+				if (Shared)
+					counter.fetch_add(value, std::memory_order_relaxed);
+				else
+					counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+
+			void AddCallSite(const void* address, uint64 allocations, uint64 bytes)
+			{
+				SIZE_T slot = static_cast<SIZE_T>((reinterpret_cast<uint64>(address) >> 4) * 0x9E3779B97F4A7C15ull);
+				for (SIZE_T probe = 0; probe < CallSiteProbeCount; probe++, slot++)
+				{
+					CallSiteCounters& site = CallSites[slot & (MEMWATCH_CALL_SITE_CAPACITY - 1)];
+					const void* current = site.Address.load(std::memory_order_relaxed);
+					if (current == nullptr && site.Address.compare_exchange_strong(current, address, std::memory_order_relaxed))
+						current = address;
+
+					if (current == address)
+					{
+						Add(site.Allocations, allocations);
+						Add(site.AllocatedBytes, bytes);
+						return;
+					}
+				}
+			}
+		};
+
+		struct FrameState
+		{
+			uint64 FrameIndex = 0;
+			uint64 PreviousAllocations[TagCount] = {};
+			uint64 PreviousBytes[TagCount] = {};
+			uint64 PeakBytes[TagCount] = {};
+
+			MemFrameStatistics LastFrame;
+			uint64 AllocatingFrames = 0;
+			uint64 FirstAllocatingFrame = 0;
+			uint64 MostFrameAllocations = 0;
+			bool Stopped = false;
+		};
+
+		struct MemWatchState
+		{
+			std::mutex Mutex;
+			ThreadRecord* Threads = nullptr;
+			ThreadRecord Retired;
+			FrameState Frames;
+
+			// Once the replaced operator new runs, call sites are taken from there only so nothing is counted twice
+			std::atomic<bool> GlobalHookActive = false;
+
+			MemWatchState()
+			{
+				Retired.Shared = true;
+			}
+		};
+
+		MemWatchState& GetState()
+		{
+			// Never destroyed and not on the heap, frees keep arriving until the process is gone
+			alignas(MemWatchState) static uint8 storage[sizeof(MemWatchState)];
+			static MemWatchState* state = new (storage) MemWatchState();
+			return *state;
+		}
+
+		void RetireRecord(ThreadRecord* record)
+		{
+			MemWatchState& state = GetState();
+			std::lock_guard<std::mutex> lock(state.Mutex);
+
+			for (SIZE_T i = 0; i < TagCount; i++)
+			{
+				state.Retired.Add(state.Retired.Tags[i].Allocations, record->Tags[i].Allocations.load(std::memory_order_relaxed));
+				state.Retired.Add(state.Retired.Tags[i].AllocatedBytes, record->Tags[i].AllocatedBytes.load(std::memory_order_relaxed));
+				state.Retired.Add(state.Retired.Tags[i].Frees, record->Tags[i].Frees.load(std::memory_order_relaxed));
+				state.Retired.Add(state.Retired.Tags[i].FreedBytes, record->Tags[i].FreedBytes.load(std::memory_order_relaxed));
+			}
+			for (const CallSiteCounters& site : record->CallSites)
+			{
+				const void* address = site.Address.load(std::memory_order_relaxed);
+				if (address != nullptr)
+				{
+					state.Retired.AddCallSite(address, site.Allocations.load(std::memory_order_relaxed),
+						site.AllocatedBytes.load(std::memory_order_relaxed));
+				}
+			}
+
+			if (record->Previous != nullptr)
+				record->Previous->Next = record->Next;
+			else
+				state.Threads = record->Next;
+			if (record->Next != nullptr)
+				record->Next->Previous = record->Previous;
+
+			record->~ThreadRecord();
+			std::free(record);
+		}
+
+		// Plain pointer, so it's still readable while the thread is being torn down
+		thread_local ThreadRecord* t_Record = nullptr;
+
+		struct ThreadRecordOwner
+		{
+			~ThreadRecordOwner()
+			{
+				if (t_Record != nullptr && !t_Record->Shared)
+					RetireRecord(t_Record);
+				// Whatever the remaining thread_local destructors free goes to the shared record
+				t_Record = &GetState().Retired;
+			}
+		};
+
+		thread_local ThreadRecordOwner t_RecordOwner;
+
+		ThreadRecord& GetThreadRecord()
+		{
+			if (t_Record != nullptr)
+				return *t_Record;
+
+			// malloc, the hooked operator new would end up here again
+			void* memory = std::malloc(sizeof(ThreadRecord));
+			if (memory == nullptr)
+			{
+				t_Record = &GetState().Retired;
+				return *t_Record;
+			}
+
+			ThreadRecord* record = new (memory) ThreadRecord();
+			{
+				MemWatchState& state = GetState();
+				std::lock_guard<std::mutex> lock(state.Mutex);
+				record->Next = state.Threads;
+				if (state.Threads != nullptr)
+					state.Threads->Previous = record;
+				state.Threads = record;
+			}
+
+			t_Record = record;
+			// Touching the owner registers its destructor for this thread
+			(void)&t_RecordOwner;
+			return *record;
+		}
+
+		struct Totals
+		{
+			uint64 Allocations[TagCount] = {};
+			uint64 AllocatedBytes[TagCount] = {};
+			uint64 Frees[TagCount] = {};
+			uint64 FreedBytes[TagCount] = {};
+
+			void Add(const ThreadRecord& record)
+			{
+				for (SIZE_T i = 0; i < TagCount; i++)
+				{
+					Allocations[i] += record.Tags[i].Allocations.load(std::memory_order_relaxed);
+					AllocatedBytes[i] += record.Tags[i].AllocatedBytes.load(std::memory_order_relaxed);
+					Frees[i] += record.Tags[i].Frees.load(std::memory_order_relaxed);
+					FreedBytes[i] += record.Tags[i].FreedBytes.load(std::memory_order_relaxed);
+				}
+			}
+		};
+
+		// Needs the state's mutex
+		Totals SumThreads(MemWatchState& state)
+		{
+			Totals totals;
+			totals.Add(state.Retired);
+			for (const ThreadRecord* record = state.Threads; record != nullptr; record = record->Next)
+				totals.Add(*record);
+			return totals;
+		}
+
+		// Needs the state's mutex
+		void UpdatePeaks(MemWatchState& state, const Totals& totals)
+		{
+			for (SIZE_T i = 0; i < TagCount; i++)
+			{
+				const uint64 live = totals.AllocatedBytes[i] > totals.FreedBytes[i] ? totals.AllocatedBytes[i] - totals.FreedBytes[i] : 0;
+				state.Frames.PeakBytes[i] = Algorithm::Max(state.Frames.PeakBytes[i], live);
+			}
+		}
+
+		// Needs the state's mutex. Sites of all threads merged, most allocations first
+		Array<MemCallSite> CollectCallSites(MemWatchState& state)
+		{
+			Array<MemCallSite> sites;
+			auto collect = [&sites](const ThreadRecord& record)
+			{
+				for (const CallSiteCounters& site : record.CallSites)
+				{
+					const void* address = site.Address.load(std::memory_order_relaxed);
+					if (address != nullptr)
+					{
+						sites.PushBack({ address, site.Allocations.load(std::memory_order_relaxed),
+							site.AllocatedBytes.load(std::memory_order_relaxed) });
+					}
+				}
+			};
+
+			collect(state.Retired);
+			for (const ThreadRecord* record = state.Threads; record != nullptr; record = record->Next)
+				collect(*record);
+
+			std::sort(sites.Data(), sites.Data() + sites.Size(), [](const MemCallSite& a, const MemCallSite& b) { return a.Address < b.Address; });
+
+			SIZE_T merged = 0;
+			for (SIZE_T i = 0; i < sites.Size(); i++)
+			{
+				if (merged > 0 && sites[merged - 1].Address == sites[i].Address)
+				{
+					sites[merged - 1].Allocations += sites[i].Allocations;
+					sites[merged - 1].AllocatedBytes += sites[i].AllocatedBytes;
+				}
+				else
+					sites[merged++] = sites[i];
+			}
+			while (sites.Size() > merged)
+				sites.PopBack();
+
+			std::sort(sites.Data(), sites.Data() + sites.Size(), [](const MemCallSite& a, const MemCallSite& b) { return a.Allocations > b.Allocations; });
+			return sites;
+		}
+
+		inline bool CountsAsHeap(MemTag tag)
+		{
+			return tag != MemTag::FrameArena;
+		}
+
+		// Without the global hook the allocator hooks own the call sites, with it only the heap does
+		inline bool RecordsCallSite(MemWatchState& state, MemTag tag)
+		{
+			return (tag == MemTag::Heap) == state.GlobalHookActive.load(std::memory_order_relaxed);
+		}
+
+		inline SIZE_T GetAllocationSize(void* ptr, SIZE_T alignment)
+		{
+#if defined(PLATFORM_WINDOWS)
+			return alignment != 0 ? _aligned_msize(ptr, alignment, 0) : _msize(ptr);
+#else
+			(void)alignment;
+			return malloc_usable_size(ptr);
+#endif
+		}
 	}
 
-	void MemWatch::POnAllocated(SIZE_T size)
+	uint64 MemFrameStatistics::GetHeapAllocations() const
 	{
-		m_MemoryUsing += size;
-		m_MemoryUsed += size;
-		m_TotalAllocations++;
-		if (m_MemWatchEnabled) ME_MEM_TRACE("--------------------------------------------------------------");
-		if (m_MemWatchEnabled) ME_MEM_TRACE("New allocation! Size: {} bytes; Total allocations: {}", size, m_TotalAllocations);
-		if (m_MemWatchEnabled) ME_MEM_TRACE("Memory usage: {} bytes; {} kilobytes; {} megabytes", m_MemoryUsing, m_MemoryUsing / 1024, m_MemoryUsing / 1024 / 1024);
-		if (m_MemWatchEnabled) ME_MEM_TRACE("--------------------------------------------------------------");
+		uint64 allocations = 0;
+		for (SIZE_T i = 0; i < TagCount; i++)
+		{
+			if (CountsAsHeap(static_cast<MemTag>(i)))
+				allocations += Allocations[i];
+		}
+		return allocations;
 	}
 
-	void MemWatch::POnFreed(SIZE_T size)
+	void MemWatch::RecordAllocation(MemTag tag, SIZE_T size, const void* callSite)
 	{
-		m_MemoryUsing -= size;
-		m_MemoryFreed += size;
-		m_TotalDeletions++;
-
-		if (m_MemWatchEnabled) ME_MEM_TRACE("--------------------------------------------------------------");
-		if (m_MemWatchEnabled) ME_MEM_TRACE("Freeing memory! Size: {} bytes; Total deletions: {}", size, m_TotalDeletions);
-		if (m_MemWatchEnabled) ME_MEM_TRACE("Memory usage: {} bytes; {} kilobytes; {} megabytes", m_MemoryUsing, m_MemoryUsing / 1024, m_MemoryUsing / 1024 / 1024);
-		if (m_MemWatchEnabled) ME_MEM_TRACE("--------------------------------------------------------------");
+		if (callSite == nullptr)
+			callSite = ME_RETURN_ADDRESS();
+
+		ThreadRecord& record = GetThreadRecord();
+		TagCounters& counters = record.Tags[static_cast<SIZE_T>(tag)];
+		record.Add(counters.Allocations, 1);
+		record.Add(counters.AllocatedBytes, size);
+
+		if (RecordsCallSite(GetState(), tag))
+			record.AddCallSite(callSite, 1, size);
 	}
 
-	void MemWatch::POnEnabled()
+	void MemWatch::RecordFree(MemTag tag, SIZE_T size, uint64 count)
 	{
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("----------------------Output enabled!-------------------------");
-		ME_MEM_TRACE("----------------------/-------------\\-------------------------");
-		ME_MEM_TRACE("Allocation count before enabling: {}; Memory used: {} bytes", m_TotalAllocations, m_MemoryUsed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Deallocation count before enabling: {}; Memory freed: {} bytes", m_TotalDeletions, m_MemoryFreed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Memory usage: {} bytes; {} kilobytes; {} megabytes", m_MemoryUsing, m_MemoryUsing / 1024, m_MemoryUsing / 1024 / 1024);
-		ME_MEM_TRACE("--------------------------------------------------------------");
+		ThreadRecord& record = GetThreadRecord();
+		TagCounters& counters = record.Tags[static_cast<SIZE_T>(tag)];
+		record.Add(counters.Frees, count);
+		record.Add(counters.FreedBytes, size);
 	}
 
-	bool MemWatch::IsMemWatchEnabled()
-	{ 
-		if (!MemWatchInitialized) return false;
-		return Get().PIsMemWatchEnabled(); 
+	void MemWatch::OnFrame()
+	{
+#ifdef ME_MEMWATCH
+		MemWatchState& state = GetState();
+		std::unique_lock<std::mutex> lock(state.Mutex);
+		FrameState& frames = state.Frames;
+		if (frames.Stopped)
+			return;
+
+		const Totals totals = SumThreads(state);
+		UpdatePeaks(state, totals);
+
+		MemFrameStatistics frame = {};
+		frame.FrameIndex = frames.FrameIndex++;
+		for (SIZE_T i = 0; i < TagCount; i++)
+		{
+			frame.Allocations[i] = totals.Allocations[i] - frames.PreviousAllocations[i];
+			frame.AllocatedBytes[i] = totals.AllocatedBytes[i] - frames.PreviousBytes[i];
+			frames.PreviousAllocations[i] = totals.Allocations[i];
+			frames.PreviousBytes[i] = totals.AllocatedBytes[i];
+		}
+		frames.LastFrame = frame;
+
+		// The first frame includes everything before the loop
+		if (frame.FrameIndex < MEMWATCH_WARMUP_FRAMES)
+			return;
+
+		const uint64 allocations = frame.GetHeapAllocations();
+		frames.MostFrameAllocations = Algorithm::Max(frames.MostFrameAllocations, allocations);
+		if (allocations == 0)
+			return;
+
+		if (frames.AllocatingFrames++ == 0)
+		{
+			frames.FirstAllocatingFrame = frame.FrameIndex;
+			lock.unlock();
+			ME_MEM_WARN("MemWatch: frame {} allocated {} times ({} bytes in containers, {} in pools), the frame loop should be allocation free",
+				frame.FrameIndex, allocations,
+				frame.AllocatedBytes[static_cast<SIZE_T>(MemTag::Containers)], frame.AllocatedBytes[static_cast<SIZE_T>(MemTag::Pools)]);
+		}
+#endif
 	}
 
-	void MemWatch::EnableMemWatch()
+	void MemWatch::Shutdown(const char8* jsonPath)
 	{
-		if (!MemWatchInitialized) return;
-		Get().PEnableMemWatch(); 
-	}
+#ifdef ME_MEMWATCH
+		Report();
+		if (jsonPath != nullptr)
+			WriteJson(jsonPath);
 
-	void MemWatch::OnAllocated(SIZE_T size) 
-	{ 
-		if (!MemWatchInitialized) return;
-		Get().POnAllocated(size);
+		MemWatchState& state = GetState();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		state.Frames.Stopped = true;
+#endif
 	}
 
-	void MemWatch::OnFreed(SIZE_T size) 
-	{ 
-		if (!MemWatchInitialized) return;
-		Get().POnFreed(size); 
+	MemTagStatistics MemWatch::GetTagStatistics(MemTag tag)
+	{
+		MemWatchState& state = GetState();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+
+		const Totals totals = SumThreads(state);
+		UpdatePeaks(state, totals);
+
+		const SIZE_T index = static_cast<SIZE_T>(tag);
+		MemTagStatistics statistics;
+		statistics.Allocations = totals.Allocations[index];
+		statistics.AllocatedBytes = totals.AllocatedBytes[index];
+		statistics.Frees = totals.Frees[index];
+		statistics.FreedBytes = totals.FreedBytes[index];
+		statistics.PeakBytes = state.Frames.PeakBytes[index];
+		return statistics;
 	}
 
-	inline void MemWatch::OnUpdate()
+	MemFrameStatistics MemWatch::GetLastFrameStatistics()
 	{
-		if (!MemWatchInitialized) return;
-		Get().POnUpdate();
+		MemWatchState& state = GetState();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		return state.Frames.LastFrame;
 	}
 
-	void MemWatch::OnExit()
+	uint64 MemWatch::GetAllocatingFrameCount()
 	{
-		if (!MemWatchInitialized) return;
-		Get().POnExit();
+		MemWatchState& state = GetState();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		return state.Frames.AllocatingFrames;
 	}
 
-	void MemWatch::POnUpdate()
+	void MemWatch::Report()
 	{
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Allocation count: {}; Memory used: {} bytes", m_TotalAllocations, m_MemoryUsed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Deallocation count: {}; Memory freed: {} bytes", m_TotalDeletions, m_MemoryFreed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Memory usage: {} bytes; {} kilobytes; {} megabytes", m_MemoryUsing, m_MemoryUsing / 1024, m_MemoryUsing / 1024 / 1024);
-		ME_MEM_TRACE("--------------------------------------------------------------");
+		MemTagStatistics tags[TagCount];
+		for (SIZE_T i = 0; i < TagCount; i++)
+			tags[i] = GetTagStatistics(static_cast<MemTag>(i));
+
+		MemWatchState& state = GetState();
+		FrameState frames;
+		Array<MemCallSite> sites;
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			frames = state.Frames;
+			sites = CollectCallSites(state);
+		}
+
+		ME_MEM_INFO("---- MemWatch report, {} frames ----", frames.FrameIndex);
+		for (SIZE_T i = 0; i < TagCount; i++)
+		{
+			ME_MEM_INFO("{:<11} allocations: {} ({} bytes), frees: {} ({} bytes), live: {} bytes, peak: {} bytes",
+				GetTagName(static_cast<MemTag>(i)), tags[i].Allocations, tags[i].AllocatedBytes,
+				tags[i].Frees, tags[i].FreedBytes, tags[i].GetLiveBytes(), tags[i].PeakBytes);
+		}
+
+		if (frames.FrameIndex > MEMWATCH_WARMUP_FRAMES)
+		{
+			ME_MEM_INFO("Frames allocating after the first {}: {} of {}, first: {}, most allocations in one frame: {}",
+				MEMWATCH_WARMUP_FRAMES, frames.AllocatingFrames, frames.FrameIndex - MEMWATCH_WARMUP_FRAMES,
+				frames.FirstAllocatingFrame, frames.MostFrameAllocations);
+		}
+
+		const SIZE_T siteCount = Algorithm::Min(sites.Size(), MEMWATCH_REPORTED_CALL_SITES);
+		for (SIZE_T i = 0; i < siteCount; i++)
+		{
+			ME_MEM_INFO("{:>3}. {} allocations, {} bytes from {}", i + 1,
+				sites[i].Allocations, sites[i].AllocatedBytes, sites[i].Address);
+		}
 	}
 
-	void MemWatch::POnExit()
+	bool MemWatch::WriteJson(const char8* path)
 	{
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Allocation count: {}; Memory used: {} bytes", m_TotalAllocations, m_MemoryUsed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Deallocation count: {}; Memory freed: {} bytes", m_TotalDeletions, m_MemoryFreed);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		ME_MEM_TRACE("Memory usage: {} bytes; {} kilobytes; {} megabytes", m_MemoryUsing, m_MemoryUsing / 1024, m_MemoryUsing / 1024 / 1024);
-		ME_MEM_TRACE("--------------------------------------------------------------");
-		MemWatchInitialized = false;
+		MemTagStatistics tags[TagCount];
+		for (SIZE_T i = 0; i < TagCount; i++)
+			tags[i] = GetTagStatistics(static_cast<MemTag>(i));
+
+		MemWatchState& state = GetState();
+		FrameState frames;
+		Array<MemCallSite> sites;
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			frames = state.Frames;
+			sites = CollectCallSites(state);
+		}
+
+		fmt::memory_buffer json;
+		auto out = std::back_inserter(json);
+		fmt::format_to(out, "{{\n\t\"frames\": {},\n\t\"warmupFrames\": {},\n\t\"allocatingFrames\": {},\n"
+			"\t\"firstAllocatingFrame\": {},\n\t\"mostFrameAllocations\": {},\n\t\"tags\": {{\n",
+			frames.FrameIndex, MEMWATCH_WARMUP_FRAMES, frames.AllocatingFrames, frames.FirstAllocatingFrame, frames.MostFrameAllocations);
+		for (SIZE_T i = 0; i < TagCount; i++)
+		{
+			fmt::format_to(out, "\t\t\"{}\": {{ \"allocations\": {}, \"allocatedBytes\": {}, \"frees\": {}, \"freedBytes\": {}, "
+				"\"liveBytes\": {}, \"peakBytes\": {} }}{}\n",
+				GetTagName(static_cast<MemTag>(i)), tags[i].Allocations, tags[i].AllocatedBytes, tags[i].Frees,
+				tags[i].FreedBytes, tags[i].GetLiveBytes(), tags[i].PeakBytes, i + 1 < TagCount ? "," : "");
+		}
+		fmt::format_to(out, "\t}},\n\t\"callSites\": [\n");
+		for (SIZE_T i = 0; i < sites.Size(); i++)
+		{
+			fmt::format_to(out, "\t\t{{ \"address\": \"{}\", \"allocations\": {}, \"allocatedBytes\": {} }}{}\n",
+				sites[i].Address, sites[i].Allocations, sites[i].AllocatedBytes, i + 1 < sites.Size() ? "," : "");
+		}
+		fmt::format_to(out, "\t]\n}}\n");
+
+		// Opening for writing doesn't truncate
+		if (IO::PFileExists(path))
+			IO::PDeleteFile(path);
+
+		Memory::Reference<IO::File> file = IO::POpenFile(path, IO::FileReadMode::WriteAndRead);
+		if (!file->IsOpen() || !file->RawWrite(json.data(), json.size()))
+		{
+			ME_MEM_WARN("MemWatch: couldn't write the report to \"{}\"", CONVERT_TEXT(path));
+			return false;
+		}
+		file->Close();
+		return true;
 	}
 
-}
+	const asciichar* MemWatch::GetTagName(MemTag tag)
+	{
+		switch (tag)
+		{
+		case MemTag::Heap:			return "Heap";
+		case MemTag::Containers:	return "Containers";
+		case MemTag::Pools:			return "Pools";
+		case MemTag::FrameArena:	return "FrameArena";
+		case MemTag::LargeBlocks:	return "LargeBlocks";
+		default:					return "Unknown";
+		}
+	}
 
-// Redefining allocation functions
+#if defined(ME_MEMWATCH) && defined(ME_MEMWATCH_GLOBAL_NEW)
+	void* MemWatchHeapAllocate(SIZE_T size, SIZE_T alignment, const void* callSite)
+	{
+		size = Algorithm::Max<SIZE_T>(size, 1);
+#if defined(PLATFORM_WINDOWS)
+		void* ptr = alignment != 0 ? _aligned_malloc(size, alignment) : std::malloc(size);
+#else
+		void* ptr = alignment != 0 ? std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1)) : std::malloc(size);
+#endif
+		if (ptr == nullptr)
+			throw std::bad_alloc();
 
-void* operator new (SIZE_T size)
-{
-	//Pawn::MemWatch::OnAllocated(size);
-	return malloc(size);
-}
+		GetState().GlobalHookActive.store(true, std::memory_order_relaxed);
+		MemWatch::RecordAllocation(MemTag::Heap, GetAllocationSize(ptr, alignment), callSite);
+		return ptr;
+	}
 
-void operator delete(void* ptr)
-{
-	//Pawn::MemWatch::OnFreed(sizeof(ptr));
-	free(ptr);
-}
+	void MemWatchHeapFree(void* ptr, SIZE_T alignment)
+	{
+		if (ptr == nullptr)
+			return;
 
-void operator delete[](void* ptr)
-{
-	//Pawn::MemWatch::OnFreed(sizeof(ptr));
-	free(ptr);
+		MemWatch::RecordFree(MemTag::Heap, GetAllocationSize(ptr, alignment));
+#if defined(PLATFORM_WINDOWS)
+		if (alignment != 0)
+		{
+			_aligned_free(ptr);
+			return;
+		}
+#endif
+		std::free(ptr);
+	}
+#endif
 }
-*/
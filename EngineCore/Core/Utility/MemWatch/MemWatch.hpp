@@ -1,59 +1,141 @@
 #pragma once
-/*
-#include "Core.h"
-#include "Core/Utility/Logging/Logger.h"
-
-namespace Pawn {
-
-	class COREAPI MemWatch
+#include "Core.hpp"
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define ME_RETURN_ADDRESS() _ReturnAddress()
+#else
+	#define ME_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+// MemWatch hooks are compiled in when ME_MEMWATCH is defined (debug builds get it from the project files).
+// ME_MEMWATCH_GLOBAL_NEW additionally replaces the global operator new/delete of the executable
+
+// Frames skipped before frames which allocate are reported, loading is done by then
+constexpr uint64 MEMWATCH_WARMUP_FRAMES = 120;
+// Distinct call sites each thread keeps, allocations from sites past that only count per tag
+constexpr SIZE_T MEMWATCH_CALL_SITE_CAPACITY = 1024;
+// Call sites listed in the report
+constexpr SIZE_T MEMWATCH_REPORTED_CALL_SITES = 16;
+
+namespace ME::Core::Utility
+{
+	// What an allocation went through. Heap is every global operator new, so with the global hook
+	// on it also contains the heap traffic of the other tags; the others count what their allocator hands out.
+	// LargeBlocks map pages directly and never show up in Heap
+	enum class MemTag : uint8
 	{
-	public:
-		MemWatch(const MemWatch&) = delete;
-
-		inline static MemWatch& Get() { 
-			static MemWatch instance;
-			return instance; 
-		};
+		Heap = 0,
+		Containers,
+		Pools,
+		FrameArena,
+		LargeBlocks,
 
-	public:
-		inline static bool IsMemWatchEnabled();
-		static void EnableMemWatch();
+		Count
+	};
 
-		static void OnAllocated(SIZE_T size);
-		static void OnFreed(SIZE_T size);
-		static void OnUpdate();
-		static void OnExit();
+	struct MemTagStatistics
+	{
+		uint64 Allocations = 0;
+		uint64 AllocatedBytes = 0;
+		uint64 Frees = 0;
+		uint64 FreedBytes = 0;
+		// Highest live byte count seen at the end of a frame or in a report
+		uint64 PeakBytes = 0;
+
+		ME_NODISCARD inline uint64 GetLiveBytes() const { return AllocatedBytes > FreedBytes ? AllocatedBytes - FreedBytes : 0; }
+	};
 
-		inline static SIZE_T GetCurrentMemoryUsage() { return Get().PGetCurrentMemoryUsage(); }
+	struct MemFrameStatistics
+	{
+		uint64 FrameIndex = 0;
+		// Allocations and bytes per tag made during the frame
+		uint64 Allocations[static_cast<SIZE_T>(MemTag::Count)] = {};
+		uint64 AllocatedBytes[static_cast<SIZE_T>(MemTag::Count)] = {};
 
-	private:
-		inline bool PIsMemWatchEnabled() { return m_MemWatchEnabled; };
-		void PEnableMemWatch() { m_MemWatchEnabled = true; POnEnabled(); };
-		inline SIZE_T PGetCurrentMemoryUsage() { return m_MemoryUsing; }
+		// Allocations which touched the heap, frame arena allocations don't count
+		ME_NODISCARD uint64 GetHeapAllocations() const;
+	};
 
-	private:
-		void POnAllocated(SIZE_T size);
-		void POnFreed(SIZE_T size);
-		void POnEnabled();
-		void POnUpdate();
-		void POnExit();
+	struct MemCallSite
+	{
+		const void* Address = nullptr;
+		uint64 Allocations = 0;
+		uint64 AllocatedBytes = 0;
+	};
 
-	private:
-		bool m_MemWatchEnabled = false;
+	// Allocation profiler. Every hook bumps counters of the calling thread, which are only summed up once
+	// per frame and for reports, so recording never locks and never allocates. Call sites are return addresses,
+	// the debugger or the PDB turns them into functions
+	class COREAPI MemWatch
+	{
+	public:
+		MemWatch() = delete;
 
-		SIZE_T m_MemoryUsed = 0;
-		SIZE_T m_MemoryFreed = 0;
+	public:
+		// callSite == nullptr records the return address of this call
+		static void RecordAllocation(MemTag tag, SIZE_T size, const void* callSite = nullptr);
+		static void RecordFree(MemTag tag, SIZE_T size, uint64 count = 1);
 
-		SIZE_T m_MemoryUsing = 0;
+		// Called by the application once per frame. Warns the first time a frame after the warm-up allocates
+		static void OnFrame();
+		// Logs the report, writes it as JSON to jsonPath if given and stops frame tracking
+		static void Shutdown(const char8* jsonPath = nullptr);
 
-		uint64 m_TotalAllocations = 0;
-		uint64 m_TotalDeletions = 0;
+	public:
+		static MemTagStatistics GetTagStatistics(MemTag tag);
+		ME_NODISCARD static MemFrameStatistics GetLastFrameStatistics();
+		// Frames past the warm-up which allocated from the heap
+		ME_NODISCARD static uint64 GetAllocatingFrameCount();
 
-	private:
-		MemWatch();
+		static void Report();
+		static bool WriteJson(const char8* path);
 
+		static const asciichar* GetTagName(MemTag tag);
 	};
+}
 
+#ifdef ME_MEMWATCH
+	// The call site is whoever called the function using the macro
+	#define ME_MEMWATCH_ALLOCATION(tag, size)	ME::Core::Utility::MemWatch::RecordAllocation(tag, size, ME_RETURN_ADDRESS())
+	#define ME_MEMWATCH_FREE(tag, size)			ME::Core::Utility::MemWatch::RecordFree(tag, size)
+	#define ME_MEMWATCH_RELEASE(tag, size)		ME::Core::Utility::MemWatch::RecordFree(tag, size, 0)
+#else
+	#define ME_MEMWATCH_ALLOCATION(tag, size)
+	#define ME_MEMWATCH_FREE(tag, size)
+	#define ME_MEMWATCH_RELEASE(tag, size)
+#endif
+
+#if defined(ME_MEMWATCH) && defined(ME_MEMWATCH_GLOBAL_NEW)
+	#include <new>
+
+namespace ME::Core::Utility
+{
+	// Implementation behind the replaced global operators, sizes come from the CRT so frees are exact
+	COREAPI void* MemWatchHeapAllocate(SIZE_T size, SIZE_T alignment, const void* callSite);
+	COREAPI void MemWatchHeapFree(void* ptr, SIZE_T alignment);
 }
 
-*/
\ No newline at end of file
+	// Expanded once in the executable, operator replacement only works there
+	#define ME_MEMWATCH_GLOBAL_NEW_OPERATORS()																						\
+	void* operator new(std::size_t size) { return ME::Core::Utility::MemWatchHeapAllocate(size, 0, ME_RETURN_ADDRESS()); }			\
+	void* operator new[](std::size_t size) { return ME::Core::Utility::MemWatchHeapAllocate(size, 0, ME_RETURN_ADDRESS()); }		\
+	void* operator new(std::size_t size, std::align_val_t alignment)																	\
+		{ return ME::Core::Utility::MemWatchHeapAllocate(size, static_cast<SIZE_T>(alignment), ME_RETURN_ADDRESS()); }			\
+	void* operator new[](std::size_t size, std::align_val_t alignment)																\
+		{ return ME::Core::Utility::MemWatchHeapAllocate(size, static_cast<SIZE_T>(alignment), ME_RETURN_ADDRESS()); }			\
+	void operator delete(void* ptr) noexcept { ME::Core::Utility::MemWatchHeapFree(ptr, 0); }									\
+	void operator delete[](void* ptr) noexcept { ME::Core::Utility::MemWatchHeapFree(ptr, 0); }								\
+	void operator delete(void* ptr, std::size_t) noexcept { ME::Core::Utility::MemWatchHeapFree(ptr, 0); }							\
+	void operator delete[](void* ptr, std::size_t) noexcept { ME::Core::Utility::MemWatchHeapFree(ptr, 0); }						\
+	void operator delete(void* ptr, std::align_val_t alignment) noexcept														\
+		{ ME::Core::Utility::MemWatchHeapFree(ptr, static_cast<SIZE_T>(alignment)); }											\
+	void operator delete[](void* ptr, std::align_val_t alignment) noexcept														\
+		{ ME::Core::Utility::MemWatchHeapFree(ptr, static_cast<SIZE_T>(alignment)); }											\
+	void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept												\
+		{ ME::Core::Utility::MemWatchHeapFree(ptr, static_cast<SIZE_T>(alignment)); }											\
+	void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept												\
+		{ ME::Core::Utility::MemWatchHeapFree(ptr, static_cast<SIZE_T>(alignment)); }
+#else
+	#define ME_MEMWATCH_GLOBAL_NEW_OPERATORS()
+#endif
@@ -68,7 +68,7 @@ project "EngineCore"
 		compileas "C++"
 
 	filter "configurations:Debug"
-		defines "ME_DEBUG"
+		defines { "ME_DEBUG", "ME_MEMWATCH" }
 		symbols "on"
 		runtime "Debug"
 
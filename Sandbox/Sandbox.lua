@@ -71,7 +71,7 @@
 			compileas "C++"
 
 		filter "configurations:Debug"
-			defines "ME_DEBUG"
+			defines { "ME_DEBUG", "ME_MEMWATCH" }
 			symbols "On"
 			prebuildcommands
 			{
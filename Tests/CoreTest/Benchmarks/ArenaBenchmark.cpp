@@ -0,0 +1,63 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Allocators/ArenaAllocator.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T FrameCount = 2000;
+		// Roughly what the renderer queues per frame: a batch per mesh, each with a few instances
+		constexpr SIZE_T BatchesPerFrame = 256;
+		constexpr SIZE_T InstancesPerBatch = 16;
+
+		struct InstanceData
+		{
+			float32 Transform[16];
+		};
+
+		// Arrays are filled without reserving, the same way per-frame lists grow in the engine
+		template <typename ArrayType>
+		uint64 SimulateFrames(const char8* name)
+		{
+			uint64 checksum = 0;
+			{
+				IterationBenchmark(nanoseconds, name, FrameCount);
+				for (SIZE_T frame = 0; frame < FrameCount; frame++)
+				{
+					Core::Memory::FrameArena::NextFrame();
+
+					Core::Array<ArrayType, typename ArrayType::AllocatorType::template Rebind<ArrayType>::Other> batches;
+					for (SIZE_T batch = 0; batch < BatchesPerFrame; batch++)
+					{
+						ArrayType& instances = batches.EmplaceBack();
+						for (SIZE_T i = 0; i < InstancesPerBatch; i++)
+						{
+							InstanceData data = {};
+							data.Transform[0] = static_cast<float32>(frame + batch + i);
+							instances.PushBack(data);
+						}
+					}
+
+					for (ArrayType& instances : batches)
+						checksum += static_cast<uint64>(instances.Back().Transform[0]);
+				}
+			}
+			return checksum;
+		}
+	}
+
+	void RunArenaBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Per-frame arrays, {} batches x {} instances, per frame ----", BatchesPerFrame, InstancesPerBatch);
+
+		uint64 checksum = SimulateFrames<Core::Array<InstanceData>>(TEXT("Array (heap)"));
+		checksum += SimulateFrames<Core::FrameArray<InstanceData>>(TEXT("FrameArray (arena)"));
+
+		const Core::Memory::FrameArena& arena = Core::Memory::FrameArena::Get();
+		ME_BENCHMARK_LOG("Arena: {} KB peak, {} KB capacity in {} block(s)",
+			arena.GetPeakUsedSize() / 1024, arena.GetCapacity() / 1024, arena.GetBlockCount());
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
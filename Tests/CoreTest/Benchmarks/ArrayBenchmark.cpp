@@ -0,0 +1,67 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Math/Matrix4x4.hpp>
+
+#include <vector>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T MatrixCount = 1000000;
+
+		Core::Math::Matrix4x4 MakeMatrix(SIZE_T i)
+		{
+			Core::Math::Matrix4x4 matrix;
+			matrix.m[3][0] = static_cast<float32>(i);
+			matrix.m[3][1] = static_cast<float32>(i * 2);
+			matrix.m[3][2] = static_cast<float32>(i * 3);
+			return matrix;
+		}
+	}
+
+	void RunArrayBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Array EmplaceBack ({} Matrix4x4) ----", MatrixCount);
+
+		float32 checksum = 0.0f;
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("Array EmplaceBack"), MatrixCount);
+			Core::Array<Core::Math::Matrix4x4> matrices;
+			for (SIZE_T i = 0; i < MatrixCount; i++)
+				matrices.EmplaceBack(MakeMatrix(i));
+			checksum += matrices.Back().m[3][0];
+		}
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("Array Reserve + EmplaceBack"), MatrixCount);
+			Core::Array<Core::Math::Matrix4x4> matrices;
+			matrices.Reserve(MatrixCount);
+			for (SIZE_T i = 0; i < MatrixCount; i++)
+				matrices.EmplaceBack(MakeMatrix(i));
+			checksum += matrices.Back().m[3][0];
+		}
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("std::vector emplace_back"), MatrixCount);
+			std::vector<Core::Math::Matrix4x4> matrices;
+			for (SIZE_T i = 0; i < MatrixCount; i++)
+				matrices.emplace_back(MakeMatrix(i));
+			checksum += matrices.back().m[3][0];
+		}
+
+		{
+			constexpr SIZE_T EmptyArrayCount = 1000000;
+			IterationBenchmark(nanoseconds, TEXT("Construct empty Array"), EmptyArrayCount);
+			for (SIZE_T i = 0; i < EmptyArrayCount; i++)
+			{
+				Core::Array<Core::Math::Matrix4x4> matrices;
+				checksum += static_cast<float32>(matrices.Capacity());
+			}
+		}
+
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
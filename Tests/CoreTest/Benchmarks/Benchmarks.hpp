@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Core.hpp>
+#include <Core/Utility/Benchmark/Benchmark.hpp>
+
+namespace ME::Tests
+{
+	// Deterministic key source shared by the benchmarks
+	inline uint64 SplitMix64(uint64& state)
+	{
+		uint64 z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	void RunHashMapBenchmark();
+	void RunStringBenchmark();
+	void RunNumberParsingBenchmark();
+	void RunArrayBenchmark();
+	void RunOrderedMapBenchmark();
+	void RunSparseSetBenchmark();
+	void RunQueueBenchmark();
+	void RunArenaBenchmark();
+	void RunPoolAllocatorBenchmark();
+	void RunBuddyAllocatorBenchmark();
+	void RunOffsetAllocatorBenchmark();
+	void RunReferenceBenchmark();
+	void RunSlotMapBenchmark();
+	void RunMemWatchBenchmark();
+	void RunCachingAllocatorBenchmark();
+	void RunLargeBlockAllocatorBenchmark();
+	void RunHashBenchmark();
+	void RunMathBenchmark();
+	void RunTransformBatchBenchmark();
+	void RunFrustumCullingBenchmark();
+	void RunMeshManagerBenchmark();
+}
@@ -0,0 +1,57 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Allocators/BuddyAllocator.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T PairCount = 1000000;
+		// How many allocations stay alive while the rest churn
+		constexpr SIZE_T LiveCount = 256;
+
+		void BenchmarkBuddy(const char8* name, SIZE_T totalSize, SIZE_T minBlockSize, SIZE_T maxRequest)
+		{
+			Core::Memory::BuddyAllocator allocator({ minBlockSize, totalSize });
+			Core::Array<Core::Memory::OAllocation> live(LiveCount);
+			for (auto& allocation : live)
+				allocation = nullptr;
+
+			uint64 state = totalSize;
+			SIZE_T failures = 0;
+			uint64 checksum = 0;
+			{
+				IterationBenchmark(nanoseconds, name, PairCount);
+				for (SIZE_T i = 0; i < PairCount; i++)
+				{
+					const uint64 random = SplitMix64(state);
+					Core::Memory::OAllocation& slot = live[random % LiveCount];
+					if (slot != nullptr)
+						allocator.Free(slot);
+
+					const SIZE_T size = 1 + (random >> 32) % maxRequest;
+					if (allocator.Allocate(slot, size) != Core::Memory::OffsetAllocatorErrors::Success)
+						failures++;
+					else
+						checksum += slot->Offset;
+				}
+			}
+
+			for (auto& allocation : live)
+				if (allocation != nullptr)
+					allocator.Free(allocation);
+
+			ME_BENCHMARK_LOG("Failed allocations: {}, checksum: {}", failures, checksum);
+		}
+	}
+
+	void RunBuddyAllocatorBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- BuddyAllocator, {} random free + allocate pairs, {} live ----", PairCount, LiveCount);
+		// Same layout as the mesh manager's vertex pool
+		BenchmarkBuddy(TEXT("256 MB pool, 256 KB blocks, up to 512 KB"), ME_MB(256), ME_KB(256), ME_KB(512));
+		// Many small blocks, deep trees
+		BenchmarkBuddy(TEXT("256 MB pool, 256 B blocks, up to 64 KB"), ME_MB(256), 256, ME_KB(64));
+	}
+}
@@ -0,0 +1,83 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Allocators/CachingAllocator.hpp>
+
+#include <thread>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T OperationsPerThread = 400000;
+		// Allocations each thread keeps alive, a slot is freed and refilled every operation
+		constexpr SIZE_T LiveAllocations = 256;
+		// Container sized allocations, 8 bytes up to 16 KB
+		constexpr SIZE_T MaxElements = 2048;
+
+		struct Allocation
+		{
+			uint64* Data = nullptr;
+			SIZE_T Count = 0;
+		};
+
+		template <typename AllocatorType>
+		void RunWorker(SIZE_T seed, Core::Atomic_uint64& checksum)
+		{
+			AllocatorType allocator;
+			Allocation live[LiveAllocations];
+			uint64 state = seed;
+			uint64 sum = 0;
+
+			for (SIZE_T i = 0; i < OperationsPerThread; i++)
+			{
+				Allocation& slot = live[i % LiveAllocations];
+				if (slot.Data != nullptr)
+				{
+					sum += slot.Data[0];
+					allocator.Deallocate(slot.Data, slot.Count);
+				}
+
+				// Mostly small, sometimes big, like arrays growing
+				const uint64 random = SplitMix64(state);
+				slot.Count = 1 + ((random & 7) == 0 ? (random >> 8) % MaxElements : (random >> 8) % 64);
+				slot.Data = allocator.Allocate(slot.Count);
+				slot.Data[0] = random;
+			}
+
+			for (Allocation& slot : live)
+			{
+				if (slot.Data != nullptr)
+					allocator.Deallocate(slot.Data, slot.Count);
+			}
+			checksum += sum;
+		}
+
+		template <typename AllocatorType>
+		uint64 BenchmarkThreads(const char8* name, SIZE_T threads)
+		{
+			Core::Atomic_uint64 checksum = 0;
+
+			IterationBenchmark(nanoseconds, name, OperationsPerThread * threads);
+			Core::Array<std::thread> workers;
+			for (SIZE_T t = 0; t < threads; t++)
+				workers.EmplaceBack([&checksum, t]() { RunWorker<AllocatorType>(t + 1, checksum); });
+			for (auto& worker : workers)
+				worker.join();
+
+			return checksum;
+		}
+	}
+
+	void RunCachingAllocatorBenchmark()
+	{
+		uint64 checksum = 0;
+		for (SIZE_T threads : { 1, 2, 4, 8, 16 })
+		{
+			ME_BENCHMARK_LOG("---- Allocate + free, {} threads x {} operations, {} live each ----", threads, OperationsPerThread, LiveAllocations);
+			checksum += BenchmarkThreads<Core::Memory::Allocator<uint64>>(TEXT("Allocator (global heap)"), threads);
+			checksum += BenchmarkThreads<Core::Memory::CachingAllocator<uint64>>(TEXT("CachingAllocator"), threads);
+		}
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
@@ -0,0 +1,132 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Math/FrustumCulling.hpp>
+#include <Core/Math/Matrix4x4.hpp>
+#include <Core/Math/Transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		using Core::Math::BoundingBox;
+		using Core::Math::BoundingSphere;
+		using Core::Math::Frustum;
+		using Core::Math::Matrix4x4;
+		using Core::Math::Quaternion;
+		using Core::Math::Transform;
+		using Core::Math::Vector3D;
+
+		// Instances per frame, not a multiple of 8 so the narrower path and the tail run too
+		constexpr SIZE_T InstanceCount = 100003;
+		constexpr SIZE_T FrameCount = 100;
+		constexpr SIZE_T TransformedBoundsCount = 4096;
+
+		float32 RandomFloat(uint64& state, float32 range)
+		{
+			return (static_cast<float32>(SplitMix64(state) % 20001) / 10000.0f - 1.0f) * range;
+		}
+
+		bool Contains(const BoundingBox& box, const Vector3D& point)
+		{
+			// Leaves room for the rounding of the corners, the box itself is built from the same values
+			constexpr float32 tolerance = 1e-3f;
+			return std::abs(point.X - box.CenterPosition.X) <= box.Extents.X + tolerance
+				&& std::abs(point.Y - box.CenterPosition.Y) <= box.Extents.Y + tolerance
+				&& std::abs(point.Z - box.CenterPosition.Z) <= box.Extents.Z + tolerance;
+		}
+	}
+
+	void RunFrustumCullingBenchmark()
+	{
+		uint64 state = InstanceCount;
+		Core::Array<BoundingBox> boxes(InstanceCount);
+		Core::Array<BoundingSphere> spheres(InstanceCount);
+
+		// Instances all around the camera, about an eighth of them end up in front of it
+		for (SIZE_T i = 0; i < InstanceCount; i++)
+		{
+			const Vector3D center(RandomFloat(state, 500.0f), RandomFloat(state, 500.0f), RandomFloat(state, 500.0f));
+			boxes[i] = { center, 0, Vector3D(1.0f + RandomFloat(state, 0.5f), 1.0f + RandomFloat(state, 0.5f), 1.0f + RandomFloat(state, 0.5f)), 0 };
+			spheres[i] = { center, 1.5f + RandomFloat(state, 0.5f) };
+		}
+
+		// The camera sits at the origin looking down -Z, the extraction wants the column vector form of the matrix
+		const Matrix4x4 projection = Matrix4x4::FromPerspectiveView(1.5f, 16.0f / 9.0f, 0.1f, 400.0f);
+		const Frustum frustum = Core::Math::ExtractFrustumFromMatrix(projection.Transpose());
+
+		Core::Array<uint32> scalarIndices(InstanceCount);
+		Core::Array<uint32> visibleIndices(InstanceCount);
+		SIZE_T scalarBoxCount = 0;
+		SIZE_T boxCount = 0;
+		SIZE_T scalarSphereCount = 0;
+		SIZE_T sphereCount = 0;
+		SIZE_T mismatches = 0;
+
+		ME_BENCHMARK_LOG("---- {} boxes, time per box ----", InstanceCount);
+		{
+			IterationBenchmark(nanoseconds, TEXT("IsVisible one by one"), FrameCount * InstanceCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+			{
+				scalarBoxCount = 0;
+				for (SIZE_T i = 0; i < InstanceCount; i++)
+					if (Core::Math::IsVisible(frustum, boxes[i]))
+						scalarIndices[scalarBoxCount++] = static_cast<uint32>(i);
+			}
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("CullBoxes"), FrameCount * InstanceCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+				boxCount = Core::Math::CullBoxes(frustum, boxes.Data(), InstanceCount, visibleIndices.Data());
+		}
+		mismatches += boxCount != scalarBoxCount;
+		for (SIZE_T i = 0; i < std::min(boxCount, scalarBoxCount); i++)
+			mismatches += visibleIndices[i] != scalarIndices[i];
+
+		ME_BENCHMARK_LOG("---- {} spheres, time per sphere ----", InstanceCount);
+		{
+			IterationBenchmark(nanoseconds, TEXT("IsVisible one by one"), FrameCount * InstanceCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+			{
+				scalarSphereCount = 0;
+				for (SIZE_T i = 0; i < InstanceCount; i++)
+					if (Core::Math::IsVisible(frustum, spheres[i]))
+						scalarIndices[scalarSphereCount++] = static_cast<uint32>(i);
+			}
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("CullSpheres"), FrameCount * InstanceCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+				sphereCount = Core::Math::CullSpheres(frustum, spheres.Data(), InstanceCount, visibleIndices.Data());
+		}
+		mismatches += sphereCount != scalarSphereCount;
+		for (SIZE_T i = 0; i < std::min(sphereCount, scalarSphereCount); i++)
+			mismatches += visibleIndices[i] != scalarIndices[i];
+
+		// Every corner of a transformed box has to land inside the bounds TransformBounds() gives for it
+		SIZE_T uncoveredCorners = 0;
+		for (SIZE_T i = 0; i < TransformedBoundsCount; i++)
+		{
+			Transform transform;
+			transform.SetPosition(Vector3D(RandomFloat(state, 100.0f), RandomFloat(state, 100.0f), RandomFloat(state, 100.0f)));
+			transform.SetRotation(Quaternion(RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f)).Normalized());
+			transform.SetScale(Vector3D(RandomFloat(state, 3.0f), RandomFloat(state, 3.0f), RandomFloat(state, 3.0f)));
+
+			const BoundingBox& box = boxes[i];
+			const BoundingBox bounds = Core::Math::TransformBounds(box, transform);
+			for (uint32 corner = 0; corner < 8; corner++)
+			{
+				const Vector3D local(box.CenterPosition.X + (corner & 1 ? box.Extents.X : -box.Extents.X),
+					box.CenterPosition.Y + (corner & 2 ? box.Extents.Y : -box.Extents.Y),
+					box.CenterPosition.Z + (corner & 4 ? box.Extents.Z : -box.Extents.Z));
+				uncoveredCorners += !Contains(bounds, transform * local);
+			}
+		}
+
+		ME_BENCHMARK_LOG("Visible boxes: {}, visible spheres: {}", boxCount, sphereCount);
+		ME_BENCHMARK_LOG("Mismatches against IsVisible: {}, corners outside the transformed bounds: {}", mismatches, uncoveredCorners);
+	}
+}
@@ -0,0 +1,97 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Hasher.hpp>
+
+// The old Hash64, for comparison
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Same size as a mesh vertex: position, texture coordinates and normal
+		struct VertexKey
+		{
+			float32 Values[8];
+		};
+
+		constexpr SIZE_T KeyCount = 1 << 20;
+
+		// Asset sized content, hashed for cache validation
+		constexpr SIZE_T ContentSize = ME_MB(64);
+		constexpr SIZE_T ChunkSize = ME_KB(64);
+		constexpr SIZE_T ContentRepeats = 4;
+	}
+
+	void RunHashBenchmark()
+	{
+		Core::Array<VertexKey> keys(KeyCount);
+		uint64 state = KeyCount;
+		for (SIZE_T i = 0; i < KeyCount; i++)
+			for (float32& value : keys[i].Values)
+				value = static_cast<float32>(SplitMix64(state) % 4096) * 0.25f;
+
+		Core::Array<SIZE_T> hashes(KeyCount);
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- {} keys of {} bytes ----", KeyCount, sizeof(VertexKey));
+		{
+			IterationBenchmark(nanoseconds, TEXT("XXH64 per key"), KeyCount);
+			for (SIZE_T i = 0; i < KeyCount; i++)
+				hashes[i] = XXH64(&keys[i], sizeof(VertexKey), 0);
+		}
+		checksum += hashes[KeyCount - 1];
+		{
+			IterationBenchmark(nanoseconds, TEXT("Hash64 per key"), KeyCount);
+			for (SIZE_T i = 0; i < KeyCount; i++)
+				hashes[i] = Core::Memory::Hash64(&keys[i], sizeof(VertexKey), 0);
+		}
+		checksum += hashes[KeyCount - 1];
+		{
+			IterationBenchmark(nanoseconds, TEXT("HashMany"), KeyCount);
+			Core::Memory::HashMany(keys.Data(), KeyCount, hashes.Data());
+		}
+		checksum += hashes[KeyCount - 1];
+
+		Core::Array<uint8> content(ContentSize);
+		for (SIZE_T i = 0; i < ContentSize; i++)
+			content[i] = static_cast<uint8>(SplitMix64(state));
+
+		ME_BENCHMARK_LOG("---- {} MB of content, time per MB ----", ContentSize / ME_MB(1));
+		{
+			IterationBenchmark(nanoseconds, TEXT("XXH64"), ContentRepeats * ContentSize / ME_MB(1));
+			for (SIZE_T repeat = 0; repeat < ContentRepeats; repeat++)
+				checksum += XXH64(content.Data(), ContentSize, repeat);
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Hash64"), ContentRepeats * ContentSize / ME_MB(1));
+			for (SIZE_T repeat = 0; repeat < ContentRepeats; repeat++)
+				checksum += Core::Memory::Hash64(content.Data(), ContentSize, repeat);
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Hash128"), ContentRepeats * ContentSize / ME_MB(1));
+			for (SIZE_T repeat = 0; repeat < ContentRepeats; repeat++)
+				checksum += Core::Memory::Hash128(content.Data(), ContentSize, repeat).Low;
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("HashState, 64 KB chunks"), ContentRepeats * ContentSize / ME_MB(1));
+			for (SIZE_T repeat = 0; repeat < ContentRepeats; repeat++)
+			{
+				Core::Memory::HashState hashState(repeat);
+				for (SIZE_T offset = 0; offset < ContentSize; offset += ChunkSize)
+					hashState.Update(content.Data() + offset, ChunkSize);
+				checksum += hashState.Finalize();
+			}
+		}
+
+		Core::Memory::HashState hashState(7);
+		hashState.Update(content.Data(), ChunkSize / 3);
+		hashState.Update(content.Data() + ChunkSize / 3, ChunkSize - ChunkSize / 3);
+		const bool streamMatches = hashState.Finalize() == Core::Memory::Hash64(content.Data(), ChunkSize, 7)
+			&& hashState.Finalize128() == Core::Memory::Hash128(content.Data(), ChunkSize, 7);
+		ME_BENCHMARK_LOG("Streaming matches one-shot: {}", streamMatches);
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
@@ -0,0 +1,70 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/UnorderedMap.hpp>
+#include <Core/Containers/FlatHashMap.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		template <typename MapType>
+		void BenchmarkMap(const Core::Array<uint64>& keys, const Core::Array<uint64>& misses)
+		{
+			const SIZE_T count = keys.Size();
+			uint64 checksum = 0;
+
+			MapType map;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					map.Insert(keys[i], i);
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Find (hit)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					checksum += map.Find(keys[i])->Value2;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Contains (miss)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					checksum += map.Contains(misses[i]);
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Iterate"), count);
+				for (auto& pair : map)
+					checksum += pair.Value2;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					map.Erase(keys[i]);
+			}
+
+			ME_BENCHMARK_LOG("Checksum: {}, size after erase: {}", checksum, map.Size());
+		}
+	}
+
+	void RunHashMapBenchmark()
+	{
+		for (SIZE_T count = 1000; count <= 10000000; count *= 10)
+		{
+			uint64 state = count;
+			Core::Array<uint64> keys;
+			Core::Array<uint64> misses;
+			keys.Reserve(count);
+			misses.Reserve(count);
+			for (SIZE_T i = 0; i < count; i++)
+			{
+				keys.PushBack(SplitMix64(state));
+				misses.PushBack(SplitMix64(state));
+			}
+
+			ME_BENCHMARK_LOG("---- UnorderedMap<uint64, uint64>, {} keys ----", count);
+			BenchmarkMap<Core::UnorderedMap<uint64, uint64>>(keys, misses);
+
+			ME_BENCHMARK_LOG("---- FlatHashMap<uint64, uint64>, {} keys ----", count);
+			BenchmarkMap<Core::FlatHashMap<uint64, uint64>>(keys, misses);
+		}
+	}
+}
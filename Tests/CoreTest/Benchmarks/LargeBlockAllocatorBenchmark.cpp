@@ -0,0 +1,104 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Allocators/LargeBlockAllocator.hpp>
+
+#include <cstring>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Asset sized buffers, 256 KB up to 8 MB
+		constexpr SIZE_T BufferCount = 128;
+		constexpr SIZE_T MinBufferSize = ME_KB(256);
+		constexpr SIZE_T MaxBufferSize = ME_MB(8);
+
+		// Random reads over one big buffer, the page walk dominates once it's far bigger than the TLB reach
+		constexpr SIZE_T ScanBufferSize = ME_MB(256);
+		constexpr SIZE_T ReadCount = 1 << 22;
+
+		struct HeapBuffers
+		{
+			static void* Allocate(SIZE_T size) { return ::operator new(size); }
+			static void Deallocate(void* ptr, SIZE_T size) { ::operator delete(ptr, size); }
+		};
+
+		struct LargeBlockBuffers
+		{
+			static void* Allocate(SIZE_T size) { return Core::Memory::LargeBlockHeap::Allocate(size); }
+			static void Deallocate(void* ptr, SIZE_T size) { Core::Memory::LargeBlockHeap::Deallocate(ptr, size); }
+		};
+
+		template <typename Buffers>
+		uint64 BenchmarkLoadUnload(const char8* name, const Core::Array<SIZE_T>& sizes)
+		{
+			uint64 checksum = 0;
+			Core::Array<void*> buffers(BufferCount);
+			Core::Array<SIZE_T> bufferSizes(BufferCount);
+
+			auto load = [&](SIZE_T i, SIZE_T size)
+			{
+				buffers[i] = Buffers::Allocate(size);
+				bufferSizes[i] = size;
+				std::memset(buffers[i], static_cast<int32>(i), size);
+				checksum += static_cast<uint8*>(buffers[i])[size - 1];
+			};
+
+			// Load everything, swap every other buffer for one of another size and drop all, like streaming levels
+			IterationBenchmark(nanoseconds, name, BufferCount + BufferCount / 2);
+			for (SIZE_T i = 0; i < BufferCount; i++)
+				load(i, sizes[i]);
+			for (SIZE_T i = 1; i < BufferCount; i += 2)
+			{
+				Buffers::Deallocate(buffers[i], bufferSizes[i]);
+				load(i, sizes[(i + 1) % BufferCount]);
+			}
+			for (SIZE_T i = 0; i < BufferCount; i++)
+				Buffers::Deallocate(buffers[i], bufferSizes[i]);
+
+			return checksum;
+		}
+
+		template <typename Buffers>
+		uint64 BenchmarkRandomReads(const char8* name)
+		{
+			uint8* buffer = static_cast<uint8*>(Buffers::Allocate(ScanBufferSize));
+			std::memset(buffer, 1, ScanBufferSize);
+
+			uint64 checksum = 0;
+			uint64 state = 7;
+			{
+				IterationBenchmark(nanoseconds, name, ReadCount);
+				for (SIZE_T i = 0; i < ReadCount; i++)
+					checksum += buffer[SplitMix64(state) % ScanBufferSize];
+			}
+
+			Buffers::Deallocate(buffer, ScanBufferSize);
+			return checksum;
+		}
+	}
+
+	void RunLargeBlockAllocatorBenchmark()
+	{
+		Core::Array<SIZE_T> sizes;
+		sizes.Reserve(BufferCount);
+		uint64 state = BufferCount;
+		for (SIZE_T i = 0; i < BufferCount; i++)
+			sizes.PushBack(MinBufferSize + SplitMix64(state) % (MaxBufferSize - MinBufferSize));
+
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- Load + fill + unload, {} buffers of {} KB to {} MB ----", BufferCount, MinBufferSize / ME_KB(1), MaxBufferSize / ME_MB(1));
+		checksum += BenchmarkLoadUnload<HeapBuffers>(TEXT("Heap"), sizes);
+		checksum += BenchmarkLoadUnload<LargeBlockBuffers>(TEXT("LargeBlockHeap"), sizes);
+
+		ME_BENCHMARK_LOG("---- Random reads over {} MB ----", ScanBufferSize / ME_MB(1));
+		checksum += BenchmarkRandomReads<HeapBuffers>(TEXT("Heap"));
+		checksum += BenchmarkRandomReads<LargeBlockBuffers>(TEXT("LargeBlockHeap, huge page hint"));
+
+		const Core::Memory::LargeBlockStatistics statistics = Core::Memory::LargeBlockHeap::GetStatistics();
+		ME_BENCHMARK_LOG("Live blocks: {}, peak committed: {} MB", statistics.BlockCount, statistics.PeakCommittedBytes / ME_MB(1));
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
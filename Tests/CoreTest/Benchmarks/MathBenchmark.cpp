@@ -0,0 +1,191 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Math/Math.hpp>
+#include <Core/Math/Matrix4x4.hpp>
+#include <Core/Math/Quaternion.hpp>
+#include <Core/Math/Vector3.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		using Core::Math::Matrix4x4;
+		using Core::Math::Quaternion;
+		using Core::Math::Vector3D;
+
+		constexpr SIZE_T ValueCount = 4096;
+		constexpr SIZE_T IterationCount = 1 << 20;
+
+		// The scalar versions the SIMD kernels replaced, kept as the baseline and to check results against
+		Matrix4x4 ScalarMultiply(const Matrix4x4& a, const Matrix4x4& b)
+		{
+			Matrix4x4 result;
+			for (uint32 row = 0; row < 4; row++)
+				for (uint32 column = 0; column < 4; column++)
+					result.m[row][column] = a.m[row][0] * b.m[0][column] + a.m[row][1] * b.m[1][column] + a.m[row][2] * b.m[2][column] + a.m[row][3] * b.m[3][column];
+			return result;
+		}
+
+		Matrix4x4 ScalarInvert(const Matrix4x4& matrix)
+		{
+			const Matrix4x4 adjoint = matrix.Adjoint();
+			const float32 det = matrix.Determinant();
+			if (std::abs(det) < 1e-6f)
+				return Matrix4x4(0.0f);
+
+			// The adjoint holds the cofactors, the inverse is its transpose over the determinant
+			Matrix4x4 result;
+			for (uint32 row = 0; row < 4; row++)
+				for (uint32 column = 0; column < 4; column++)
+					result.m[row][column] = adjoint.m[column][row] / det;
+			return result;
+		}
+
+		Quaternion ScalarSlerp(const Quaternion& from, const Quaternion& to, float32 alpha)
+		{
+			const float32 angle = std::acos(std::clamp(from.Dot(to), -1.0f, 1.0f));
+			if (std::abs(angle) < 1e-6f)
+				return from;
+
+			const float32 sinAngle = std::sin(angle);
+			return from * (std::sin((1.0f - alpha) * angle) / sinAngle) + to * (std::sin(alpha * angle) / sinAngle);
+		}
+
+		float32 RandomFloat(uint64& state, float32 range)
+		{
+			return (static_cast<float32>(SplitMix64(state) % 20001) / 10000.0f - 1.0f) * range;
+		}
+
+		float32 MaxDifference(const Matrix4x4& a, const Matrix4x4& b)
+		{
+			float32 difference = 0.0f;
+			for (uint32 row = 0; row < 4; row++)
+				for (uint32 column = 0; column < 4; column++)
+				{
+					const float32 scale = std::max(1.0f, std::abs(a.m[row][column]));
+					difference = std::max(difference, std::abs(a.m[row][column] - b.m[row][column]) / scale);
+				}
+			return difference;
+		}
+
+		uint64 Bits(float32 value)
+		{
+			return static_cast<uint64>(std::bit_cast<uint32>(value));
+		}
+
+		uint64 Checksum(const Matrix4x4& matrix)
+		{
+			return Bits(matrix.m11) + Bits(matrix.m22) + Bits(matrix.m33) + Bits(matrix.m44);
+		}
+	}
+
+	void RunMathBenchmark()
+	{
+		uint64 state = ValueCount;
+		Core::Array<Matrix4x4> matrices;
+		Core::Array<Vector3D> positions;
+		Core::Array<Vector3D> scales;
+		Core::Array<Quaternion> rotations;
+		matrices.Reserve(ValueCount);
+		positions.Reserve(ValueCount);
+		scales.Reserve(ValueCount);
+		rotations.Reserve(ValueCount);
+
+		for (SIZE_T i = 0; i < ValueCount; i++)
+		{
+			positions.PushBack(Vector3D(RandomFloat(state, 100.0f), RandomFloat(state, 100.0f), RandomFloat(state, 100.0f)));
+			scales.PushBack(Vector3D(1.5f + RandomFloat(state, 1.0f), 1.5f + RandomFloat(state, 1.0f), 1.5f + RandomFloat(state, 1.0f)));
+			rotations.PushBack(Quaternion(RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f)).Normalized());
+			matrices.PushBack(Matrix4x4::FromTranslationRotationScale(positions[i], rotations[i], scales[i]));
+		}
+
+		const SIZE_T mask = ValueCount - 1;
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- Matrix multiply ----");
+		{
+			IterationBenchmark(nanoseconds, TEXT("Scalar"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(ScalarMultiply(matrices[i & mask], matrices[(i + 1) & mask]));
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Matrix4x4::operator*"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(matrices[i & mask] * matrices[(i + 1) & mask]);
+		}
+
+		ME_BENCHMARK_LOG("---- Matrix inverse ----");
+		{
+			IterationBenchmark(nanoseconds, TEXT("Scalar"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(ScalarInvert(matrices[i & mask]));
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Matrix4x4::Invert"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(matrices[i & mask].Invert());
+		}
+
+		ME_BENCHMARK_LOG("---- TRS compose ----");
+		{
+			IterationBenchmark(nanoseconds, TEXT("T * R * S"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(Matrix4x4::FromTranslation(positions[i & mask]) * Matrix4x4::FromQuaternion(rotations[i & mask]) * Matrix4x4::FromScale(scales[i & mask]));
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("FromTranslationRotationScale"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Checksum(Matrix4x4::FromTranslationRotationScale(positions[i & mask], rotations[i & mask], scales[i & mask]));
+		}
+
+		ME_BENCHMARK_LOG("---- Quaternion slerp ----");
+		{
+			IterationBenchmark(nanoseconds, TEXT("Scalar"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Bits(ScalarSlerp(rotations[i & mask], rotations[(i + 1) & mask], 0.25f).w);
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Quaternion::Slerp"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Bits(rotations[i & mask].Slerp(rotations[(i + 1) & mask], 0.25f).w);
+		}
+
+		ME_BENCHMARK_LOG("---- Rotate + transform vectors ----");
+		{
+			IterationBenchmark(nanoseconds, TEXT("Quaternion::RotateVector"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Bits(rotations[i & mask].RotateVector(positions[(i + 1) & mask]).x);
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Matrix4x4::Transform"), IterationCount);
+			for (SIZE_T i = 0; i < IterationCount; i++)
+				checksum += Bits(matrices[i & mask].Transform(positions[(i + 1) & mask]).x);
+		}
+
+		// The kernels keep the scalar operation order, only the inverse is allowed to round differently
+		SIZE_T multiplyMismatches = 0;
+		SIZE_T composeMismatches = 0;
+		float32 inverseDifference = 0.0f;
+		for (SIZE_T i = 0; i < ValueCount; i++)
+		{
+			const Matrix4x4& matrix = matrices[i];
+			const Matrix4x4 product = matrix * matrices[(i + 1) & mask];
+			const Matrix4x4 scalarProduct = ScalarMultiply(matrix, matrices[(i + 1) & mask]);
+			multiplyMismatches += std::memcmp(&product, &scalarProduct, sizeof(Matrix4x4)) != 0;
+
+			const Matrix4x4 composed = Matrix4x4::FromTranslationRotationScale(positions[i], rotations[i], scales[i]);
+			const Matrix4x4 multiplied = Matrix4x4::FromTranslation(positions[i]) * Matrix4x4::FromQuaternion(rotations[i]) * Matrix4x4::FromScale(scales[i]);
+			composeMismatches += std::memcmp(&composed, &multiplied, sizeof(Matrix4x4)) != 0;
+
+			inverseDifference = std::max(inverseDifference, MaxDifference(matrix.Invert(), ScalarInvert(matrix)));
+		}
+		ME_BENCHMARK_LOG("Multiply mismatches: {}, compose mismatches: {}, largest relative inverse difference: {}", multiplyMismatches, composeMismatches, inverseDifference);
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
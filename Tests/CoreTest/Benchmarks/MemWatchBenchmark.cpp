@@ -0,0 +1,74 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Utility/MemWatch/MemWatch.hpp>
+
+#include <thread>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T RecordCount = 4000000;
+		// Distinct call sites the recorded allocations are spread over
+		constexpr SIZE_T CallSiteCount = 64;
+
+		// What a profiler without per-thread records does, every thread hits the same cache lines
+		struct SharedCounters
+		{
+			Core::Atomic_uint64 Allocations = 0;
+			Core::Atomic_uint64 AllocatedBytes = 0;
+			Core::Atomic_uint64 Frees = 0;
+			Core::Atomic_uint64 FreedBytes = 0;
+		};
+
+		SharedCounters g_SharedCounters;
+
+		void RecordShared(SIZE_T size)
+		{
+			g_SharedCounters.Allocations.fetch_add(1, std::memory_order_relaxed);
+			g_SharedCounters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+			g_SharedCounters.Frees.fetch_add(1, std::memory_order_relaxed);
+			g_SharedCounters.FreedBytes.fetch_add(size, std::memory_order_relaxed);
+		}
+
+		void RecordMemWatch(SIZE_T size)
+		{
+			static uint8 sites[CallSiteCount];
+			Core::Utility::MemWatch::RecordAllocation(Core::Utility::MemTag::Containers, size, &sites[size % CallSiteCount]);
+			Core::Utility::MemWatch::RecordFree(Core::Utility::MemTag::Containers, size);
+		}
+
+		template <typename Record>
+		void BenchmarkRecording(const char8* name, SIZE_T threads, Record&& record)
+		{
+			const SIZE_T perThread = RecordCount / threads;
+
+			IterationBenchmark(nanoseconds, name, perThread * threads);
+			Core::Array<std::thread> workers;
+			for (SIZE_T t = 0; t < threads; t++)
+			{
+				workers.EmplaceBack([&record, perThread, t]()
+				{
+					for (SIZE_T i = 0; i < perThread; i++)
+						record(16 + ((i + t) & 255));
+				});
+			}
+			for (auto& worker : workers)
+				worker.join();
+		}
+	}
+
+	void RunMemWatchBenchmark()
+	{
+		for (SIZE_T threads : { 1, 4 })
+		{
+			ME_BENCHMARK_LOG("---- Recording {} allocation + free pairs, {} threads ----", RecordCount, threads);
+			BenchmarkRecording(TEXT("Shared atomic counters"), threads, RecordShared);
+			BenchmarkRecording(TEXT("MemWatch"), threads, RecordMemWatch);
+		}
+
+		const Core::Utility::MemTagStatistics statistics = Core::Utility::MemWatch::GetTagStatistics(Core::Utility::MemTag::Containers);
+		ME_BENCHMARK_LOG("Recorded allocations: {}, live bytes: {}", statistics.Allocations, statistics.GetLiveBytes());
+	}
+}
@@ -0,0 +1,105 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Renderer/Assets/Mesh.hpp>
+#include <Renderer/Managers/MeshManager.hpp>
+
+#include <algorithm>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		using Render::Manager::MeshManager;
+
+		constexpr SIZE_T MeshCount = 1000;
+		constexpr SIZE_T MinVertexCount = 16;
+		constexpr SIZE_T MaxVertexCount = 1024;
+
+		// Highest byte any loaded mesh uses in the vertex and index pools
+		SIZE_T PoolsEnd(const Core::Array<Core::Memory::Reference<Assets::Mesh>>& meshes)
+		{
+			SIZE_T end = 0;
+			for (const auto& mesh : meshes)
+			{
+				if (!mesh->IsLoaded())
+					continue;
+
+				const Core::Memory::OAllocation vertexAlloc = mesh->GetVertexAllocation();
+				const Core::Memory::OAllocation indexAlloc = mesh->GetIndexAllocation();
+				end = std::max(end, vertexAlloc->Offset + vertexAlloc->Size);
+				end = std::max(end, indexAlloc->Offset + indexAlloc->Size);
+			}
+			return end;
+		}
+	}
+
+	void RunMeshManagerBenchmark()
+	{
+		MeshManager& manager = MeshManager::Get();
+
+		// Exact fits, so whatever a hole frees can be taken by the meshes above it
+		Render::Manager::MeshMemoryPoolInfo info = {};
+		info.VertexMemoryPoolSize = ME_MB(64);
+		info.IndexMemoryPoolSize = ME_MB(32);
+		info.MeshletMemoryPoolSize = ME_MB(1);
+		info.AllocatorType = Core::Memory::OffsetAllocatorType::TLSF;
+		info.CPUSimulation = true;
+		manager.Init(info);
+
+		uint64 state = MeshCount;
+		Core::Array<Core::Memory::Reference<Assets::Mesh>> meshes;
+		meshes.Reserve(MeshCount);
+		for (SIZE_T i = 0; i < MeshCount; i++)
+		{
+			Core::Memory::Reference<Assets::Mesh> mesh = manager.CreateMesh();
+			const SIZE_T vertexCount = MinVertexCount + SplitMix64(state) % (MaxVertexCount - MinVertexCount);
+			mesh->GetVertices().Resize(vertexCount);
+			mesh->GetIndices().Resize(vertexCount * 3);
+			mesh->Load();
+			meshes.EmplaceBack(mesh);
+		}
+
+		// Every other mesh goes away, the rest is spread over twice the space it needs
+		for (SIZE_T i = 0; i < MeshCount; i += 2)
+			meshes[i]->Unload();
+
+		const SIZE_T endBefore = PoolsEnd(meshes);
+		SIZE_T movedBytes = 0;
+		SIZE_T compactions = 0;
+
+		ME_BENCHMARK_LOG("---- {} meshes, half of them unloaded ----", MeshCount);
+		{
+			Benchmark(nanoseconds, TEXT("CompactPools until nothing moves"));
+			for (SIZE_T moved = manager.CompactPools(); moved != 0; moved = manager.CompactPools())
+			{
+				movedBytes += moved;
+				compactions++;
+			}
+		}
+		const SIZE_T endAfter = PoolsEnd(meshes);
+
+		// The draw data the shaders get has to point at the ranges the meshes own now
+		SIZE_T mismatches = 0;
+		const Core::Array<Assets::DrawMeshData>& drawData = manager.GetDrawBufferData();
+		for (const auto& mesh : meshes)
+		{
+			if (!mesh->IsLoaded())
+				continue;
+
+			const Assets::DrawMeshData& data = drawData[mesh->GetMeshID()];
+			const Core::Memory::OAllocation vertexAlloc = mesh->GetVertexAllocation();
+			const Core::Memory::OAllocation indexAlloc = mesh->GetIndexAllocation();
+			mismatches += data.VertexOffset * sizeof(Assets::Vertex) != vertexAlloc->Offset;
+			mismatches += data.VertexCount != mesh->GetVertices().Size();
+			mismatches += data.IndexOffset * sizeof(uint32) != indexAlloc->Offset;
+			mismatches += data.IndexCount != mesh->GetIndices().Size();
+		}
+
+		ME_BENCHMARK_LOG("Compactions: {}, moved: {} bytes, pools end: {} -> {} bytes", compactions, movedBytes, endBefore, endAfter);
+		ME_BENCHMARK_LOG("Lowered: {}, draw data mismatches: {}", endAfter < endBefore, mismatches);
+
+		for (const auto& mesh : meshes)
+			mesh->Unload();
+	}
+}
@@ -0,0 +1,113 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/String.hpp>
+#include <Core/Containers/String/StringUtils.hpp>
+
+#include <charconv>
+#include <cstring>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T FloatCount = 10000000;
+
+		// Writes 'count' floats in shortest round-trip form separated by spaces, like the values of an OBJ file
+		Core::Array<char8> MakeFloatText(SIZE_T count, Core::Array<float32>& values)
+		{
+			Core::Array<char8> text;
+			uint64 state = 0x5EED;
+			char buffer[32];
+
+			values.Clear();
+			for (SIZE_T i = 0; i < count; i++)
+			{
+				// Mostly OBJ-like coordinates with some values spread over the whole exponent range
+				uint64 random = SplitMix64(state);
+				float32 value;
+				if (i % 8 == 0)
+				{
+					uint32 bits = static_cast<uint32>(random) & 0xBFFFFFFF;
+					memcpy(&value, &bits, sizeof(value));
+				}
+				else
+					value = static_cast<float32>(static_cast<int64>(random % 2000000) - 1000000) / 1000.0f;
+				values.EmplaceBack(value);
+
+				std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+				for (const char* c = buffer; c != result.ptr; c++)
+					text.EmplaceBack(static_cast<char8>(*c));
+				text.EmplaceBack(TEXT(' '));
+			}
+			return text;
+		}
+	}
+
+	void RunNumberParsingBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Float parsing ({} values) ----", FloatCount);
+
+		Core::Array<float32> expected;
+		Core::Array<char8> text = MakeFloatText(FloatCount, expected);
+		const Core::StringView view(text.Data(), text.Size());
+
+		float64 checksum = 0.0;
+		SIZE_T mismatches = 0;
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("StringToFloat"), FloatCount);
+			Core::Utils::StringTokenizer tokenizer(view, TEXT(' '));
+			Core::StringView token;
+			while (tokenizer.Next(token))
+			{
+				if (token.Size() > 0)
+					checksum += Core::StringToFloat(token.ToString(), nullptr);
+			}
+		}
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("ParseFloat (float64)"), FloatCount);
+			Core::Utils::StringTokenizer tokenizer(view, TEXT(' '));
+			Core::StringView token;
+			while (tokenizer.Next(token))
+			{
+				float64 value = 0.0;
+				Core::Utils::ParseFloat(token, value);
+				checksum += value;
+			}
+		}
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("ParseFloat (float32)"), FloatCount);
+			Core::Utils::StringTokenizer tokenizer(view, TEXT(' '));
+			Core::StringView token;
+			SIZE_T index = 0;
+			while (tokenizer.Next(token))
+			{
+				if (token.Size() == 0)
+					continue;
+
+				float32 value = 0.0f;
+				Core::Utils::ParseFloat(token, value);
+				if (memcmp(&value, &expected[index++], sizeof(value)) != 0)
+					mismatches++;
+			}
+		}
+		ME_BENCHMARK_LOG("float32 round-trip mismatches: {}", mismatches);
+
+		{
+			IterationBenchmark(nanoseconds, TEXT("ParseInt"), FloatCount);
+			const char8* numbers[] = { TEXT("1"), TEXT("42"), TEXT("-17"), TEXT("123456"), TEXT("9876543210"), TEXT("-1234567890123") };
+			int64 sum = 0;
+			for (SIZE_T i = 0; i < FloatCount; i++)
+			{
+				int64 value = 0;
+				Core::Utils::ParseInt(Core::StringView(numbers[i % 6]), value);
+				sum += value;
+			}
+			checksum += static_cast<float64>(sum);
+		}
+
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
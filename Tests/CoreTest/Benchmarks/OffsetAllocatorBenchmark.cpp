@@ -0,0 +1,71 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Allocators/BuddyAllocator.hpp>
+#include <Core/Memory/Allocators/TLSFAllocator.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T PairCount = 200000;
+		constexpr SIZE_T LiveCount = 384;
+		constexpr SIZE_T PoolSize = ME_MB(256);
+		// Size of a vertex in the mesh manager's vertex pool
+		constexpr SIZE_T VertexSize = 48;
+
+		// Mesh sizes spread evenly over the orders of magnitude between 64 and 64K vertices
+		SIZE_T MeshSize(uint64 random)
+		{
+			const uint32 shift = 6 + static_cast<uint32>(random % 10);
+			const SIZE_T vertices = (SIZE_T(1) << shift) + ((random >> 8) & ((SIZE_T(1) << shift) - 1));
+			return vertices * VertexSize;
+		}
+
+		void BenchmarkOffsetAllocator(const char8* name, Core::Memory::IOffsetAllocator& allocator)
+		{
+			Core::Array<Core::Memory::OAllocation> live(LiveCount);
+			for (auto& allocation : live)
+				allocation = nullptr;
+
+			uint64 state = PoolSize;
+			SIZE_T failures = 0;
+			{
+				IterationBenchmark(nanoseconds, name, PairCount);
+				for (SIZE_T i = 0; i < PairCount; i++)
+				{
+					const uint64 random = SplitMix64(state);
+					Core::Memory::OAllocation& slot = live[random % LiveCount];
+					if (slot != nullptr)
+						allocator.Free(slot);
+
+					if (allocator.Allocate(slot, MeshSize(random >> 16)) != Core::Memory::OffsetAllocatorErrors::Success)
+						failures++;
+				}
+			}
+
+			const Core::Memory::OffsetAllocatorStatistics statistics = allocator.GetStatistics();
+			ME_BENCHMARK_LOG("Failed allocations: {}, live: {}, requested: {} MB, reserved: {} MB, utilization: {:.3f}, fragmentation: {:.3f}, free blocks: {}",
+				failures, statistics.AllocationCount, statistics.RequestedSize >> 20, statistics.ReservedSize >> 20,
+				statistics.GetUtilization(), statistics.GetFragmentation(), statistics.FreeBlockCount);
+
+			for (auto& allocation : live)
+				if (allocation != nullptr)
+					allocator.Free(allocation);
+		}
+	}
+
+	void RunOffsetAllocatorBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Offset allocators, {} random mesh sized free + allocate pairs, {} live ----", PairCount, LiveCount);
+
+		Core::Memory::BuddyAllocator buddy({ ME_KB(256), PoolSize });
+		BenchmarkOffsetAllocator(TEXT("Buddy, 256 KB blocks"), buddy);
+
+		Core::Memory::BuddyAllocator smallBuddy({ 256, PoolSize });
+		BenchmarkOffsetAllocator(TEXT("Buddy, 256 B blocks"), smallBuddy);
+
+		Core::Memory::TLSFAllocator tlsf({ PoolSize, VertexSize });
+		BenchmarkOffsetAllocator(TEXT("TLSF, vertex aligned"), tlsf);
+	}
+}
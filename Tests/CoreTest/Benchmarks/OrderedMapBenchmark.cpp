@@ -0,0 +1,117 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/Map.hpp>
+#include <Core/Containers/Set.hpp>
+#include <Core/Containers/BTreeMap.hpp>
+#include <Core/Containers/BTreeSet.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Same as ME_MAX_ENTITY_COUNT, which lives in the engine
+		constexpr SIZE_T EntityCount = 50000;
+
+		template <typename MapType>
+		void BenchmarkOrderedMap(const Core::Array<uint64>& keys)
+		{
+			const SIZE_T count = keys.Size();
+			uint64 checksum = 0;
+
+			MapType map;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert (random)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					map.Insert(keys[i], i);
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Find"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					checksum += map.Find(keys[i])->Value2;
+			}
+			{
+				constexpr SIZE_T Passes = 100;
+				IterationBenchmark(nanoseconds, TEXT("Iterate"), count * Passes);
+				for (SIZE_T pass = 0; pass < Passes; pass++)
+					for (auto& pair : map)
+						checksum += pair.Value2;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase (random)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					map.Erase(keys[i]);
+			}
+
+			// Entity IDs come out of the free list mostly in ascending order
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert (ascending)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					map.Insert(i, i);
+			}
+
+			ME_BENCHMARK_LOG("Checksum: {}, size: {}", checksum, map.Size());
+		}
+
+		template <typename SetType>
+		void BenchmarkOrderedSet(const Core::Array<uint64>& keys)
+		{
+			const SIZE_T count = keys.Size();
+			uint64 checksum = 0;
+
+			SetType set;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert (random)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					set.Insert(keys[i]);
+			}
+			{
+				constexpr SIZE_T Passes = 100;
+				IterationBenchmark(nanoseconds, TEXT("Iterate"), count * Passes);
+				for (SIZE_T pass = 0; pass < Passes; pass++)
+					for (uint64 value : set)
+						checksum += value;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase (random)"), count);
+				for (SIZE_T i = 0; i < count; i++)
+					set.Erase(keys[i]);
+			}
+
+			ME_BENCHMARK_LOG("Checksum: {}, size: {}", checksum, set.Size());
+		}
+	}
+
+	void RunOrderedMapBenchmark()
+	{
+		uint64 state = EntityCount;
+		Core::Array<uint64> keys;
+		keys.Reserve(EntityCount);
+		for (SIZE_T i = 0; i < EntityCount; i++)
+			keys.PushBack(SplitMix64(state));
+
+		ME_BENCHMARK_LOG("---- Map<uint64, uint64>, {} keys ----", EntityCount);
+		BenchmarkOrderedMap<Core::Map<uint64, uint64>>(keys);
+
+		ME_BENCHMARK_LOG("---- BTreeMap<uint64, uint64>, {} keys ----", EntityCount);
+		BenchmarkOrderedMap<Core::BTreeMap<uint64, uint64>>(keys);
+
+		{
+			Core::Array<Core::Misc::Pair<uint64, uint64>> pairs;
+			pairs.Reserve(EntityCount);
+			for (SIZE_T i = 0; i < EntityCount; i++)
+				pairs.EmplaceBack(keys[i], i);
+
+			IterationBenchmark(nanoseconds, TEXT("BTreeMap InsertBulk (random)"), EntityCount);
+			Core::BTreeMap<uint64, uint64> map;
+			map.InsertBulk(std::move(pairs));
+			ME_BENCHMARK_LOG("Size: {}", map.Size());
+		}
+
+		ME_BENCHMARK_LOG("---- Set<uint64>, {} keys ----", EntityCount);
+		BenchmarkOrderedSet<Core::Set<uint64>>(keys);
+
+		ME_BENCHMARK_LOG("---- BTreeSet<uint64>, {} keys ----", EntityCount);
+		BenchmarkOrderedSet<Core::BTreeSet<uint64>>(keys);
+	}
+}
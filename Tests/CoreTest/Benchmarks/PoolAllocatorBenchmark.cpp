@@ -0,0 +1,136 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/Map.hpp>
+#include <Core/Containers/UnorderedMap.hpp>
+#include <Core/Memory/Allocators/PoolAllocator.hpp>
+
+#include <type_traits>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T ElementCount = 100000;
+
+		SIZE_T HeapAllocations = 0;
+
+		// Counts the calls which end up in the heap, for the pool that's only the non-node allocations (buckets)
+		template <typename T, bool Pooled>
+		class CountingAllocator : public std::conditional_t<Pooled, Core::Memory::PoolAllocator<T>, Core::Memory::Allocator<T>>
+		{
+			using Base = std::conditional_t<Pooled, Core::Memory::PoolAllocator<T>, Core::Memory::Allocator<T>>;
+
+		public:
+			CountingAllocator() = default;
+
+			template <typename U>
+			CountingAllocator(const CountingAllocator<U, Pooled>&) noexcept {}
+
+			T* Allocate(SIZE_T n)
+			{
+				if (!Pooled || n != 1)
+					HeapAllocations++;
+				return Base::Allocate(n);
+			}
+
+			template <typename U>
+			struct Rebind
+			{
+				using Other = CountingAllocator<U, Pooled>;
+			};
+		};
+
+		// Other systems allocating between inserts, so heap nodes don't end up back to back like in a clean process
+		struct HeapNoise
+		{
+			Core::Array<void*> Blocks;
+			uint64 State = 42;
+
+			void Allocate()
+			{
+				const SIZE_T size = 16 + SplitMix64(State) % 240;
+				Blocks.PushBack(::operator new(size));
+			}
+
+			~HeapNoise()
+			{
+				for (void* block : Blocks)
+					::operator delete(block);
+			}
+		};
+
+		template <typename MapType, typename NodeType, bool Pooled>
+		void BenchmarkNodeMap(const Core::Array<uint64>& keys)
+		{
+			const SIZE_T count = keys.Size();
+			uint64 checksum = 0;
+
+			HeapAllocations = 0;
+			const SIZE_T slabsBefore = Pooled ? Core::Memory::FixedSizePool::GetShared(sizeof(NodeType)).GetSlabCount() : 0;
+
+			HeapNoise noise;
+			{
+				MapType map;
+				{
+					IterationBenchmark(nanoseconds, TEXT("Insert"), count);
+					for (SIZE_T i = 0; i < count; i++)
+					{
+						map.Insert(keys[i], i);
+						noise.Allocate();
+					}
+				}
+				{
+					IterationBenchmark(nanoseconds, TEXT("Find"), count);
+					for (SIZE_T i = 0; i < count; i++)
+						checksum += map.Find(keys[i])->Value2;
+				}
+				{
+					constexpr SIZE_T Passes = 20;
+					IterationBenchmark(nanoseconds, TEXT("Iterate"), count * Passes);
+					for (SIZE_T pass = 0; pass < Passes; pass++)
+						for (auto& pair : map)
+							checksum += pair.Value2;
+				}
+				{
+					IterationBenchmark(nanoseconds, TEXT("Erase"), count);
+					for (SIZE_T i = 0; i < count; i++)
+						map.Erase(keys[i]);
+				}
+			}
+
+			if constexpr (Pooled)
+			{
+				// Slabs stay with the pool, a later run with a node of the same size class reuses them
+				const Core::Memory::FixedSizePool& pool = Core::Memory::FixedSizePool::GetShared(sizeof(NodeType));
+				const SIZE_T slabs = pool.GetSlabCount() - slabsBefore;
+				ME_BENCHMARK_LOG("Heap allocations: {} ({} new slabs + {} others), pool holds {} slabs of {} byte blocks, checksum: {}",
+					slabs + HeapAllocations, slabs, HeapAllocations, pool.GetSlabCount(), pool.GetBlockSize(), checksum);
+			}
+			else
+				ME_BENCHMARK_LOG("Heap allocations: {}, checksum: {}", HeapAllocations, checksum);
+		}
+	}
+
+	void RunPoolAllocatorBenchmark()
+	{
+		Core::Array<uint64> keys;
+		keys.Reserve(ElementCount);
+		uint64 state = ElementCount;
+		for (SIZE_T i = 0; i < ElementCount; i++)
+			keys.PushBack(SplitMix64(state));
+
+		using UMapNode = Core::MapNode<uint64, uint64>;
+		using MapNode = Core::MapBranch<uint64, uint64>;
+
+		ME_BENCHMARK_LOG("---- UnorderedMap<uint64, uint64>, {} elements, heap nodes ----", ElementCount);
+		BenchmarkNodeMap<Core::UnorderedMap<uint64, uint64, Core::Memory::Hasher<uint64>, CountingAllocator<void, false>>, UMapNode, false>(keys);
+		ME_BENCHMARK_LOG("---- UnorderedMap<uint64, uint64>, {} elements, pooled nodes ----", ElementCount);
+		BenchmarkNodeMap<Core::UnorderedMap<uint64, uint64, Core::Memory::Hasher<uint64>, CountingAllocator<void, true>>, UMapNode, true>(keys);
+
+		ME_BENCHMARK_LOG("---- Map<uint64, uint64>, {} elements, heap nodes ----", ElementCount);
+		BenchmarkNodeMap<Core::Map<uint64, uint64, CountingAllocator<MapNode, false>>, MapNode, false>(keys);
+		ME_BENCHMARK_LOG("---- Map<uint64, uint64>, {} elements, pooled nodes ----", ElementCount);
+		BenchmarkNodeMap<Core::Map<uint64, uint64, CountingAllocator<MapNode, true>>, MapNode, true>(keys);
+	}
+}
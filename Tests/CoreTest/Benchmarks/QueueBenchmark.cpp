@@ -0,0 +1,124 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/SPSCQueue.hpp>
+#include <Core/Containers/MPMCQueue.hpp>
+
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T ItemCount = 4000000;
+		constexpr SIZE_T QueueCapacity = 4096;
+
+		// What the engine would reach for without a concurrent queue
+		class MutexQueue
+		{
+		public:
+			explicit MutexQueue(SIZE_T) {}
+
+			bool TryPush(uint64 value)
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Queue.push(value);
+				return true;
+			}
+
+			bool TryPop(uint64& out)
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				if (m_Queue.empty())
+					return false;
+				out = m_Queue.front();
+				m_Queue.pop();
+				return true;
+			}
+
+		private:
+			std::mutex m_Mutex;
+			std::queue<uint64> m_Queue;
+		};
+
+		// Producers push 1..N, consumers stop at a 0 which is pushed once all producers are done
+		template <typename QueueType>
+		void BenchmarkQueue(const char8* name, SIZE_T producers, SIZE_T consumers)
+		{
+			QueueType queue(QueueCapacity);
+			const SIZE_T perProducer = ItemCount / producers;
+			const uint64 total = perProducer * producers;
+			Core::Atomic_uint64 checksum = 0;
+
+			{
+				IterationBenchmark(nanoseconds, name, total);
+
+				Core::Array<std::thread> consumerThreads;
+				for (SIZE_T c = 0; c < consumers; c++)
+				{
+					consumerThreads.EmplaceBack([&queue, &checksum]()
+					{
+						uint64 sum = 0;
+						uint64 value = 0;
+						while (true)
+						{
+							if (!queue.TryPop(value))
+							{
+								std::this_thread::yield();
+								continue;
+							}
+							if (value == 0)
+								break;
+							sum += value;
+						}
+						checksum += sum;
+					});
+				}
+
+				Core::Array<std::thread> producerThreads;
+				for (SIZE_T p = 0; p < producers; p++)
+				{
+					producerThreads.EmplaceBack([&queue, p, perProducer]()
+					{
+						for (SIZE_T i = 0; i < perProducer; i++)
+						{
+							while (!queue.TryPush(p * perProducer + i + 1))
+								std::this_thread::yield();
+						}
+					});
+				}
+
+				for (auto& thread : producerThreads)
+					thread.join();
+				for (SIZE_T c = 0; c < consumers; c++)
+				{
+					while (!queue.TryPush(0))
+						std::this_thread::yield();
+				}
+				for (auto& thread : consumerThreads)
+					thread.join();
+			}
+
+			const uint64 expected = total * (total + 1) / 2;
+			if (checksum != expected)
+				ME_BENCHMARK_LOG("Checksum mismatch: {} (expected {})", checksum.load(), expected);
+		}
+	}
+
+	void RunQueueBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Queues, {} items, 1 producer / 1 consumer ----", ItemCount);
+		BenchmarkQueue<Core::SPSCQueue<uint64>>(TEXT("SPSCQueue"), 1, 1);
+		BenchmarkQueue<Core::MPMCQueue<uint64>>(TEXT("MPMCQueue"), 1, 1);
+		BenchmarkQueue<MutexQueue>(TEXT("std::queue + std::mutex"), 1, 1);
+
+		for (SIZE_T threads = 2; threads <= 8; threads *= 2)
+		{
+			ME_BENCHMARK_LOG("---- Queues, {} items, {} producers / {} consumers ----", ItemCount, threads, threads);
+			BenchmarkQueue<Core::MPMCQueue<uint64>>(TEXT("MPMCQueue"), threads, threads);
+			BenchmarkQueue<MutexQueue>(TEXT("std::queue + std::mutex"), threads, threads);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Memory/Memory.hpp>
+#include <Core/Memory/Pointers/Reference.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		constexpr SIZE_T ObjectCount = 4096;
+		// Every object is copied this many times into a by-value array, like the entity lists World::View hands out
+		constexpr SIZE_T CopiesPerObject = 64;
+
+		struct SharedObject
+		{
+			uint64 Value = 1;
+		};
+
+		struct SingleThreadedObject : Core::Memory::RefCounted<Core::Memory::PtrMode::SingleThreaded>
+		{
+			uint64 Value = 1;
+		};
+
+		struct ThreadSafeObject : Core::Memory::RefCounted<Core::Memory::PtrMode::ThreadSafe>
+		{
+			uint64 Value = 1;
+		};
+
+		template <typename Handle, typename Factory>
+		uint64 BenchmarkHandles(const char8* name, Factory&& create)
+		{
+			Core::Array<Handle> objects(ObjectCount);
+			for (Handle& object : objects)
+				object = create();
+
+			uint64 checksum = 0;
+			{
+				IterationBenchmark(nanoseconds, name, ObjectCount * CopiesPerObject);
+				Core::Array<Handle> copies;
+				copies.Reserve(ObjectCount);
+				for (SIZE_T round = 0; round < CopiesPerObject; round++)
+				{
+					for (const Handle& object : objects)
+						copies.PushBack(object);
+					checksum += copies[round % ObjectCount]->Value;
+					copies.Clear();
+				}
+			}
+			return checksum;
+		}
+
+		template <typename Handle, typename Factory>
+		void BenchmarkCreation(const char8* name, Factory&& create)
+		{
+			Core::Array<Handle> objects;
+			objects.Reserve(ObjectCount);
+
+			IterationBenchmark(nanoseconds, name, ObjectCount * 16);
+			for (SIZE_T round = 0; round < 16; round++)
+			{
+				for (SIZE_T i = 0; i < ObjectCount; i++)
+					objects.PushBack(create());
+				objects.Clear();
+			}
+		}
+	}
+
+	void RunReferenceBenchmark()
+	{
+		ME_BENCHMARK_LOG("---- Handle copy + destroy, {} objects x {} copies ----", ObjectCount, CopiesPerObject);
+		uint64 checksum = BenchmarkHandles<Core::Memory::Reference<SharedObject>>(TEXT("std::shared_ptr"),
+			[]() { return Core::Memory::MakeReference<SharedObject>(); });
+		checksum += BenchmarkHandles<Core::Memory::Ref<ThreadSafeObject>>(TEXT("Ref, thread safe"),
+			[]() { return Core::Memory::MakeRef<ThreadSafeObject>(); });
+		checksum += BenchmarkHandles<Core::Memory::Ref<SingleThreadedObject>>(TEXT("Ref, single threaded"),
+			[]() { return Core::Memory::MakeRef<SingleThreadedObject>(); });
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+
+		ME_BENCHMARK_LOG("---- Handle create + destroy, {} objects ----", ObjectCount * 16);
+		BenchmarkCreation<Core::Memory::Reference<SharedObject>>(TEXT("std::shared_ptr"),
+			[]() { return Core::Memory::MakeReference<SharedObject>(); });
+		BenchmarkCreation<Core::Memory::Ref<ThreadSafeObject>>(TEXT("Ref, thread safe"),
+			[]() { return Core::Memory::MakeRef<ThreadSafeObject>(); });
+		BenchmarkCreation<Core::Memory::Ref<SingleThreadedObject>>(TEXT("Ref, single threaded"),
+			[]() { return Core::Memory::MakeRef<SingleThreadedObject>(); });
+	}
+}
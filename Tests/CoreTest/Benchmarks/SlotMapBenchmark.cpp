@@ -0,0 +1,91 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/SlotMap.hpp>
+#include <Core/Memory/Memory.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Roughly the buffers, textures and pipelines a frame of the renderer touches
+		constexpr SIZE_T ResourceCount = 4096;
+		constexpr SIZE_T BindCount = 1 << 20;
+
+		struct Resource
+		{
+			uint64 Binding = 1;
+		};
+
+		// Stand-ins for the backend's bind calls
+		uint64 BindByValue(Core::Memory::Reference<Resource> resource)
+		{
+			return resource->Binding;
+		}
+
+		uint64 BindByPointer(const Resource* resource)
+		{
+			return resource ? resource->Binding : 0;
+		}
+
+		// Called through these so they stay out of line like the virtual ones
+		uint64 (*volatile BindByValueCall)(Core::Memory::Reference<Resource>) = BindByValue;
+		uint64 (*volatile BindByPointerCall)(const Resource*) = BindByPointer;
+	}
+
+	void RunSlotMapBenchmark()
+	{
+		Core::Array<uint32> order;
+		order.Reserve(BindCount);
+		uint64 state = ResourceCount;
+		for (SIZE_T i = 0; i < BindCount; i++)
+			order.PushBack(static_cast<uint32>(SplitMix64(state) % ResourceCount));
+
+		Core::Array<Core::Memory::Reference<Resource>> references;
+		Core::SlotMap<Core::Memory::Reference<Resource>> slots;
+		Core::Array<Core::SlotHandle> handles;
+		references.Reserve(ResourceCount);
+		handles.Reserve(ResourceCount);
+		for (SIZE_T i = 0; i < ResourceCount; i++)
+		{
+			references.PushBack(Core::Memory::MakeReference<Resource>());
+			handles.PushBack(slots.Insert(references[i]));
+		}
+
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- Binding {} of {} resources ----", BindCount, ResourceCount);
+		{
+			IterationBenchmark(nanoseconds, TEXT("Reference by value"), BindCount);
+			for (SIZE_T i = 0; i < BindCount; i++)
+				checksum += BindByValueCall(references[order[i]]);
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("SlotMap handle"), BindCount);
+			for (SIZE_T i = 0; i < BindCount; i++)
+			{
+				const Core::Memory::Reference<Resource>* resource = slots.Find(handles[order[i]]);
+				checksum += BindByPointerCall(resource ? resource->get() : nullptr);
+			}
+		}
+
+		ME_BENCHMARK_LOG("---- Recreating resources, {} handles ----", ResourceCount);
+		{
+			SIZE_T stale = 0;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase + Insert"), BindCount);
+				for (SIZE_T i = 0; i < BindCount; i++)
+				{
+					Core::SlotHandle& handle = handles[order[i]];
+					slots.Erase(handle);
+					handle = slots.Insert(references[order[i]]);
+				}
+			}
+			for (SIZE_T i = 0; i < ResourceCount; i++)
+				stale += slots.Contains(handles[i]) ? 0 : 1;
+			ME_BENCHMARK_LOG("Stale handles: {}, live values: {}", stale, slots.Size());
+		}
+
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
@@ -0,0 +1,90 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Containers/SparseSet.hpp>
+#include <Core/Containers/UnorderedMap.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Same as ME_MAX_ENTITY_COUNT, which lives in the engine
+		constexpr SIZE_T EntityCount = 50000;
+	}
+
+	void RunSparseSetBenchmark()
+	{
+		// Entity IDs are dense, shuffle them so neither container sees them in order
+		Core::Array<uint64> entities;
+		entities.Reserve(EntityCount);
+		for (SIZE_T i = 0; i < EntityCount; i++)
+			entities.PushBack(i);
+
+		uint64 state = EntityCount;
+		for (SIZE_T i = EntityCount - 1; i > 0; i--)
+		{
+			const SIZE_T j = SplitMix64(state) % (i + 1);
+			const uint64 temp = entities[i];
+			entities[i] = entities[j];
+			entities[j] = temp;
+		}
+
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- UnorderedMap<uint64, uint64>, {} entities ----", EntityCount);
+		{
+			Core::UnorderedMap<uint64, uint64> map;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					map.Insert(entities[i], i);
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Find"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					checksum += map.Find(i)->Value2;
+			}
+			{
+				constexpr SIZE_T Passes = 100;
+				IterationBenchmark(nanoseconds, TEXT("Iterate"), EntityCount * Passes);
+				for (SIZE_T pass = 0; pass < Passes; pass++)
+					for (auto& pair : map)
+						checksum += pair.Value2;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					map.Erase(entities[i]);
+			}
+		}
+
+		ME_BENCHMARK_LOG("---- SparseSet<uint64>, {} entities ----", EntityCount);
+		{
+			Core::SparseSet<uint64> set;
+			{
+				IterationBenchmark(nanoseconds, TEXT("Insert"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					set.Insert(entities[i], i);
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Find"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					checksum += *set.Find(i);
+			}
+			{
+				constexpr SIZE_T Passes = 100;
+				IterationBenchmark(nanoseconds, TEXT("Iterate"), EntityCount * Passes);
+				for (SIZE_T pass = 0; pass < Passes; pass++)
+					for (uint64 value : set)
+						checksum += value;
+			}
+			{
+				IterationBenchmark(nanoseconds, TEXT("Erase"), EntityCount);
+				for (SIZE_T i = 0; i < EntityCount; i++)
+					set.Erase(entities[i]);
+			}
+		}
+
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
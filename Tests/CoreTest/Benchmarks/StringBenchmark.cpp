@@ -0,0 +1,82 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/String.hpp>
+#include <Core/Memory/Hasher.hpp>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		// Forwards to the default allocator and counts heap allocations
+		template <typename T>
+		class CountingAllocator : public Core::Memory::Allocator<T>
+		{
+		public:
+			static inline SIZE_T Allocations = 0;
+
+			T* Allocate(SIZE_T n)
+			{
+				Allocations++;
+				return Core::Memory::Allocator<T>::Allocate(n);
+			}
+		};
+
+		using CountedString = Core::PString<char8, CountingAllocator<char8>>;
+
+		constexpr SIZE_T StringCount = 1000000;
+
+		void BenchmarkStrings(const char8* text, const char8* label)
+		{
+			ME_BENCHMARK_LOG("---- {} ({} chars) ----", ME_LOGGER_TEXT(label), Core::GetStringSize(text));
+
+			Core::Memory::Hasher<Core::StringView> hasher;
+			uint64 checksum = 0;
+			SIZE_T allocations = 0;
+
+			{
+				CountingAllocator<char8>::Allocations = 0;
+				IterationBenchmark(nanoseconds, TEXT("Construct"), StringCount);
+				for (SIZE_T i = 0; i < StringCount; i++)
+				{
+					CountedString str(text);
+					checksum += str.Size();
+				}
+				allocations = CountingAllocator<char8>::Allocations;
+			}
+			ME_BENCHMARK_LOG("Construct allocations: {}", allocations);
+
+			CountedString source(text);
+			{
+				CountingAllocator<char8>::Allocations = 0;
+				IterationBenchmark(nanoseconds, TEXT("Copy"), StringCount);
+				for (SIZE_T i = 0; i < StringCount; i++)
+				{
+					CountedString copy(source);
+					checksum += copy.Size();
+				}
+				allocations = CountingAllocator<char8>::Allocations;
+			}
+			ME_BENCHMARK_LOG("Copy allocations: {}", allocations);
+
+			{
+				CountingAllocator<char8>::Allocations = 0;
+				IterationBenchmark(nanoseconds, TEXT("Construct + hash"), StringCount);
+				for (SIZE_T i = 0; i < StringCount; i++)
+				{
+					CountedString str(text);
+					checksum += hasher(Core::StringView(str.String(), str.Size()));
+				}
+				allocations = CountingAllocator<char8>::Allocations;
+			}
+			ME_BENCHMARK_LOG("Construct + hash allocations: {}", allocations);
+
+			ME_BENCHMARK_LOG("Checksum: {}", checksum);
+		}
+	}
+
+	void RunStringBenchmark()
+	{
+		BenchmarkStrings(TEXT("Mesh_Albedo_01"), TEXT("Short string"));
+		BenchmarkStrings(TEXT("Assets/Shaders/Deferred/GBufferPass.hlsl"), TEXT("Long string"));
+	}
+}
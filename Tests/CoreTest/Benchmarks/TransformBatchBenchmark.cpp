@@ -0,0 +1,125 @@
+#include "Benchmarks.hpp"
+
+#include <Core/Containers/Array.hpp>
+#include <Core/Math/Transform.hpp>
+#include <Core/Math/TransformBatch.hpp>
+
+#include <bit>
+
+namespace ME::Tests
+{
+	namespace
+	{
+		using Core::Math::Matrix4x4;
+		using Core::Math::Quaternion;
+		using Core::Math::Transform;
+		using Core::Math::Vector3D;
+
+		// Instances per frame, not a multiple of 16 so the narrower paths and the tail run too
+		constexpr SIZE_T TransformCount = 10007;
+		constexpr SIZE_T FrameCount = 100;
+
+		float32 RandomFloat(uint64& state, float32 range)
+		{
+			return (static_cast<float32>(SplitMix64(state) % 20001) / 10000.0f - 1.0f) * range;
+		}
+
+		// Compares by value, a zero may come out with the other sign
+		bool SameMatrix(const Matrix4x4& a, const Matrix4x4& b)
+		{
+			for (uint32 row = 0; row < 4; row++)
+				for (uint32 column = 0; column < 4; column++)
+					if (a.m[row][column] != b.m[row][column])
+						return false;
+			return true;
+		}
+	}
+
+	void RunTransformBatchBenchmark()
+	{
+		uint64 state = TransformCount;
+		Core::Array<Transform> transforms(TransformCount);
+		Core::Array<Transform*> pointers(TransformCount);
+
+		Core::Array<float32> positionX(TransformCount), positionY(TransformCount), positionZ(TransformCount);
+		Core::Array<float32> rotationW(TransformCount), rotationX(TransformCount), rotationY(TransformCount), rotationZ(TransformCount);
+		Core::Array<float32> scaleX(TransformCount), scaleY(TransformCount), scaleZ(TransformCount);
+
+		for (SIZE_T i = 0; i < TransformCount; i++)
+		{
+			const Vector3D position(RandomFloat(state, 100.0f), RandomFloat(state, 100.0f), RandomFloat(state, 100.0f));
+			const Quaternion rotation = Quaternion(RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f), RandomFloat(state, 1.0f)).Normalized();
+			const Vector3D scale(1.5f + RandomFloat(state, 1.0f), 1.5f + RandomFloat(state, 1.0f), 1.5f + RandomFloat(state, 1.0f));
+
+			transforms[i].SetPosition(position);
+			transforms[i].SetRotation(rotation);
+			transforms[i].SetScale(scale);
+			pointers[i] = &transforms[i];
+
+			const Quaternion& stored = transforms[i].QRotation();
+			positionX[i] = position.X; positionY[i] = position.Y; positionZ[i] = position.Z;
+			rotationW[i] = stored.w; rotationX[i] = stored.x; rotationY[i] = stored.y; rotationZ[i] = stored.z;
+			scaleX[i] = scale.X; scaleY[i] = scale.Y; scaleZ[i] = scale.Z;
+		}
+
+		const Core::Math::TransformArrays arrays = {
+			positionX.Data(), positionY.Data(), positionZ.Data(),
+			rotationW.Data(), rotationX.Data(), rotationY.Data(), rotationZ.Data(),
+			scaleX.Data(), scaleY.Data(), scaleZ.Data()
+		};
+
+		Core::Array<Matrix4x4> matrices(TransformCount);
+		uint64 checksum = 0;
+
+		ME_BENCHMARK_LOG("---- {} transforms to GPU matrices, time per transform ----", TransformCount);
+		{
+			IterationBenchmark(nanoseconds, TEXT("FromTranslationRotationScale + Transpose"), FrameCount * TransformCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+				for (SIZE_T i = 0; i < TransformCount; i++)
+					matrices[i] = Matrix4x4::FromTranslationRotationScale(transforms[i].Position(), transforms[i].QRotation(), transforms[i].Scale()).Transpose();
+		}
+		checksum += std::bit_cast<uint32>(matrices[TransformCount - 1].m14);
+		{
+			IterationBenchmark(nanoseconds, TEXT("ComposeTransforms, column-major"), FrameCount * TransformCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+				Core::Math::ComposeTransforms(arrays, TransformCount, matrices.Data());
+		}
+		checksum += std::bit_cast<uint32>(matrices[TransformCount - 1].m14);
+
+		ME_BENCHMARK_LOG("---- {} dirty transforms, time per transform ----", TransformCount);
+		{
+			IterationBenchmark(nanoseconds, TEXT("Transform::Matrix one by one"), FrameCount * TransformCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+			{
+				for (SIZE_T i = 0; i < TransformCount; i++)
+				{
+					transforms[i].SetScale(transforms[i].Scale());
+					checksum += std::bit_cast<uint32>(transforms[i].Matrix().m41);
+				}
+			}
+		}
+		{
+			IterationBenchmark(nanoseconds, TEXT("Transform::UpdateMatrices"), FrameCount * TransformCount);
+			for (SIZE_T frame = 0; frame < FrameCount; frame++)
+			{
+				for (SIZE_T i = 0; i < TransformCount; i++)
+					transforms[i].SetScale(transforms[i].Scale());
+				Transform::UpdateMatrices(pointers.Data(), TransformCount);
+			}
+		}
+
+		SIZE_T mismatches = 0;
+		Core::Math::ComposeTransforms(arrays, TransformCount, matrices.Data(), Core::Math::MatrixLayout::RowMajor);
+		for (SIZE_T i = 0; i < TransformCount; i++)
+		{
+			const Matrix4x4 expected = Matrix4x4::FromTranslationRotationScale(transforms[i].Position(), transforms[i].QRotation(), transforms[i].Scale());
+			mismatches += !SameMatrix(matrices[i], expected) || !SameMatrix(transforms[i].Matrix(), expected) || transforms[i].IsDirty();
+		}
+		Core::Math::ComposeTransforms(arrays, TransformCount, matrices.Data());
+		for (SIZE_T i = 0; i < TransformCount; i++)
+			mismatches += !SameMatrix(matrices[i], transforms[i].Matrix().Transpose());
+
+		ME_BENCHMARK_LOG("Mismatches against the single transform path: {}", mismatches);
+		ME_BENCHMARK_LOG("Checksum: {}", checksum);
+	}
+}
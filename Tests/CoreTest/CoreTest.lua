@@ -14,6 +14,8 @@ project "CoreTest"
 	files 
 	{
 		"main.cpp",
+		"Benchmarks/**.hpp",
+		"Benchmarks/**.cpp",
 	}
 
 	includedirs 
@@ -21,21 +23,30 @@ project "CoreTest"
 		includeDirs.EngineCore,
 		includeDirs.spdlog,
 		includeDirs.xxHash,
+		-- Mesh manager benchmark
+		includeDirs.EngineSrc,
+		includeDirs.DXC,
+		includeDirs.VMA,
+		VULKAN_SDK .."/Include",
 	}
 
 	links 
 	{
 		"EngineCore",
+		"Engine",
 	}
 
 	libdirs
 	{
 		"%{wks.location}/bin/" .. outputdir .. "/CoreTest",
+		"%{wks.location}/bin/" .. outputdir .. "/Engine",
 	}
 
 	prebuildcommands
 	{
 		("{COPYDIR} %{wks.location}bin/" .. outputdir .. "/EngineCore/EngineCore.dll %{wks.location}bin/" .. outputdir .. "/CoreTest/"),
+		("{COPYDIR} %{wks.location}bin/" .. outputdir .. "/Engine/Engine.dll %{wks.location}bin/" .. outputdir .. "/CoreTest/"),
+		("{COPYDIR} %{wks.location}bin/" .. outputdir .. "/DXC/dxcompiler.dll %{wks.location}bin/" .. outputdir .. "/CoreTest/"),
 	}
 
 	filter "system:windows"
@@ -58,7 +69,7 @@ project "CoreTest"
 		compileas "C++"
 
 	filter "configurations:Debug"
-		defines "ME_DEBUG"
+		defines { "ME_DEBUG", "ME_MEMWATCH" }
 		symbols "On"
 
 	filter "configurations:Release"
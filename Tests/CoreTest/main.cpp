@@ -1,6 +1,8 @@
 ﻿#include <Core.hpp>
 #include <Core/Math/Math.hpp>
 
+#include "Benchmarks/Benchmarks.hpp"
+
 using namespace ME;
 using namespace Core;
 
@@ -11,5 +13,27 @@ int main()
     auto q = Math::Quaternion::FromEulerAnglesYXZ(0, Math::ToRadians(90.f), 0);
     ME_INFO("Rotated (0,0,1): {}", q.RotateVector({ 0, 0, 1 }));
 
+    Tests::RunHashMapBenchmark();
+    Tests::RunStringBenchmark();
+    Tests::RunNumberParsingBenchmark();
+    Tests::RunArrayBenchmark();
+    Tests::RunOrderedMapBenchmark();
+    Tests::RunSparseSetBenchmark();
+    Tests::RunQueueBenchmark();
+    Tests::RunArenaBenchmark();
+    Tests::RunPoolAllocatorBenchmark();
+    Tests::RunBuddyAllocatorBenchmark();
+    Tests::RunOffsetAllocatorBenchmark();
+    Tests::RunReferenceBenchmark();
+    Tests::RunSlotMapBenchmark();
+    Tests::RunMemWatchBenchmark();
+    Tests::RunCachingAllocatorBenchmark();
+    Tests::RunLargeBlockAllocatorBenchmark();
+    Tests::RunHashBenchmark();
+    Tests::RunMathBenchmark();
+    Tests::RunTransformBatchBenchmark();
+    Tests::RunFrustumCullingBenchmark();
+    Tests::RunMeshManagerBenchmark();
+
     Utility::Logger::Shutdown();
 }
\ No newline at end of file